@@ -21,6 +21,7 @@ private:
     std::unique_ptr<Swapchain> swapchain = nullptr;
 
     std::unique_ptr<Image> depthBuffer = nullptr;
+    bool depthBufferPrepared = false;
     std::unique_ptr<RenderPass> renderPass = nullptr;
 
     std::unique_ptr<Shader> vertexShader = nullptr;
@@ -53,16 +54,7 @@ private:
         swapchain = GetRenderingContext().CreateSwapchain({ .name = "Cube Swapchain", .window = window, .preferredPresentationMode = SwapchainPresentationMode::VSync });
 
         // Create depth image to properly order 3D meshes
-        const auto depthFormat = GetRenderingContext().GetDevice().GetSupportedImageFormat({ .channels = ImageChannels::D, .memoryType = ImageMemoryType::UNorm16 }, ImageUsage::DepthAttachment);
-        APP_ERROR_IF(!depthFormat.has_value(), "No suitable depth format is supported by rendering context [{0}]!", GetRenderingContext().GetName());
-        depthBuffer = GetRenderingContext().CreateImage({
-            .name = "Depth Buffer Image",
-            .width = swapchain->GetWidth(),
-            .height = swapchain->GetHeight(),
-            .format = depthFormat.value(),
-            .usage = ImageUsage::DepthAttachment,
-            .memoryLocation = ImageMemoryLocation::Device
-        });
+        CreateDepthBuffer();
 
         // Create render pass
         renderPass = GetRenderingContext().CreateRenderPass({
@@ -76,15 +68,25 @@ private:
             }
         });
 
+        // Recreate depth buffer and resize render pass whenever swapchain gets recreated with a new size
+        swapchain->OnEvent<SwapchainResizeEvent>([this](const SwapchainResizeEvent &event)
+        {
+            // Old depth buffer may still be in use by frames in flight, so it is queued for destruction, instead of waiting for them
+            GetRenderingContext().GetDevice().QueueResourceForDestruction(std::move(depthBuffer));
+            CreateDepthBuffer();
+
+            renderPass->Resize(event.GetSize().x, event.GetSize().y);
+            return false;
+        });
+
         // Load shaders
         vertexShader = GetRenderingContext().CreateShader({ .name = "Cube Vertex Shader", .shaderBundlePath = File::GetResourcesDirectoryPath() / "shaders/CubeShader.vert.shader", .shaderType = ShaderType::Vertex });
         fragmentShader = GetRenderingContext().CreateShader({ .name = "Cube Fragment Shader", .shaderBundlePath = File::GetResourcesDirectoryPath() / "shaders/CubeShader.frag.shader", .shaderType = ShaderType::Fragment });
 
-        // Define pipeline layout
+        // Define pipeline layout (bindings and push constants are reflected from shaders)
         pipelineLayout = GetRenderingContext().CreatePipelineLayout({
             .name = "Cube Graphics Pipeline Layout",
-            .bindings = { { .type = PipelineBindingType::UniformBuffer } },
-            .pushConstantSize = sizeof(PushConstantData)
+            .shaders = { vertexShader, fragmentShader }
         });
 
         // Create graphics pipeline
@@ -168,6 +170,21 @@ private:
         GetRenderingContext().GetDevice().WaitForCommandBuffer(transferCommandBuffer);
     }
 
+    void CreateDepthBuffer()
+    {
+        const auto depthFormat = GetRenderingContext().GetDevice().GetSupportedImageFormat({ .channels = ImageChannels::D, .memoryType = ImageMemoryType::UNorm16 }, ImageUsage::DepthAttachment);
+        APP_ERROR_IF(!depthFormat.has_value(), "No suitable depth format is supported by rendering context [{0}]!", GetRenderingContext().GetName());
+        depthBuffer = GetRenderingContext().CreateImage({
+            .name = "Depth Buffer Image",
+            .width = swapchain->GetWidth(),
+            .height = swapchain->GetHeight(),
+            .format = depthFormat.value(),
+            .usage = ImageUsage::DepthAttachment,
+            .memoryLocation = ImageMemoryLocation::Device
+        });
+        depthBufferPrepared = false;
+    }
+
     bool Update(const TimeStep &timeStep) override
     {
         // Update uniform buffer's data
@@ -186,22 +203,26 @@ private:
         // Wait until it is no longer in use
         GetRenderingContext().GetDevice().WaitForCommandBuffer(commandBuffer);
 
+        // Swap out old swapchain image (before recording, as the swapchain may get recreated, and resources resized, in the meantime)
+        swapchain->AcquireNextImage();
+
         // Begin recording commands to GPU
         commandBuffer->Begin();
 
-        // Swap out old swapchain image
-        swapchain->AcquireNextImage();
-
         static bool firstCall = true;
         if (firstCall)
         {
             // Make sure we have finished copying data to buffers before reading from them
             commandBuffer->SynchronizeBufferUsage(vertexBuffer, BufferCommandUsage::MemoryWrite, BufferCommandUsage::VertexRead);
             commandBuffer->SynchronizeBufferUsage(indexBuffer, BufferCommandUsage::MemoryWrite, BufferCommandUsage::IndexRead);
+            firstCall = false;
+        }
 
-            // Prepare depth image for writing
+        if (!depthBufferPrepared)
+        {
+            // Prepare depth image for writing (again, if it has been recreated)
             commandBuffer->SynchronizeImageUsage(depthBuffer, ImageCommandUsage::None, ImageCommandUsage::DepthWrite);
-            firstCall = false;
+            depthBufferPrepared = true;
         }
         else
         {
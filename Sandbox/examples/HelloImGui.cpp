@@ -48,6 +48,13 @@ private:
             .scaling = static_cast<float32>(swapchain->GetImage(0)->GetWidth()) / static_cast<float32>(window->GetSize().x)
         });
 
+        // Resize ImGui whenever swapchain gets recreated with a new size
+        swapchain->OnEvent<SwapchainResizeEvent>([this](const SwapchainResizeEvent &event)
+        {
+            imGuiTask->Resize(event.GetSize().x, event.GetSize().y);
+            return false;
+        });
+
         // Create a command buffer for every concurrent frame
         commandBuffers.resize(swapchain->GetConcurrentFrameCount());
         for (uint32 i = 0; i < swapchain->GetConcurrentFrameCount(); i++)
@@ -72,12 +79,12 @@ private:
         // Wait until it is no longer in use
         GetRenderingContext().GetDevice().WaitForCommandBuffer(commandBuffer);
 
+        // Swap out old swapchain image (before recording, as the swapchain may get recreated, and resources resized, in the meantime)
+        swapchain->AcquireNextImage();
+
         // Begin recording commands to GPU
         commandBuffer->Begin();
 
-        // Swap out old swapchain image
-        swapchain->AcquireNextImage();
-
         static bool firstCall = true;
         if (firstCall)
         {
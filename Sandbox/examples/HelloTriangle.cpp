@@ -47,12 +47,19 @@ private:
             }
         });
 
+        // Resize render pass whenever swapchain gets recreated with a new size (old framebuffers are kept alive by the device, until frames using them have finished)
+        swapchain->OnEvent<SwapchainResizeEvent>([this](const SwapchainResizeEvent &event)
+        {
+            renderPass->Resize(event.GetSize().x, event.GetSize().y);
+            return false;
+        });
+
         // Load shaders
         vertexShader = GetRenderingContext().CreateShader({ .name = "Triangle Vertex Shader", .shaderBundlePath = File::GetResourcesDirectoryPath() / "shaders/TriangleShader.vert.shader", .shaderType = ShaderType::Vertex });
         fragmentShader = GetRenderingContext().CreateShader({ .name = "Triangle Fragment Shader", .shaderBundlePath = File::GetResourcesDirectoryPath() / "shaders/TriangleShader.frag.shader", .shaderType = ShaderType::Fragment });
 
         // Create graphics pipeline
-        pipelineLayout = GetRenderingContext().CreatePipelineLayout({ .name = "Triangle Graphics Pipeline Layout" });
+        pipelineLayout = GetRenderingContext().CreatePipelineLayout({ .name = "Triangle Graphics Pipeline Layout", .shaders = { vertexShader, fragmentShader } });
         graphicsPipeline = GetRenderingContext().CreateGraphicsPipeline({
             .name = "Triangle Graphics Pipeline",
             .vertexShader = vertexShader,
@@ -78,12 +85,12 @@ private:
         // Wait until it is no longer in use
         GetRenderingContext().GetDevice().WaitForCommandBuffer(commandBuffer);
 
+        // Swap out old swapchain image (before recording, as the swapchain may get recreated, and resources resized, in the meantime)
+        swapchain->AcquireNextImage();
+
         // Begin recording commands to GPU
         commandBuffer->Begin();
 
-        // Swap out old swapchain image
-        swapchain->AcquireNextImage();
-
         // Begin rendering to current swapchain image
         commandBuffer->BeginRenderPass(renderPass, { { .image = swapchain->GetCurrentImage() } });
 
@@ -20,7 +20,11 @@
 #include "../src/Core/Window.h"
 #include "../src/Core/WindowManager.h"
 #include "../src/Utilities/File.h"
+#include "../src/Utilities/Geometry.h"
+#include "../src/Utilities/ImageContainer.h"
+#include "../src/Utilities/Readback.h"
 #include "../src/Utilities/RNG.h"
+#include "../src/Utilities/ShaderWatcher.h"
 #include "../src/Utilities/Time.h"
 #if SR_BUILD_IMGUI
     #include "../src/Extensions/ImGuiRenderTask.h"
@@ -1,6 +1,7 @@
 import os
 import sys
 import enum
+import struct
 import platform
 
 CURRENT_DIRECTORY: str = os.path.dirname(os.path.realpath(__file__)).replace('\\', '/') + '/'
@@ -60,7 +61,66 @@ def CompileShader(inputShaderFilePath: str, outputShaderDirectoryPath: str) -> N
     for language in targetLanguages:
         os.system(command + language)
 
-if len(sys.argv) < 2 + 1:
+# Must match the constants and layout within ShaderArchive.h
+SHADER_ARCHIVE_MAGIC_NUMBER: int = 0x41535253
+SHADER_ARCHIVE_VERSION: int = 1
+SHADER_ARCHIVE_FILE_ALIGNMENT: int = 16
+SHADER_ARCHIVE_HEADER_SIZE: int = 16
+SHADER_ARCHIVE_ENTRY_SIZE: int = 32
+
+def GetShaderArchiveFileHash(name: bytes) -> int:
+    # 64-bit FNV-1a
+    hash: int = 0xCBF29CE484222325
+    for byte in name:
+        hash ^= byte
+        hash = (hash * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+    return hash
+
+def PackShaderArchive(inputShaderDirectoryPath: str, outputArchiveFilePath: str) -> None:
+    # Collect every file of every shader bundle, named as '<bundle>/<file>'
+    files: list[tuple[int, bytes, str]] = []
+    for bundleName in sorted(os.listdir(inputShaderDirectoryPath)):
+        bundlePath: str = os.path.join(inputShaderDirectoryPath, bundleName)
+        if not bundleName.endswith('.shader') or not os.path.isdir(bundlePath):
+            continue
+        for fileName in sorted(os.listdir(bundlePath)):
+            filePath: str = os.path.join(bundlePath, fileName)
+            if os.path.isfile(filePath):
+                name: bytes = f'{ bundleName }/{ fileName }'.encode('utf-8')
+                files.append((GetShaderArchiveFileHash(name), name, filePath))
+
+    # Table of contents is sorted by hash, so files can be binary searched
+    files.sort(key = lambda file: (file[0], file[1]))
+
+    # Lay out names right after the table of contents, and every file at an aligned offset after them
+    nameTable: bytes = b''.join(name for _, name, _ in files)
+    dataOffset: int = SHADER_ARCHIVE_HEADER_SIZE + len(files) * SHADER_ARCHIVE_ENTRY_SIZE + len(nameTable)
+
+    entries: bytes = b''
+    data: bytes = b''
+    nameOffset: int = 0
+    for hash, name, filePath in files:
+        with open(filePath, 'rb') as file:
+            fileData: bytes = file.read()
+
+        padding: int = -(dataOffset + len(data)) % SHADER_ARCHIVE_FILE_ALIGNMENT
+        data += b'\0' * padding
+        entries += struct.pack('<QIIQQ', hash, nameOffset, len(name), dataOffset + len(data), len(fileData))
+
+        data += fileData
+        nameOffset += len(name)
+
+    # Write archive
+    with open(outputArchiveFilePath, 'wb') as archive:
+        archive.write(struct.pack('<IIII', SHADER_ARCHIVE_MAGIC_NUMBER, SHADER_ARCHIVE_VERSION, len(files), len(nameTable)))
+        archive.write(entries)
+        archive.write(nameTable)
+        archive.write(data)
+
+if len(sys.argv) == 2 + 2 and sys.argv[1] == '--pack':
+    PackShaderArchive(sys.argv[2], sys.argv[3])
+elif len(sys.argv) < 2 + 1:
     print('Usage: <input_shader_file_path> <output_shader_directory_path>')
+    print('       --pack <input_shader_directory_path> <output_shader_archive_file_path>')
 else:
     CompileShader(sys.argv[1], sys.argv[2])
\ No newline at end of file
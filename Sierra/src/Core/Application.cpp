@@ -18,9 +18,9 @@ namespace Sierra
         SR_ERROR_IF(createInfo.name.empty(), "Application title must not be empty!");
 
         // Create objects
-        platformContext = PlatformContext::Create({ });
+        platformContext = PlatformContext::Create({ .headless = createInfo.settings.headless });
         windowManager = WindowManager::Create({ .platformContext = platformContext });
-        renderingContext = RenderingContext::Create({ .name = "Application Context", .graphicsAPI = createInfo.settings.graphicsAPI });
+        renderingContext = RenderingContext::Create({ .name = "Application Context", .graphicsAPI = createInfo.settings.graphicsAPI, .headless = createInfo.settings.headless });
     }
 
     void Application::Run()
@@ -36,6 +36,12 @@ namespace Sierra
                     return true;
                 }
 
+                // Free resources, which were queued for destruction, and are no longer in use by the GPU
+                renderingContext->GetDevice().DestroyQueuedResources();
+
+                // Refresh heap budgets, notifying about ones close to being exceeded
+                renderingContext->GetDevice().UpdateMemoryBudgets();
+
                 // Enforce frame limit if set
                 if (maxFrameRate != 0)
                 {
@@ -16,6 +16,7 @@ namespace Sierra
     {
         uint16 maxFrameRate = SR_PLATFORM_MOBILE * 60;
         GraphicsAPI graphicsAPI = GraphicsAPI::Auto;
+        bool headless = false; // No display is connected to, so windows cannot be created, and rendering has to go through RenderingContext::CreateOffscreenSwapchain()
     };
 
     struct ApplicationCreateInfo
@@ -0,0 +1,18 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "HeadlessContext.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    HeadlessContext::HeadlessContext(const PlatformContextCreateInfo &createInfo)
+        : PlatformContext(createInfo)
+    {
+
+    }
+
+}
@@ -0,0 +1,24 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "../../PlatformContext.h"
+
+namespace Sierra
+{
+
+    // Platform context, which does not connect to any display, and thus cannot create windows
+    class SIERRA_API HeadlessContext final : public PlatformContext
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        explicit HeadlessContext(const PlatformContextCreateInfo &createInfo);
+
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] inline PlatformType GetType() const override { return PlatformType::Headless; }
+
+    };
+
+}
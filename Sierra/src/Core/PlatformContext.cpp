@@ -20,6 +20,7 @@
     #include "Platform/Android/AndroidContext.h"
     typedef Sierra::AndroidContext NativeInstance;
 #endif
+#include "Platform/Headless/HeadlessContext.h"
 
 namespace Sierra
 {
@@ -44,6 +45,7 @@ namespace Sierra
 
     std::unique_ptr<PlatformContext> PlatformContext::Create(const PlatformContextCreateInfo &createInfo)
     {
+        if (createInfo.headless) return std::make_unique<HeadlessContext>(createInfo);
         return std::make_unique<NativeInstance>(createInfo);
     }
 
@@ -13,12 +13,13 @@ namespace Sierra
         Linux,
         macOS,
         Android,
-        iOS
+        iOS,
+        Headless
     };
 
     struct PlatformContextCreateInfo
     {
-
+        bool headless = false;
     };
 
     struct PlatformApplicationRunInfo
@@ -36,6 +36,7 @@ namespace Sierra
 
     std::unique_ptr<Window> WindowManager::CreateWindow(const WindowCreateInfo &createInfo) const
     {
+        SR_ERROR_IF(platformContext->GetType() == PlatformType::Headless, "Cannot create window [{0}] using a headless platform context!", createInfo.title);
         #if SR_PLATFORM_WINDOWS
             SR_ERROR_IF(platformContext->GetType() != PlatformType::Windows, "Cannot create Win32 window using a platform context of type, which differs from [PlatformType::Windows]!");
             return std::make_unique<Win32Window>(static_cast<WindowsContext&>(*platformContext).GetWin32Context(), createInfo);
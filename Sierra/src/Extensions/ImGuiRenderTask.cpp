@@ -67,18 +67,18 @@ namespace Sierra
         sharedResources.vertexShader = renderingContext.CreateShader({ .name = "Shared ImGui Render Task Vertex Shader", .shaderBundlePath = File::GetResourcesDirectoryPath() / "shaders/ImGuiRenderTask.vert.shader",  .shaderType = ShaderType::Vertex });
         sharedResources.fragmentShader = renderingContext.CreateShader({ .name = "Shared ImGui Render Task Fragment Shader", .shaderBundlePath = File::GetResourcesDirectoryPath() / "shaders/ImGuiRenderTask.frag.shader",  .shaderType = ShaderType::Fragment });
 
-        // Create shared pipeline layout
-        sharedResources.pipelineLayout = renderingContext.CreatePipelineLayout({
-            .name = "Shared ImGui Render Task Pipeline Layout",
-            .bindings = { { .type = PipelineBindingType::Texture } },
-            .pushConstantSize = sizeof(PushConstant)
-        });
-
         // Create font sampler
         sharedResources.fontSampler = renderingContext.CreateSampler({
             .name = "Shared ImGui Render Task Font Sampler",
         });
 
+        // Create shared pipeline layout (bindings and push constants are reflected from shaders, and the font sampler is baked in)
+        sharedResources.pipelineLayout = renderingContext.CreatePipelineLayout({
+            .name = "Shared ImGui Render Task Pipeline Layout",
+            .shaders = { sharedResources.vertexShader, sharedResources.fragmentShader },
+            .immutableSamplers = { { .binding = 0, .sampler = sharedResources.fontSampler } }
+        });
+
         // Load font atlas
         int atlasWidth, atlasHeight;
         uchar* atlasMemory = nullptr;
@@ -333,7 +333,7 @@ namespace Sierra
         // Bind resources
         commandBuffer->BindVertexBuffer(vertexBuffer);
         commandBuffer->BindIndexBuffer(indexBuffer);
-        commandBuffer->BindImage(0, sharedResources.defaultFontAtlas, sharedResources.fontSampler);
+        commandBuffer->BindImage(0, sharedResources.defaultFontAtlas);
 
         // Bind perspective settings
         PushConstant pushConstant = { };
@@ -423,7 +423,7 @@ namespace Sierra
 
     void ImGuiRenderTask::Resize(const uint32 width, const uint32 height)
     {
-        framebufferSize = { width, height };
+        framebufferSize = { static_cast<float32>(width) / scaling, static_cast<float32>(height) / scaling };
         renderPass->Resize(width, height);
     }
 
@@ -33,6 +33,7 @@ namespace Sierra
         uint64 memorySize = 0;
         BufferUsage usage = BufferUsage::Undefined;
         BufferMemoryLocation memoryLocation = BufferMemoryLocation::CPU;
+        const std::string &memoryCategory = "Uncategorized";
     };
 
     class SIERRA_API Buffer : public virtual RenderingResource
@@ -9,6 +9,7 @@
 #include "Buffer.h"
 #include "Image.h"
 #include "Sampler.h"
+#include "QueryPool.h"
 
 #include "RenderPass.h"
 #include "GraphicsPipeline.h"
@@ -27,7 +28,8 @@ namespace Sierra
         GraphicsRead,
         GraphicsWrite,
         ComputeRead,
-        ComputeWrite
+        ComputeWrite,
+        HostRead
     };
 
     enum class ImageCommandUsage : uint8
@@ -46,6 +48,30 @@ namespace Sierra
         Present
     };
 
+    enum class IndexBufferType : bool
+    {
+        UInt16,
+        UInt32
+    };
+
+    [[nodiscard]] constexpr static uint32 IndexBufferTypeToMemorySize(const IndexBufferType indexBufferType)
+    {
+        switch (indexBufferType)
+        {
+            case IndexBufferType::UInt16:       return 2;
+            case IndexBufferType::UInt32:       return 4;
+        }
+    }
+
+    struct BufferImageCopyRegion
+    {
+        uint64 sourceByteOffset = 0;
+        uint32 mipLevel = 0;
+        uint32 layer = 0;
+        Vector2UInt pixelRange = { 0, 0 };
+        Vector2UInt destinationPixelOffset = { 0, 0 };
+    };
+
     struct CommandBufferCreateInfo
     {
         const std::string &name = "Command Buffer";
@@ -63,6 +89,8 @@ namespace Sierra
 
         virtual void CopyBufferToBuffer(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Buffer> &destinationBuffer, uint64 memoryRange = 0, uint64 sourceByteOffset = 0, uint64 destinationByteOffset = 0) = 0;
         virtual void CopyBufferToImage(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Image> &destinationImage, uint32 mipLevel = 0, const Vector2UInt &pixelRange = { 0, 0 }, uint32 layer = 0, uint64 sourceByteOffset = 0, const Vector2UInt &destinationPixelOffset = { 0, 0 }) = 0;
+        virtual void CopyBufferToImageRegions(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Image> &destinationImage, const std::vector<BufferImageCopyRegion> &regions) = 0;
+        virtual void CopyImageToBuffer(const std::unique_ptr<Image> &sourceImage, const std::unique_ptr<Buffer> &destinationBuffer, uint32 mipLevel = 0, const Vector2UInt &pixelRange = { 0, 0 }, uint32 layer = 0, const Vector2UInt &sourcePixelOffset = { 0, 0 }, uint64 destinationByteOffset = 0) = 0;
         virtual void GenerateMipMapsForImage(const std::unique_ptr<Image> &image) = 0;
 
         virtual void BeginRenderPass(const std::unique_ptr<RenderPass> &renderPass, const std::initializer_list<RenderPassBeginAttachment> &attachments) = 0;
@@ -72,10 +100,14 @@ namespace Sierra
         virtual void BeginGraphicsPipeline(const std::unique_ptr<GraphicsPipeline> &graphicsPipeline) = 0;
         virtual void EndGraphicsPipeline(const std::unique_ptr<GraphicsPipeline> &graphicsPipeline) = 0;
 
-        virtual void BindVertexBuffer(const std::unique_ptr<Buffer> &vertexBuffer, uint64 byteOffset = 0) = 0;
-        virtual void BindIndexBuffer(const std::unique_ptr<Buffer> &indexBuffer, uint64 byteOffset = 0) = 0;
+        virtual void BindVertexBuffer(const std::unique_ptr<Buffer> &vertexBuffer, uint64 byteOffset = 0, uint32 stream = 0) = 0;
+        virtual void BindIndexBuffer(const std::unique_ptr<Buffer> &indexBuffer, uint64 byteOffset = 0, IndexBufferType indexType = IndexBufferType::UInt32) = 0;
 
         virtual void SetScissor(const Vector4UInt &scissor) = 0;
+        // Override the respective state of the active graphics pipeline (until another one is begun), and require Device::IsExtendedDynamicStateSupported()
+        virtual void SetCullMode(CullMode cullMode) = 0;
+        virtual void SetFrontFaceMode(FrontFaceMode frontFaceMode) = 0;
+        virtual void SetDepthMode(DepthMode depthMode) = 0;
         virtual void Draw(uint32 vertexCount, uint32 vertexOffset = 0) = 0;
         virtual void DrawIndexed(uint32 indexCount, uint32 indexOffset = 0, uint32 vertexOffset = 0) = 0;
 
@@ -86,16 +118,26 @@ namespace Sierra
 
         virtual void PushConstants(const void* data, uint16 memoryRange, uint16 byteOffset = 0) = 0;
         virtual void BindBuffer(uint32 binding, const std::unique_ptr<Buffer> &buffer, uint32 arrayIndex = 0, uint64 memoryRange = 0, uint64 byteOffset = 0) = 0;
-        virtual void BindImage(uint32 binding, const std::unique_ptr<Image> &image, uint32 arrayIndex = 0) = 0;
-        virtual void BindImage(uint32 binding, const std::unique_ptr<Image> &image, const std::unique_ptr<Sampler> &sampler, uint32 arrayIndex = 0) = 0;
+        // Images can be bound partially (e.g. a single mip level or layer), in which case views of the given subresources are created once, and reused on later binds
+        virtual void BindImage(uint32 binding, const std::unique_ptr<Image> &image, uint32 arrayIndex = 0, const ImageSubresourceRange &subresourceRange = { }) = 0; // Sampled with the immutable sampler, if the active pipeline's layout has one at the binding, or bound as a storage image otherwise
+        virtual void BindImage(uint32 binding, const std::unique_ptr<Image> &image, const std::unique_ptr<Sampler> &sampler, uint32 arrayIndex = 0, const ImageSubresourceRange &subresourceRange = { }) = 0;
 
         virtual void BeginDebugRegion(const std::string &regionName, const Color &color = Color(1.0f, 1.0f, 0.0f, 1.0f)) = 0;
         virtual void InsertDebugMarker(const std::string &markerName, const Color &color = Color(1.0f, 1.0f, 0.0f, 1.0f)) = 0;
         virtual void EndDebugRegion() = 0;
 
+        // Queries must be reset outside of render passes before being written to (on Metal, occlusion queries within subsequent render passes also get written to the last reset occlusion query pool)
+        virtual void ResetQueryPool(const std::unique_ptr<QueryPool> &queryPool, uint32 firstQuery = 0, uint32 queryCount = 0) = 0;
+        virtual void BeginQuery(const std::unique_ptr<QueryPool> &queryPool, uint32 query) = 0;
+        virtual void EndQuery(const std::unique_ptr<QueryPool> &queryPool, uint32 query) = 0;
+        virtual void WriteTimestamp(const std::unique_ptr<QueryPool> &queryPool, uint32 query) = 0;
+
         inline std::unique_ptr<Buffer>& QueueBufferForDestruction(std::unique_ptr<Buffer> &&buffer) { return queuedBuffers.emplace(std::move(buffer)); }
         inline std::unique_ptr<Image>& QueueImageForDestruction(std::unique_ptr<Image> &&image) { return queuedImages.emplace(std::move(image)); }
 
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] virtual uint64 GetCompletionSignalValue() const = 0;
+
         /* --- OPERATORS --- */
         CommandBuffer(const CommandBuffer&) = delete;
         CommandBuffer& operator=(const CommandBuffer&) = delete;
@@ -11,7 +11,11 @@ namespace Sierra
 
     ComputePipeline::ComputePipeline(const ComputePipelineCreateInfo &createInfo)
     {
-
+        SR_ERROR_IF(!createInfo.layout->IsCompatibleWith(*createInfo.computeShader), "Cannot create compute pipeline [{0}], as compute shader [{1}] accesses resources, which are not declared for its stage within pipeline layout [{2}]!", createInfo.name, createInfo.computeShader->GetName(), createInfo.layout->GetName());
+        for (auto it = createInfo.shaderConstants.begin(); it != createInfo.shaderConstants.end(); it++)
+        {
+            SR_ERROR_IF(std::find_if(createInfo.shaderConstants.begin(), it, [it](const ShaderConstant &other) { return other.constantID == it->constantID; }) != it, "Cannot create compute pipeline [{0}], as shader constant with an ID of [{1}] has been specified more than once!", createInfo.name, it->constantID);
+        }
     }
 
 }
\ No newline at end of file
@@ -16,6 +16,7 @@ namespace Sierra
     {
         const std::string &name = "Compute Pipeline";
         const std::unique_ptr<Shader> &computeShader;
+        const std::initializer_list<ShaderConstant> &shaderConstants = { };
         const std::unique_ptr<PipelineLayout> &layout;
     };
 
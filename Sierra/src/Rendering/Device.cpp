@@ -14,10 +14,120 @@ namespace Sierra
 
     }
 
+    /* --- POLLING METHODS --- */
+
+    bool Device::WaitForCommandBuffer(const std::unique_ptr<CommandBuffer> &commandBuffer, const uint64 timeoutInNanoseconds) const
+    {
+        return WaitForSignalValue(commandBuffer->GetCompletionSignalValue(), timeoutInNanoseconds);
+    }
+
+    void Device::AddCommandBufferCompletionCallback(const std::unique_ptr<CommandBuffer> &commandBuffer, const std::function<void()> &callback) const
+    {
+        completionCallbacks.push_back({ .signalValue = commandBuffer->GetCompletionSignalValue(), .callback = callback });
+    }
+
+    void Device::ProcessCompletionCallbacks() const
+    {
+        if (completionCallbacks.empty()) return;
+
+        // Query semaphore once, and invoke (in order of addition) every callback, whose command buffer has finished (callbacks are moved out beforehand, as they themselves are allowed to add new ones)
+        const uint64 completedSignalValue = GetCompletedSignalValue();
+        std::vector<CompletionCallback> callbacks = std::exchange(completionCallbacks, { });
+        std::vector<CompletionCallback> pendingCallbacks;
+        for (CompletionCallback &completionCallback : callbacks)
+        {
+            if (completionCallback.signalValue <= completedSignalValue) completionCallback.callback();
+            else pendingCallbacks.push_back(std::move(completionCallback));
+        }
+
+        // Keep unfinished callbacks ahead of any added during the loop
+        completionCallbacks.insert(completionCallbacks.begin(), std::make_move_iterator(pendingCallbacks.begin()), std::make_move_iterator(pendingCallbacks.end()));
+    }
+
+    void Device::QueueHandleForDestruction(const std::function<void()> &Destroy) const
+    {
+        queuedResources.push_back({ .signalValue = GetLastSubmittedSignalValue(), .resource = nullptr, .Destroy = Destroy });
+    }
+
+    void Device::DestroyQueuedResources() const
+    {
+        if (queuedResources.empty()) return;
+
+        // Resources are queued in order of increasing signal values, so all finished ones are at the front and can be freed after a single semaphore query
+        const uint64 completedSignalValue = GetCompletedSignalValue();
+        while (!queuedResources.empty() && queuedResources.front().signalValue <= completedSignalValue)
+        {
+            if (queuedResources.front().Destroy) queuedResources.front().Destroy();
+            queuedResources.pop_front();
+        }
+    }
+
+    void Device::UpdateMemoryBudgets() const
+    {
+        std::vector<MemoryHeapBudget> heapBudgets;
+        QueryMemoryHeapBudgets(heapBudgets);
+        {
+            std::lock_guard lock(memoryMutex);
+            memoryHeapBudgets = heapBudgets;
+        }
+        if (!lowMemoryCallback) return;
+
+        // Notify about every heap, whose usage is getting close to its budget (outside the lock, so the callback is free to query usages)
+        for (uint32 i = 0; i < heapBudgets.size(); i++)
+        {
+            const MemoryHeapBudget &heapBudget = heapBudgets[i];
+            if (heapBudget.budget != 0 && static_cast<float64>(heapBudget.usage) >= static_cast<float64>(heapBudget.budget) * lowMemoryUsageThreshold) lowMemoryCallback(i, heapBudget);
+        }
+    }
+
+    void Device::TrackMemoryAllocation(const std::string &memoryCategory, const uint64 memorySize) const
+    {
+        // Resources may be created and destroyed from multiple threads (e.g. by a shader watcher)
+        std::lock_guard lock(memoryMutex);
+        memoryCategoryUsages[memoryCategory] += memorySize;
+    }
+
+    void Device::UntrackMemoryAllocation(const std::string &memoryCategory, const uint64 memorySize) const
+    {
+        std::lock_guard lock(memoryMutex);
+        auto iterator = memoryCategoryUsages.find(memoryCategory);
+        if (iterator == memoryCategoryUsages.end()) return;
+
+        iterator->second -= std::min(iterator->second, memorySize);
+        if (iterator->second == 0) memoryCategoryUsages.erase(iterator);
+    }
+
     /* -- GETTER METHODS --- */
 
+    std::vector<MemoryHeapBudget> Device::GetMemoryHeapBudgets() const
+    {
+        std::lock_guard lock(memoryMutex);
+        return memoryHeapBudgets;
+    }
+
+    std::unordered_map<std::string, uint64> Device::GetMemoryCategoryUsages() const
+    {
+        std::lock_guard lock(memoryMutex);
+        return memoryCategoryUsages;
+    }
+
+    uint64 Device::GetMemoryCategoryUsage(const std::string &memoryCategory) const
+    {
+        std::lock_guard lock(memoryMutex);
+        const auto iterator = memoryCategoryUsages.find(memoryCategory);
+        return iterator != memoryCategoryUsages.end() ? iterator->second : 0;
+    }
+
+    bool Device::IsCommandBufferComplete(const std::unique_ptr<CommandBuffer> &commandBuffer) const
+    {
+        return GetCompletedSignalValue() >= commandBuffer->GetCompletionSignalValue();
+    }
+
     std::optional<ImageFormat> Device::GetSupportedImageFormat(const ImageFormat preferredFormat, const ImageUsage usage) const
     {
+        // Compressed formats have no equivalents to fall back to, so callers are expected to retry with an uncompressed one
+        if (preferredFormat.compression != ImageCompression::None) return IsImageFormatSupported(preferredFormat, usage) ? std::optional(preferredFormat) : std::nullopt;
+
         // NOTE: Though looking complex and heavy, realistically, the function should return almost immediately, and a format is pretty much guaranteed to be found
         std::vector<ImageChannels> channelsToTry;
         std::vector<ImageMemoryType> memoryTypesToTry;
@@ -237,5 +347,28 @@ namespace Sierra
         return SamplerAnisotropy::x1;
     }
 
+    /* --- SETTER METHODS --- */
+
+    void Device::SetLowMemoryCallback(const LowMemoryCallback &callback, const float32 usageThreshold) const
+    {
+        SR_ERROR_IF(usageThreshold <= 0.0f || usageThreshold > 1.0f, "Cannot set low memory callback of device [{0}] with a usage threshold of [{1}], as it must be within the (0.0, 1.0] range!", GetName(), usageThreshold);
+        lowMemoryCallback = callback;
+        lowMemoryUsageThreshold = usageThreshold;
+    }
+
+    /* --- PROTECTED METHODS --- */
+
+    void Device::DestroyAllQueuedResources() const
+    {
+        if (queuedResources.empty()) return;
+
+        // Must be called by implementations before they tear down the objects queued resources depend on
+        WaitForSignalValue(queuedResources.back().signalValue);
+        for (const QueuedResource &queuedResource : queuedResources)
+        {
+            if (queuedResource.Destroy) queuedResource.Destroy();
+        }
+        queuedResources.clear();
+    }
 
 }
\ No newline at end of file
@@ -19,16 +19,53 @@ namespace Sierra
         const std::string &name = "Device";
     };
 
+    struct MemoryHeapBudget
+    {
+        uint64 usage = 0;
+        uint64 budget = 0;
+        bool deviceLocal = false;
+    };
+
+    using LowMemoryCallback = std::function<void(uint32 heapIndex, const MemoryHeapBudget &heapBudget)>;
+
     class SIERRA_API Device : public virtual RenderingResource
     {
     public:
         /* --- POLLING METHODS --- */
         virtual void SubmitCommandBuffer(std::unique_ptr<CommandBuffer> &commandBuffer,  const std::initializer_list<std::reference_wrapper<std::unique_ptr<CommandBuffer>>> &commandBuffersToWait = { }) const = 0;
-        virtual void WaitForCommandBuffer(const std::unique_ptr<CommandBuffer> &commandBuffer) const = 0;
+        bool WaitForCommandBuffer(const std::unique_ptr<CommandBuffer> &commandBuffer, uint64 timeoutInNanoseconds = std::numeric_limits<uint64>::max()) const;
+        virtual bool WaitForSignalValue(uint64 signalValue, uint64 timeoutInNanoseconds = std::numeric_limits<uint64>::max()) const = 0;
+
+        void AddCommandBufferCompletionCallback(const std::unique_ptr<CommandBuffer> &commandBuffer, const std::function<void()> &callback) const;
+        void ProcessCompletionCallbacks() const;
+
+        template<typename T>
+        void QueueResourceForDestruction(std::unique_ptr<T> &&resource) const
+        {
+            static_assert(std::is_base_of_v<RenderingResource, T>, "Template function accepts rendering resources only!");
+            queuedResources.push_back({ .signalValue = GetLastSubmittedSignalValue(), .resource = std::move(resource) });
+        }
+        void QueueHandleForDestruction(const std::function<void()> &Destroy) const; // For backend handles, which are not owned by a rendering resource (destroyed by the given function)
+        void DestroyQueuedResources() const; // Called by applications once per frame (resources must not be used by command buffers submitted after they were queued)
+
+        void UpdateMemoryBudgets() const; // Called by applications once per frame
+        void TrackMemoryAllocation(const std::string &memoryCategory, uint64 memorySize) const;
+        void UntrackMemoryAllocation(const std::string &memoryCategory, uint64 memorySize) const;
+
+        // Performs a single, budgeted step of memory defragmentation, moving at most the given amount of memory, and returns whether further steps remain (steps never block, and only move memory once every begun command buffer has been submitted, so it is best called once per frame)
+        virtual bool DefragmentMemory(uint64 maxBytesPerStep = 64 * 1024 * 1024, uint32 maxAllocationsPerStep = 64) const = 0;
 
         /* --- GETTER METHODS --- */
         [[nodiscard]] virtual const std::string& GetDeviceName() const = 0;
 
+        [[nodiscard]] virtual uint64 GetCompletedSignalValue() const = 0;
+        [[nodiscard]] virtual uint64 GetLastSubmittedSignalValue() const = 0;
+        [[nodiscard]] bool IsCommandBufferComplete(const std::unique_ptr<CommandBuffer> &commandBuffer) const;
+
+        [[nodiscard]] std::vector<MemoryHeapBudget> GetMemoryHeapBudgets() const;
+        [[nodiscard]] std::unordered_map<std::string, uint64> GetMemoryCategoryUsages() const; // Returns a copy, as resources may be created and destroyed from other threads
+        [[nodiscard]] uint64 GetMemoryCategoryUsage(const std::string &memoryCategory) const;
+
         [[nodiscard]] virtual bool IsImageFormatSupported(ImageFormat format, ImageUsage usage) const = 0;
         [[nodiscard]] std::optional<ImageFormat> GetSupportedImageFormat(ImageFormat preferredFormat, ImageUsage usage) const;
 
@@ -38,6 +75,12 @@ namespace Sierra
         [[nodiscard]] virtual bool IsSamplerAnisotropySupported(SamplerAnisotropy anisotropy) const = 0;
         [[nodiscard]] SamplerAnisotropy GetHighestSamplerAnisotropySupported() const;
 
+        [[nodiscard]] virtual bool IsQueryTypeSupported(QueryType queryType) const = 0;
+        [[nodiscard]] virtual bool IsExtendedDynamicStateSupported() const = 0;
+
+        /* --- SETTER METHODS --- */
+        void SetLowMemoryCallback(const LowMemoryCallback &callback, float32 usageThreshold = 0.9f) const;
+
         /* --- OPERATORS --- */
         Device(const Device&) = delete;
         Device &operator=(const Device&) = delete;
@@ -47,6 +90,30 @@ namespace Sierra
 
     protected:
         explicit Device(const DeviceCreateInfo &createInfo);
+        void DestroyAllQueuedResources() const;
+        virtual void QueryMemoryHeapBudgets(std::vector<MemoryHeapBudget> &heapBudgets) const = 0;
+
+    private:
+        struct CompletionCallback
+        {
+            uint64 signalValue = 0;
+            std::function<void()> callback;
+        };
+        mutable std::vector<CompletionCallback> completionCallbacks;
+
+        struct QueuedResource
+        {
+            uint64 signalValue = 0;
+            std::unique_ptr<RenderingResource> resource;
+            std::function<void()> Destroy;
+        };
+        mutable std::deque<QueuedResource> queuedResources;
+
+        mutable std::vector<MemoryHeapBudget> memoryHeapBudgets;
+        mutable std::unordered_map<std::string, uint64> memoryCategoryUsages;
+        mutable std::mutex memoryMutex;
+        mutable LowMemoryCallback lowMemoryCallback;
+        mutable float32 lowMemoryUsageThreshold = 0.9f;
 
     };
 
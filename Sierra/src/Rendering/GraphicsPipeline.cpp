@@ -11,7 +11,17 @@ namespace Sierra
 
     GraphicsPipeline::GraphicsPipeline(const GraphicsPipelineCreateInfo &createInfo)
     {
-
+        SR_ERROR_IF(!createInfo.layout->IsCompatibleWith(*createInfo.vertexShader), "Cannot create graphics pipeline [{0}], as vertex shader [{1}] accesses resources, which are not declared for its stage within pipeline layout [{2}]!", createInfo.name, createInfo.vertexShader->GetName(), createInfo.layout->GetName());
+        SR_ERROR_IF(createInfo.fragmentShader.has_value() && !createInfo.layout->IsCompatibleWith(*createInfo.fragmentShader->get()), "Cannot create graphics pipeline [{0}], as fragment shader [{1}] accesses resources, which are not declared for its stage within pipeline layout [{2}]!", createInfo.name, createInfo.fragmentShader.has_value() ? createInfo.fragmentShader->get()->GetName() : "", createInfo.layout->GetName());
+        SR_ERROR_IF(createInfo.vertexInputStreams.size() != 0 && createInfo.vertexInputStreams.size() != createInfo.vertexInputs.size(), "Cannot create graphics pipeline [{0}], as the count of specified vertex input streams [{1}] differs from that of vertex inputs [{2}]!", createInfo.name, createInfo.vertexInputStreams.size(), createInfo.vertexInputs.size());
+        for (uint32 i = 0; i < createInfo.vertexInputStreams.size(); i++)
+        {
+            SR_ERROR_IF(*(createInfo.vertexInputStreams.begin() + i) >= MAX_VERTEX_STREAM_COUNT, "Cannot create graphics pipeline [{0}], as vertex input [{1}] is assigned to stream [{2}], which exceeds the maximum of [{3}] vertex streams!", createInfo.name, i, *(createInfo.vertexInputStreams.begin() + i), MAX_VERTEX_STREAM_COUNT);
+        }
+        for (auto it = createInfo.shaderConstants.begin(); it != createInfo.shaderConstants.end(); it++)
+        {
+            SR_ERROR_IF(std::find_if(createInfo.shaderConstants.begin(), it, [it](const ShaderConstant &other) { return other.constantID == it->constantID; }) != it, "Cannot create graphics pipeline [{0}], as shader constant with an ID of [{1}] has been specified more than once!", createInfo.name, it->constantID);
+        }
     }
 
 }
\ No newline at end of file
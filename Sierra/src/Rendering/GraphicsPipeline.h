@@ -79,6 +79,30 @@ namespace Sierra
         Color           = ColorRGBA8
     };
 
+    [[nodiscard]] constexpr static uint32 VertexInputToMemorySize(const VertexInput vertexInput)
+    {
+        const uint8 componentIndex = static_cast<uint8>(vertexInput) % (static_cast<uint8>(VertexInput::Int8_2D));
+        const uint8 componentCount = static_cast<uint8>(vertexInput) / (static_cast<uint8>(VertexInput::Int8_2D)) + 1;
+        switch (static_cast<VertexInput>(componentIndex))
+        {
+            case VertexInput::Int8:
+            case VertexInput::UInt8:
+            case VertexInput::Norm8:
+            case VertexInput::UNorm8:       return componentCount * 1;
+            case VertexInput::Int16:
+            case VertexInput::UInt16:
+            case VertexInput::Norm16:
+            case VertexInput::UNorm16:
+            case VertexInput::Float16:      return componentCount * 2;
+            case VertexInput::Int32:
+            case VertexInput::UInt32:
+            case VertexInput::Float32:      return componentCount * 4;
+            default:                        break;
+        }
+
+        return 0;
+    }
+
     enum class ShadeMode : bool
     {
         Fill,
@@ -115,8 +139,10 @@ namespace Sierra
         const std::string &name = "Graphics Pipeline";
 
         const std::initializer_list<VertexInput> &vertexInputs = { };
+        const std::initializer_list<uint32> &vertexInputStreams = { }; // Index of the vertex stream (buffer binding) each input is read from - if left empty, all inputs are interleaved within stream 0
         const std::unique_ptr<Shader> &vertexShader;
         const std::optional<std::reference_wrapper<const std::unique_ptr<Shader>>> &fragmentShader = std::nullopt;
+        const std::initializer_list<ShaderConstant> &shaderConstants = { }; // Applied to all stages, which declare them
 
         const std::unique_ptr<PipelineLayout> &layout;
         const std::unique_ptr<RenderPass> &templateRenderPass;
@@ -133,6 +159,9 @@ namespace Sierra
     class SIERRA_API GraphicsPipeline : public virtual RenderingResource
     {
     public:
+        /* --- CONSTANTS --- */
+        constexpr static uint32 MAX_VERTEX_STREAM_COUNT = 4;
+
         /* --- OPERATORS --- */
         GraphicsPipeline(const GraphicsPipeline&) = delete;
         GraphicsPipeline &operator=(const GraphicsPipeline&) = delete;
@@ -10,7 +10,7 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     Image::Image(const ImageCreateInfo &createInfo)
-        : width(createInfo.width), height(createInfo.height), format(createInfo.format), mipLevelCount(createInfo.mipLevelCount), layerCount(createInfo.layerCount), sampling(createInfo.sampling)
+        : width(createInfo.width), height(createInfo.height), format(createInfo.format), mipLevelCount(createInfo.mipLevelCount), layerCount(createInfo.layerCount), sampling(createInfo.sampling), usage(createInfo.usage)
     {
         SR_ERROR_IF(createInfo.width == 0 || createInfo.height == 0, "Width and height of image [{0}] must not be [0]!", createInfo.name);
         SR_ERROR_IF(createInfo.layerCount == 0, "Layer count of image [{0}] must not be [0]!", createInfo.name);
@@ -20,6 +20,8 @@ namespace Sierra
         SR_ERROR_IF(createInfo.usage & ImageUsage::ColorAttachment && createInfo.usage & ImageUsage::DepthAttachment, "Usage of image [{0}] must not include both [ImageUsage::ColorAttachment] & [ImageUsage::DepthAttachment]!", createInfo.name);
         SR_ERROR_IF(createInfo.usage & ImageUsage::LinearFilter && !(createInfo.usage & ImageUsage::Sample), "Usage of image [{0}] must also include [ImageUsage::Sampled] if [ImageUsage::Filtered] is present!", createInfo.name);
         SR_ERROR_IF(createInfo.usage & ImageUsage::ResolveAttachment && createInfo.sampling != ImageSampling::x1, "Image [{0}], which includes [ImageUsage::ResolveAttachment] must be created with sampling of [ImageSampling::x1]!", createInfo.name);
+        SR_ERROR_IF(createInfo.usage & ImageUsage::TransientAttachment && (createInfo.usage & ~(ImageUsage::ColorAttachment | ImageUsage::DepthAttachment | ImageUsage::InputAttachment | ImageUsage::TransientAttachment)), "Image [{0}], which includes [ImageUsage::TransientAttachment], must not have any usage other than [ImageUsage::ColorAttachment], [ImageUsage::DepthAttachment] or [ImageUsage::InputAttachment]!", createInfo.name);
+        SR_ERROR_IF(createInfo.format.compression != ImageCompression::None && (createInfo.usage & ImageUsage::Storage || createInfo.usage & ImageUsage::ColorAttachment || createInfo.usage & ImageUsage::DepthAttachment || createInfo.usage & ImageUsage::InputAttachment || createInfo.usage & ImageUsage::ResolveAttachment || createInfo.usage & ImageUsage::TransientAttachment), "Image [{0}], which uses a compressed format, can neither be a storage image, nor an attachment!", createInfo.name);
     }
 
 }
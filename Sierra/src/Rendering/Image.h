@@ -81,12 +81,77 @@ namespace Sierra
         }
     }
 
+    enum class ImageCompression : uint8
+    {
+        None,
+        BC1,            // RGB or RGBA, with UNorm8 or SRGB8
+        BC2,            // RGBA, with UNorm8 or SRGB8
+        BC3,            // RGBA, with UNorm8 or SRGB8
+        BC4,            // R, with UNorm8 or Norm8
+        BC5,            // RG, with UNorm8 or Norm8
+        BC6H,           // RGB, with Float16 (unsigned)
+        BC7,            // RGBA, with UNorm8 or SRGB8
+        ETC2,           // RGB or RGBA, with UNorm8 or SRGB8
+        EAC,            // R or RG, with UNorm8 or Norm8
+        ASTC4x4,        // RGBA, with UNorm8 or SRGB8
+        ASTC6x6,        // RGBA, with UNorm8 or SRGB8
+        ASTC8x8         // RGBA, with UNorm8 or SRGB8
+    };
+
+    [[nodiscard]] constexpr static uint32 ImageCompressionToBlockExtent(const ImageCompression compression)
+    {
+        switch (compression)
+        {
+            case ImageCompression::None:         return 1;
+            case ImageCompression::BC1:
+            case ImageCompression::BC2:
+            case ImageCompression::BC3:
+            case ImageCompression::BC4:
+            case ImageCompression::BC5:
+            case ImageCompression::BC6H:
+            case ImageCompression::BC7:
+            case ImageCompression::ETC2:
+            case ImageCompression::EAC:
+            case ImageCompression::ASTC4x4:      return 4;
+            case ImageCompression::ASTC6x6:      return 6;
+            case ImageCompression::ASTC8x8:      return 8;
+        }
+    }
+
     struct ImageFormat
     {
         ImageChannels channels = ImageChannels::RGBA;
         ImageMemoryType memoryType = ImageMemoryType::UNorm8;
+        ImageCompression compression = ImageCompression::None;
     };
 
+    [[nodiscard]] constexpr static uint32 ImageFormatToBlockMemorySize(const ImageFormat format)
+    {
+        switch (format.compression)
+        {
+            case ImageCompression::None:         return ImageChannelsToCount(format.channels) * ImageMemoryTypeToMemorySize(format.memoryType);
+            case ImageCompression::BC1:
+            case ImageCompression::BC4:          return 8;
+            case ImageCompression::ETC2:         return format.channels == ImageChannels::RGBA ? 16 : 8;
+            case ImageCompression::EAC:          return format.channels == ImageChannels::RG ? 16 : 8;
+            case ImageCompression::BC2:
+            case ImageCompression::BC3:
+            case ImageCompression::BC5:
+            case ImageCompression::BC6H:
+            case ImageCompression::BC7:
+            case ImageCompression::ASTC4x4:
+            case ImageCompression::ASTC6x6:
+            case ImageCompression::ASTC8x8:      return 16;
+        }
+    }
+
+    [[nodiscard]] constexpr static uint64 ImageFormatToRegionMemorySize(const ImageFormat format, const uint32 width, const uint32 height)
+    {
+        // Compressed formats store whole blocks only, so partial ones at the edges are rounded up
+        const uint32 blockExtent = ImageCompressionToBlockExtent(format.compression);
+        return static_cast<uint64>((width + blockExtent - 1) / blockExtent) * ((height + blockExtent - 1) / blockExtent) * ImageFormatToBlockMemorySize(format);
+    }
+
     enum class ImageMemoryLocation : uint8
     {
         Host,
@@ -106,7 +171,7 @@ namespace Sierra
         DepthAttachment         = 0x0040,
         InputAttachment         = 0x0080,
         ResolveAttachment       = 0x0100,
-        TransientAttachment     = 0x0200
+        TransientAttachment     = 0x0200 // Contents only live within a render pass, so the image may be backed by lazily allocated (or memoryless) memory, and must not be used for anything other than attachments
     };
     SR_DEFINE_ENUM_FLAG_OPERATORS(ImageUsage);
 
@@ -137,6 +202,16 @@ namespace Sierra
         ImageMemoryLocation memoryLocation = ImageMemoryLocation::Auto;
         ImageSampling sampling = ImageSampling::x1;
 
+        const std::string &memoryCategory = "Uncategorized";
+
+    };
+
+    struct ImageSubresourceRange
+    {
+        uint32 baseMipLevel = 0;
+        uint32 mipLevelCount = 0; // Zero means all mip levels from the base one onwards
+        uint32 baseLayer = 0;
+        uint32 layerCount = 0; // Zero means all layers from the base one onwards
     };
 
     class SIERRA_API Image : public virtual RenderingResource
@@ -146,13 +221,17 @@ namespace Sierra
         [[nodiscard]] inline uint32 GetWidth() const { return width; }
         [[nodiscard]] inline uint32 GetHeight() const { return height; }
 
-        [[nodiscard]] inline uint64 GetMemorySize() const { return static_cast<uint64>(width) * height * GetPixelMemorySize(); }
+        [[nodiscard]] inline uint64 GetMemorySize() const { return ImageFormatToRegionMemorySize(format, width, height); }
         [[nodiscard]] inline uint32 GetPixelMemorySize() const { return ImageChannelsToCount(format.channels) * ImageMemoryTypeToMemorySize(format.memoryType); }
+        [[nodiscard]] inline uint32 GetBlockMemorySize() const { return ImageFormatToBlockMemorySize(format); }
+        [[nodiscard]] inline uint32 GetBlockExtent() const { return ImageCompressionToBlockExtent(format.compression); }
         [[nodiscard]] inline ImageFormat GetFormat() const { return format; }
+        [[nodiscard]] inline bool IsCompressed() const { return format.compression != ImageCompression::None; }
 
         [[nodiscard]] inline uint32 GetMipLevelCount() const { return mipLevelCount; }
         [[nodiscard]] inline uint32 GetLayerCount() const { return layerCount; }
         [[nodiscard]] inline ImageSampling GetSampling() const { return sampling; };
+        [[nodiscard]] inline ImageUsage GetUsage() const { return usage; }
 
         /* --- OPERATORS --- */
         Image(const Image&) = delete;
@@ -172,6 +251,7 @@ namespace Sierra
         uint32 mipLevelCount = 1;
         uint32 layerCount = 1;
         ImageSampling sampling = ImageSampling::x1;
+        ImageUsage usage = ImageUsage::Undefined;
 
     };
 
@@ -0,0 +1,93 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "OffscreenSwapchain.h"
+
+#include "RenderingContext.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    OffscreenSwapchain::OffscreenSwapchain(const RenderingContext &renderingContext, const OffscreenSwapchainCreateInfo &createInfo)
+        : Swapchain(), device(renderingContext.GetDevice())
+    {
+        #if SR_ENABLE_LOGGING
+            name = createInfo.name;
+        #endif
+        SR_ERROR_IF(createInfo.width == 0 || createInfo.height == 0, "Cannot create offscreen swapchain [{0}] with a width or height of [0]!", createInfo.name);
+        SR_ERROR_IF(createInfo.concurrentFrameCount == 0, "Cannot create offscreen swapchain [{0}] with a concurrent frame count of [0]!", createInfo.name);
+
+        // Images are kept readable, so frames can be copied back to the host
+        images.resize(createInfo.concurrentFrameCount);
+        for (uint32 i = 0; i < createInfo.concurrentFrameCount; i++)
+        {
+            images[i] = renderingContext.CreateImage({
+                .name = "Image " + std::to_string(i) + " of offscreen swapchain [" + createInfo.name + "]",
+                .width = createInfo.width,
+                .height = createInfo.height,
+                .format = SwapchainImageMemoryTypeToImageFormat(createInfo.preferredImageMemoryType),
+                .usage = ImageUsage::ColorAttachment | ImageUsage::SourceMemory | ImageUsage::Sample,
+                .memoryLocation = ImageMemoryLocation::Device,
+                .memoryCategory = "Swapchain"
+            });
+        }
+        imagePresentSignalValues.resize(createInfo.concurrentFrameCount, 0);
+    }
+
+    /* --- POLLING METHODS --- */
+
+    void OffscreenSwapchain::AcquireNextImage()
+    {
+        device.WaitForSignalValue(imagePresentSignalValues[currentFrame]);
+    }
+
+    void OffscreenSwapchain::Present(std::unique_ptr<CommandBuffer> &commandBuffer)
+    {
+        SR_ERROR_IF(commandBuffer->GetAPI() != GetAPI(), "Cannot present offscreen swapchain [{0}] using command buffer [{1}], as their graphics APIs differ!", GetName(), commandBuffer->GetName());
+
+        // Nothing is displayed, so presenting merely marks the image as in use until the command buffer completes
+        imagePresentSignalValues[currentFrame] = commandBuffer->GetCompletionSignalValue();
+        lastPresentedFrame = currentFrame;
+
+        currentFrame = (currentFrame + 1) % GetConcurrentFrameCount();
+    }
+
+    bool OffscreenSwapchain::WaitForPreviousPresent(const uint64 timeoutInNanoseconds) const
+    {
+        return device.WaitForSignalValue(imagePresentSignalValues[lastPresentedFrame], timeoutInNanoseconds);
+    }
+
+    /* --- GETTER METHODS --- */
+
+    const std::unique_ptr<Image>& OffscreenSwapchain::GetImage(const uint32 frameIndex) const
+    {
+        SR_ERROR_IF(frameIndex >= GetConcurrentFrameCount(), "Cannot return image with an index [{0}] of offscreen swapchain [{1}], as index is out of bounds! Use Swapchain::GetConcurrentFrameCount() to query image count.", frameIndex, GetName());
+        return images[frameIndex];
+    }
+
+    /* --- DESTRUCTOR --- */
+
+    OffscreenSwapchain::~OffscreenSwapchain()
+    {
+        // Images must not be destroyed while still being rendered to
+        device.WaitForSignalValue(*std::max_element(imagePresentSignalValues.begin(), imagePresentSignalValues.end()));
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    ImageFormat OffscreenSwapchain::SwapchainImageMemoryTypeToImageFormat(const SwapchainImageMemoryType memoryType)
+    {
+        switch (memoryType)
+        {
+            case SwapchainImageMemoryType::UNorm8:      return { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8 };
+            case SwapchainImageMemoryType::SRGB8:       return { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8 };
+            case SwapchainImageMemoryType::UNorm16:     return { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm16 };
+        }
+
+        return { };
+    }
+
+}
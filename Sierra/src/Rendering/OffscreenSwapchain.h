@@ -0,0 +1,65 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "Swapchain.h"
+
+#include "Device.h"
+#include "Image.h"
+
+namespace Sierra
+{
+
+    class RenderingContext;
+
+    struct OffscreenSwapchainCreateInfo
+    {
+        const std::string &name = "Offscreen Swapchain";
+        uint32 width = 0;
+        uint32 height = 0;
+        uint32 concurrentFrameCount = 3;
+        SwapchainImageMemoryType preferredImageMemoryType = SwapchainImageMemoryType::UNorm8;
+    };
+
+    // Swapchain, which is not bound to a window, and instead cycles through regular images, so frames can be read back (or sampled) after being rendered
+    class SIERRA_API OffscreenSwapchain final : public Swapchain
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        OffscreenSwapchain(const RenderingContext &renderingContext, const OffscreenSwapchainCreateInfo &createInfo);
+
+        /* --- POLLING METHODS --- */
+        // Blocks until the command buffer, which last presented the next image, has finished execution (along with any readbacks recorded within it)
+        void AcquireNextImage() override;
+        void Present(std::unique_ptr<CommandBuffer> &commandBuffer) override;
+        bool WaitForPreviousPresent(uint64 timeoutInNanoseconds = std::numeric_limits<uint64>::max()) const override;
+
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] inline uint32 GetCurrentFrame() const override { return currentFrame; }
+        [[nodiscard]] inline uint32 GetConcurrentFrameCount() const override { return static_cast<uint32>(images.size()); }
+
+        [[nodiscard]] inline const std::unique_ptr<Image>& GetCurrentImage() const override { return images[currentFrame]; }
+        [[nodiscard]] const std::unique_ptr<Image>& GetImage(uint32 frameIndex) const override;
+
+        [[nodiscard]] inline uint32 GetLastPresentedFrame() const { return lastPresentedFrame; }
+        [[nodiscard]] inline GraphicsAPI GetAPI() const override { return images[0]->GetAPI(); }
+
+        /* --- DESTRUCTOR --- */
+        ~OffscreenSwapchain() override;
+
+    private:
+        const Device &device;
+
+        std::vector<std::unique_ptr<Image>> images;
+        std::vector<uint64> imagePresentSignalValues;
+
+        uint32 currentFrame = 0;
+        uint32 lastPresentedFrame = 0;
+
+        [[nodiscard]] static ImageFormat SwapchainImageMemoryTypeToImageFormat(SwapchainImageMemoryType memoryType);
+
+    };
+
+}
@@ -10,6 +10,7 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     PipelineLayout::PipelineLayout(const PipelineLayoutCreateInfo &createInfo)
+        : bindings(createInfo.bindings.begin(), createInfo.bindings.end()), pushConstantSize(createInfo.pushConstantSize), pushConstantStages(createInfo.shaders.size() > 0 ? ShaderStage::None : createInfo.pushConstantStages)
     {
         #if SR_ENABLE_LOGGING
             for (uint32 i = 0; i < createInfo.bindings.size(); i++)
@@ -17,10 +18,69 @@ namespace Sierra
                 const auto iterator = createInfo.bindings.begin() + i;
                 SR_ERROR_IF(iterator->type == PipelineBindingType::Undefined, "Cannot create pipeline layout [{0}], as its [{1}] binding must not be of type PipelineBindingType::Undefined!", createInfo.name, i);
                 SR_ERROR_IF(iterator->arraySize == 0, "Cannot create pipeline layout [{0}], as its [{1}] binding must not have an array size of 0!", createInfo.name, i);
+                SR_ERROR_IF(iterator->stages == ShaderStage::None, "Cannot create pipeline layout [{0}], as its [{1}] binding must be accessible from at least one shader stage!", createInfo.name, i);
             }
         #endif
-        SR_ERROR_IF(createInfo.pushConstantSize > 128, "Cannot create graphics pipeline [{0}] with a push constant size of [{1}], as it exceeds the maximum allowed push constant size of [128] bytes!", createInfo.name, createInfo.pushConstantSize);
-        SR_ERROR_IF(createInfo.pushConstantSize % 4 != 0, "Cannot create graphics pipeline [{0}] with a push constant size of [{1}], as it must be aligned to 4 bytes!", createInfo.name, createInfo.pushConstantSize);
+
+        // Merge reflected resources of every shader
+        for (const std::unique_ptr<Shader> &shader : createInfo.shaders)
+        {
+            const ShaderStage shaderStage = shader->GetShaderStage();
+            for (const ShaderBinding &shaderBinding : shader->GetBindings())
+            {
+                if (shaderBinding.binding >= bindings.size()) bindings.resize(shaderBinding.binding + 1, { .type = PipelineBindingType::Undefined, .stages = ShaderStage::None });
+
+                PipelineBinding &binding = bindings[shaderBinding.binding];
+                if (binding.type == PipelineBindingType::Undefined)
+                {
+                    binding = { .type = shaderBinding.type, .arraySize = shaderBinding.arraySize, .stages = shaderStage };
+                    continue;
+                }
+
+                SR_ERROR_IF(binding.type != shaderBinding.type, "Cannot create pipeline layout [{0}], as binding [{1}] of shader [{2}] is of a type, which differs from the one other shaders or the explicitly specified bindings use!", createInfo.name, shaderBinding.binding, shader->GetName());
+                SR_ERROR_IF(binding.arraySize != shaderBinding.arraySize, "Cannot create pipeline layout [{0}], as binding [{1}] of shader [{2}] has an array size of [{3}], while [{4}] is already used for it!", createInfo.name, shaderBinding.binding, shader->GetName(), shaderBinding.arraySize, binding.arraySize);
+                binding.stages |= shaderStage;
+            }
+
+            if (shader->GetPushConstantSize() > 0)
+            {
+                pushConstantSize = std::max(pushConstantSize, shader->GetPushConstantSize());
+                pushConstantStages |= shaderStage;
+            }
+        }
+
+        // Explicitly requested push constants, which no shader was found to access, keep their specified stages
+        if (pushConstantSize > 0 && pushConstantStages == ShaderStage::None) pushConstantStages = createInfo.pushConstantStages;
+
+        // Mark bindings, whose samplers are baked into the layout
+        immutableSamplerBindings.resize(bindings.size(), false);
+        for (const PipelineImmutableSampler &immutableSampler : createInfo.immutableSamplers)
+        {
+            SR_ERROR_IF(immutableSampler.binding >= bindings.size() || bindings[immutableSampler.binding].type != PipelineBindingType::Texture, "Cannot create pipeline layout [{0}] with immutable sampler [{1}] at binding [{2}], as it is not of type PipelineBindingType::Texture!", createInfo.name, immutableSampler.sampler->GetName(), immutableSampler.binding);
+            SR_ERROR_IF(immutableSamplerBindings[immutableSampler.binding], "Cannot create pipeline layout [{0}] with more than one immutable sampler at binding [{1}]!", createInfo.name, immutableSampler.binding);
+            immutableSamplerBindings[immutableSampler.binding] = true;
+        }
+
+        SR_ERROR_IF(pushConstantSize > 128, "Cannot create pipeline layout [{0}] with a push constant size of [{1}], as it exceeds the maximum allowed push constant size of [128] bytes!", createInfo.name, pushConstantSize);
+        SR_ERROR_IF(pushConstantSize % 4 != 0, "Cannot create pipeline layout [{0}] with a push constant size of [{1}], as it must be aligned to 4 bytes!", createInfo.name, pushConstantSize);
+        SR_ERROR_IF(pushConstantSize > 0 && pushConstantStages == ShaderStage::None, "Cannot create pipeline layout [{0}], as its push constants must be accessible from at least one shader stage!", createInfo.name);
+    }
+
+    /* --- GETTER METHODS --- */
+
+    bool PipelineLayout::IsCompatibleWith(const Shader &shader) const
+    {
+        const ShaderStage shaderStage = shader.GetShaderStage();
+        for (const ShaderBinding &shaderBinding : shader.GetBindings())
+        {
+            if (shaderBinding.binding >= bindings.size()) return false;
+
+            const PipelineBinding &binding = bindings[shaderBinding.binding];
+            if (binding.type != shaderBinding.type || binding.arraySize < shaderBinding.arraySize || !(binding.stages & shaderStage)) return false;
+        }
+
+        if (shader.GetPushConstantSize() > 0 && (shader.GetPushConstantSize() > pushConstantSize || !(pushConstantStages & shaderStage))) return false;
+        return true;
     }
 
-}
\ No newline at end of file
+}
@@ -6,6 +6,9 @@
 
 #include "RenderingResource.h"
 
+#include "Shader.h"
+#include "Sampler.h"
+
 namespace Sierra
 {
 
@@ -23,6 +26,13 @@ namespace Sierra
     {
         PipelineBindingType type = PipelineBindingType::Undefined;
         uint32 arraySize = 1;
+        ShaderStage stages = ShaderStage::All;
+    };
+
+    struct PipelineImmutableSampler
+    {
+        uint32 binding = 0;
+        const std::unique_ptr<Sampler> &sampler;
     };
 
     struct PipelineLayoutCreateInfo
@@ -30,11 +40,21 @@ namespace Sierra
         const std::string &name = "Pipeline Layout";
         const std::initializer_list<PipelineBinding> &bindings = { };
         uint16 pushConstantSize = 0;
+        ShaderStage pushConstantStages = ShaderStage::All;
+        const std::initializer_list<std::reference_wrapper<const std::unique_ptr<Shader>>> &shaders = { }; // Bindings and push constants, reflected from these, are merged into the explicitly specified ones, with stages narrowed down to those, which actually access them
+        const std::initializer_list<PipelineImmutableSampler> &immutableSamplers = { }; // Samplers baked into PipelineBindingType::Texture bindings, which then get bound images without passing a sampler (sampler need not outlive the layout)
     };
 
     class SIERRA_API PipelineLayout : public virtual RenderingResource
     {
     public:
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] inline const std::vector<PipelineBinding>& GetBindings() const { return bindings; } // Reflected layouts may leave binding indices unused, in which case their type is PipelineBindingType::Undefined
+        [[nodiscard]] inline uint16 GetPushConstantSize() const { return pushConstantSize; }
+        [[nodiscard]] inline ShaderStage GetPushConstantStages() const { return pushConstantStages; }
+        [[nodiscard]] inline bool HasImmutableSampler(const uint32 binding) const { return binding < immutableSamplerBindings.size() && immutableSamplerBindings[binding]; }
+        [[nodiscard]] bool IsCompatibleWith(const Shader &shader) const; // Whether every resource the shader accesses is declared, with a matching type, for its stage
+
         /* --- OPERATORS --- */
         PipelineLayout(const PipelineLayout&) = delete;
         PipelineLayout &operator=(const PipelineLayout&) = delete;
@@ -45,6 +65,12 @@ namespace Sierra
     protected:
         explicit PipelineLayout(const PipelineLayoutCreateInfo &createInfo);
 
+    private:
+        std::vector<PipelineBinding> bindings;
+        uint16 pushConstantSize = 0;
+        ShaderStage pushConstantStages = ShaderStage::None;
+        std::vector<bool> immutableSamplerBindings;
+
     };
 
 }
@@ -34,8 +34,12 @@ namespace Sierra
         static MTLResourceOptions BufferMemoryLocationToResourceOptions(BufferMemoryLocation memoryLocation);
 
     private:
+        const MetalDevice &device;
         id<MTLBuffer> buffer = nil;
 
+        std::string memoryCategory;
+        uint64 allocatedMemorySize = 0;
+
     };
 
 }
@@ -10,13 +10,17 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     MetalBuffer::MetalBuffer(const MetalDevice &device, const BufferCreateInfo &createInfo)
-        : Buffer(createInfo), MetalResource(createInfo.name)
+        : Buffer(createInfo), MetalResource(createInfo.name), device(device), memoryCategory(createInfo.memoryCategory)
     {
         // Create buffer
         buffer = [device.GetMetalDevice() newBufferWithLength: createInfo.memorySize options: BufferMemoryLocationToResourceOptions(createInfo.memoryLocation)];
         SR_ERROR_IF(buffer == nil, "[Metal]: Failed to create buffer [{0}]!", GetName());
         device.SetResourceName(buffer, GetName());
 
+        // Account for allocated memory
+        allocatedMemorySize = [buffer allocatedSize];
+        device.TrackMemoryAllocation(memoryCategory, allocatedMemorySize);
+
         // Map and reset memory if CPU-visible
         if (createInfo.memoryLocation == BufferMemoryLocation::CPU) std::memset([buffer contents], 0, createInfo.memorySize);
     }
@@ -34,6 +38,7 @@ namespace Sierra
 
     MetalBuffer::~MetalBuffer()
     {
+        device.UntrackMemoryAllocation(memoryCategory, allocatedMemorySize);
         [buffer release];
     }
 
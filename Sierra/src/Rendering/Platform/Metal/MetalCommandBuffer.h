@@ -10,6 +10,7 @@
 #include "MetalDevice.h"
 #include "MetalGraphicsPipeline.h"
 #include "MetalComputePipeline.h"
+#include "MetalQueryPool.h"
 
 namespace Sierra
 {
@@ -29,6 +30,8 @@ namespace Sierra
 
         void CopyBufferToBuffer(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Buffer> &destinationBuffer, uint64 memoryRange = 0, uint64 sourceByteOffset = 0, uint64 destinationByteOffset = 0) override;
         void CopyBufferToImage(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Image> &destinationImage, const uint32 mipLevel, const Vector2UInt &pixelRange = { 0, 0 }, uint32 layer = 0, uint64 sourceByteOffset = 0, const Vector2UInt &destinationPixelOffset = { 0, 0 }) override;
+        void CopyBufferToImageRegions(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Image> &destinationImage, const std::vector<BufferImageCopyRegion> &regions) override;
+        void CopyImageToBuffer(const std::unique_ptr<Image> &sourceImage, const std::unique_ptr<Buffer> &destinationBuffer, uint32 mipLevel = 0, const Vector2UInt &pixelRange = { 0, 0 }, uint32 layer = 0, const Vector2UInt &sourcePixelOffset = { 0, 0 }, uint64 destinationByteOffset = 0) override;
         void GenerateMipMapsForImage(const std::unique_ptr<Image> &image) override;
 
         void BeginRenderPass(const std::unique_ptr<RenderPass> &renderPass, const std::initializer_list<RenderPassBeginAttachment> &attachments) override;
@@ -38,10 +41,13 @@ namespace Sierra
         void BeginGraphicsPipeline(const std::unique_ptr<GraphicsPipeline> &pipeline) override;
         void EndGraphicsPipeline(const std::unique_ptr<GraphicsPipeline> &pipeline) override;
 
-        void BindVertexBuffer(const std::unique_ptr<Buffer> &vertexBuffer, uint64 byteOffset = 0) override;
-        void BindIndexBuffer(const std::unique_ptr<Buffer> &indexBuffer, uint64 byteOffset = 0) override;
+        void BindVertexBuffer(const std::unique_ptr<Buffer> &vertexBuffer, uint64 byteOffset = 0, uint32 stream = 0) override;
+        void BindIndexBuffer(const std::unique_ptr<Buffer> &indexBuffer, uint64 byteOffset = 0, IndexBufferType indexType = IndexBufferType::UInt32) override;
 
         void SetScissor(const Vector4UInt &scissor) override;
+        void SetCullMode(CullMode cullMode) override;
+        void SetFrontFaceMode(FrontFaceMode frontFaceMode) override;
+        void SetDepthMode(DepthMode depthMode) override;
         void Draw(uint32 vertexCount, uint32 vertexOffset = 0) override;
         void DrawIndexed(uint32 indexCount, uint32 indexOffset = 0, uint32 vertexOffset = 0) override;
 
@@ -52,18 +58,24 @@ namespace Sierra
 
         void PushConstants(const void* data, uint16 memoryRange, uint16 byteOffset = 0) override;
         void BindBuffer(uint32 binding, const std::unique_ptr<Buffer> &buffer, uint32 arrayIndex = 0, uint64 memoryRange = 0, uint64 byteOffset = 0) override;
-        void BindImage(uint32 binding, const std::unique_ptr<Image> &image, uint32 arrayIndex = 0) override;
-        void BindImage(uint32 binding, const std::unique_ptr<Image> &image, const std::unique_ptr<Sampler> &sampler, uint32 arrayIndex = 0) override;
+        void BindImage(uint32 binding, const std::unique_ptr<Image> &image, uint32 arrayIndex = 0, const ImageSubresourceRange &subresourceRange = { }) override;
+        void BindImage(uint32 binding, const std::unique_ptr<Image> &image, const std::unique_ptr<Sampler> &sampler, uint32 arrayIndex = 0, const ImageSubresourceRange &subresourceRange = { }) override;
 
         void BeginDebugRegion(const std::string &regionName, const Color &color = Color(1.0f, 1.0f, 0.0f, 1.0f)) override;
         void InsertDebugMarker(const std::string &markerName, const Color &color = Color(1.0f, 1.0f, 0.0f, 1.0f)) override;
         void EndDebugRegion() override;
 
+        void ResetQueryPool(const std::unique_ptr<QueryPool> &queryPool, uint32 firstQuery = 0, uint32 queryCount = 0) override;
+        void BeginQuery(const std::unique_ptr<QueryPool> &queryPool, uint32 query) override;
+        void EndQuery(const std::unique_ptr<QueryPool> &queryPool, uint32 query) override;
+        void WriteTimestamp(const std::unique_ptr<QueryPool> &queryPool, uint32 query) override;
+
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline id<MTLCommandBuffer> GetMetalCommandBuffer() const { return commandBuffer; }
-        [[nodiscard]] inline uint64 GetCompletionSignalValue() const { return completionSignalValue; }
+        [[nodiscard]] inline uint64 GetCompletionSignalValue() const override { return completionSignalValue; }
 
         /* --- CONVERSIONS --- */
+        [[nodiscard]] static MTLIndexType IndexBufferTypeToIndexType(IndexBufferType indexType);
         [[nodiscard]] static MTLRenderStages BufferCommandUsageToRenderStages(BufferCommandUsage bufferCommandUsage);
         [[nodiscard]] static MTLRenderStages ImageCommandUsageToRenderStages(ImageCommandUsage imageCommandUsage);
 
@@ -86,7 +98,13 @@ namespace Sierra
 
         id<MTLBuffer> currentIndexBuffer = nil;
         uint64 currentIndexBufferByteOffset = 0;
-        uint64 currentVertexBufferByteOffset = 0;
+        IndexBufferType currentIndexBufferType = IndexBufferType::UInt32;
+        std::array<uint64, GraphicsPipeline::MAX_VERTEX_STREAM_COUNT> currentVertexBufferByteOffsets = { };
+
+        const MetalQueryPool* currentOcclusionQueryPool = nullptr;
+
+        void ApplyVertexOffset(uint32 vertexOffset);
+        void SampleCounters(id<MTLCounterSampleBuffer> counterSampleBuffer, uint32 sampleIndex);
 
     };
 
@@ -66,7 +66,9 @@ namespace Sierra
 
         currentIndexBuffer = nil;
         currentIndexBufferByteOffset = 0;
-        currentVertexBufferByteOffset = 0;
+        currentIndexBufferType = IndexBufferType::UInt32;
+        currentVertexBufferByteOffsets = { };
+        currentOcclusionQueryPool = nullptr;
     }
 
     void MetalCommandBuffer::SynchronizeBufferUsage(const std::unique_ptr<Buffer> &buffer, const BufferCommandUsage previousUsage, const BufferCommandUsage nextUsage, const uint64 memorySize, const uint64 byteOffset)
@@ -118,6 +120,11 @@ namespace Sierra
     }
 
     void MetalCommandBuffer::CopyBufferToImage(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Image> &destinationImage, const uint32 mipLevel, const Vector2UInt &pixelRange, const uint32 layer, const  uint64 sourceByteOffset, const Vector2UInt &destinationPixelOffset)
+    {
+        CopyBufferToImageRegions(sourceBuffer, destinationImage, { { .sourceByteOffset = sourceByteOffset, .mipLevel = mipLevel, .layer = layer, .pixelRange = pixelRange, .destinationPixelOffset = destinationPixelOffset } });
+    }
+
+    void MetalCommandBuffer::CopyBufferToImageRegions(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Image> &destinationImage, const std::vector<BufferImageCopyRegion> &regions)
     {
         SR_ERROR_IF(sourceBuffer->GetAPI() != GraphicsAPI::Metal, "[Metal]: Could not copy from buffer [{0}], whose graphics API differs from [GraphicsAPI::Metal], to image [{1}] within command buffer [{2}]!", sourceBuffer->GetName(), destinationImage->GetName(), GetName());
         const MetalBuffer &metalSourceBuffer = static_cast<MetalBuffer&>(*sourceBuffer);
@@ -125,12 +132,62 @@ namespace Sierra
         SR_ERROR_IF(destinationImage->GetAPI() != GraphicsAPI::Metal, "[Metal]: Could not from buffer [{0}] to image [{1}], graphics API differs from [GraphicsAPI::Metal], within command buffer [{2}]!", sourceBuffer->GetName(), destinationImage->GetName(), GetName());
         const MetalImage &metalDestinationImage = static_cast<MetalImage&>(*destinationImage);
 
-        SR_ERROR_IF(mipLevel >= destinationImage->GetMipLevelCount(), "[Metal]: Cannot copy from buffer [{0}] to mip level [{1}] of image [{2}] within command buffer [{3}], as image does not contain it!", sourceBuffer->GetName(), mipLevel, destinationImage->GetName(), GetName());
-        SR_ERROR_IF(layer >= destinationImage->GetLayerCount(), "[Metal]: Cannot copy from buffer [{0}] to layer [{1}] of image [{2}] within command buffer [{3}], as image does not contain it!", sourceBuffer->GetName(), layer, destinationImage->GetName(), GetName());
+        SR_ERROR_IF(regions.empty(), "[Metal]: Cannot copy from buffer [{0}] to image [{1}] within command buffer [{2}], as no copy regions were specified!", sourceBuffer->GetName(), destinationImage->GetName(), GetName());
+        const uint32 blockExtent = destinationImage->GetBlockExtent();
 
-        const MTLSize sourceSize = MTLSizeMake(pixelRange.x != 0 ? pixelRange.x : destinationImage->GetWidth() >> mipLevel, pixelRange.y != 0 ? pixelRange.y : destinationImage->GetHeight() >> mipLevel, 1);
-        SR_ERROR_IF(destinationPixelOffset.x + sourceSize.width > destinationImage->GetWidth() || destinationPixelOffset.y + sourceSize.height > destinationImage->GetHeight(), "[Metal]: Cannot copy from buffer [{0}] pixel range [{1}x{2}], which is offset by another [{3}x{4}] pixels to image [{5}] within command buffer [{6}], as resulting pixel range of a total of [{7}x{8}] pixels exceeds the image's dimensions - [{9}x{10}]!", sourceBuffer->GetName(), sourceSize.width, sourceSize.height, destinationPixelOffset.x, destinationPixelOffset.y, destinationImage->GetName(), GetName(), destinationPixelOffset.x + sourceSize.width, destinationPixelOffset.y + sourceSize.height, destinationImage->GetWidth(), destinationImage->GetHeight());
-        SR_ERROR_IF(sourceByteOffset + static_cast<uint64>(sourceSize.width) * sourceSize.height * destinationImage->GetPixelMemorySize() > sourceBuffer->GetMemorySize(), "[Metal]: Cannot copy from buffer [{0}] pixel range [{1}x{2}], which is offset by another [{3}] bytes, to image [{4}], as total memory range [{5}] overflows that of the buffer - [{6}]!", sourceBuffer->GetName(), sourceSize.width, sourceSize.height, sourceByteOffset, destinationImage->GetName(), sourceByteOffset + sourceSize.width * sourceSize.height * destinationImage->GetPixelMemorySize(), sourceBuffer->GetMemorySize());
+        if (currentBlitEncoder == nil)
+        {
+            currentBlitEncoder = [commandBuffer blitCommandEncoder];
+            device.SetResourceName(currentBlitEncoder , "Transfer Encoder");
+        }
+
+        // Metal has no multi-region buffer-to-texture copy, so regions are instead encoded back-to-back within the same blit encoder
+        for (const BufferImageCopyRegion &region : regions)
+        {
+            SR_ERROR_IF(region.mipLevel >= destinationImage->GetMipLevelCount(), "[Metal]: Cannot copy from buffer [{0}] to mip level [{1}] of image [{2}] within command buffer [{3}], as image does not contain it!", sourceBuffer->GetName(), region.mipLevel, destinationImage->GetName(), GetName());
+            SR_ERROR_IF(region.layer >= destinationImage->GetLayerCount(), "[Metal]: Cannot copy from buffer [{0}] to layer [{1}] of image [{2}] within command buffer [{3}], as image does not contain it!", sourceBuffer->GetName(), region.layer, destinationImage->GetName(), GetName());
+
+            // Determine copied extent (compressed images are copied in whole blocks, so the region must be block-aligned, unless it reaches the edge of the mip level)
+            const Vector2UInt mipLevelExtent = { std::max(destinationImage->GetWidth() >> region.mipLevel, 1U), std::max(destinationImage->GetHeight() >> region.mipLevel, 1U) };
+            const MTLSize sourceSize = MTLSizeMake(region.pixelRange.x != 0 ? region.pixelRange.x : mipLevelExtent.x, region.pixelRange.y != 0 ? region.pixelRange.y : mipLevelExtent.y, 1);
+            const Vector2UInt &destinationPixelOffset = region.destinationPixelOffset;
+
+            SR_ERROR_IF(destinationPixelOffset.x + sourceSize.width > mipLevelExtent.x || destinationPixelOffset.y + sourceSize.height > mipLevelExtent.y, "[Metal]: Cannot copy from buffer [{0}] pixel range [{1}x{2}], which is offset by another [{3}x{4}] pixels to image [{5}] within command buffer [{6}], as resulting pixel range of a total of [{7}x{8}] pixels exceeds the dimensions of mip level [{9}] - [{10}x{11}]!", sourceBuffer->GetName(), sourceSize.width, sourceSize.height, destinationPixelOffset.x, destinationPixelOffset.y, destinationImage->GetName(), GetName(), destinationPixelOffset.x + sourceSize.width, destinationPixelOffset.y + sourceSize.height, region.mipLevel, mipLevelExtent.x, mipLevelExtent.y);
+            SR_ERROR_IF(destinationPixelOffset.x % blockExtent != 0 || destinationPixelOffset.y % blockExtent != 0 || (sourceSize.width % blockExtent != 0 && destinationPixelOffset.x + sourceSize.width != mipLevelExtent.x) || (sourceSize.height % blockExtent != 0 && destinationPixelOffset.y + sourceSize.height != mipLevelExtent.y), "[Metal]: Cannot copy from buffer [{0}] pixel range [{1}x{2}], which is offset by another [{3}x{4}] pixels, to image [{5}] within command buffer [{6}], as it is not aligned to the image's compression block extent of [{7}x{7}]!", sourceBuffer->GetName(), sourceSize.width, sourceSize.height, destinationPixelOffset.x, destinationPixelOffset.y, destinationImage->GetName(), GetName(), blockExtent);
+
+            const uint64 copyMemorySize = ImageFormatToRegionMemorySize(destinationImage->GetFormat(), sourceSize.width, sourceSize.height);
+            SR_ERROR_IF(region.sourceByteOffset + copyMemorySize > sourceBuffer->GetMemorySize(), "[Metal]: Cannot copy from buffer [{0}] pixel range [{1}x{2}], which is offset by another [{3}] bytes, to image [{4}], as total memory range [{5}] overflows that of the buffer - [{6}]!", sourceBuffer->GetName(), sourceSize.width, sourceSize.height, region.sourceByteOffset, destinationImage->GetName(), region.sourceByteOffset + copyMemorySize, sourceBuffer->GetMemorySize());
+
+            // Rows of compressed images are made of blocks, rather than pixels
+            const NSUInteger sourceBytesPerRow = (sourceSize.width + blockExtent - 1) / blockExtent * destinationImage->GetBlockMemorySize();
+            [currentBlitEncoder copyFromBuffer: metalSourceBuffer.GetMetalBuffer() sourceOffset: region.sourceByteOffset sourceBytesPerRow: sourceBytesPerRow sourceBytesPerImage: 0 sourceSize: sourceSize toTexture: metalDestinationImage.GetMetalTexture() destinationSlice: region.layer destinationLevel: region.mipLevel destinationOrigin: MTLOriginMake(destinationPixelOffset.x, destinationPixelOffset.y, 0)];
+        }
+    }
+
+    void MetalCommandBuffer::CopyImageToBuffer(const std::unique_ptr<Image> &sourceImage, const std::unique_ptr<Buffer> &destinationBuffer, const uint32 mipLevel, const Vector2UInt &pixelRange, const uint32 layer, const Vector2UInt &sourcePixelOffset, const uint64 destinationByteOffset)
+    {
+        SR_ERROR_IF(sourceImage->GetAPI() != GraphicsAPI::Metal, "[Metal]: Could not copy from image [{0}], whose graphics API differs from [GraphicsAPI::Metal], to buffer [{1}] within command buffer [{2}]!", sourceImage->GetName(), destinationBuffer->GetName(), GetName());
+        const MetalImage &metalSourceImage = static_cast<MetalImage&>(*sourceImage);
+
+        SR_ERROR_IF(destinationBuffer->GetAPI() != GraphicsAPI::Metal, "[Metal]: Could not copy from image [{0}] to buffer [{1}], whose graphics API differs from [GraphicsAPI::Metal], within command buffer [{2}]!", sourceImage->GetName(), destinationBuffer->GetName(), GetName());
+        const MetalBuffer &metalDestinationBuffer = static_cast<MetalBuffer&>(*destinationBuffer);
+
+        SR_ERROR_IF(mipLevel >= sourceImage->GetMipLevelCount(), "[Metal]: Cannot copy from mip level [{0}] of image [{1}] to buffer [{2}] within command buffer [{3}], as image does not contain it!", mipLevel, sourceImage->GetName(), destinationBuffer->GetName(), GetName());
+        SR_ERROR_IF(layer >= sourceImage->GetLayerCount(), "[Metal]: Cannot copy from layer [{0}] of image [{1}] to buffer [{2}] within command buffer [{3}], as image does not contain it!", layer, sourceImage->GetName(), destinationBuffer->GetName(), GetName());
+
+        // Determine copied extent (compressed images are copied in whole blocks, so the region must be block-aligned, unless it reaches the edge of the mip level)
+        const Vector2UInt mipLevelExtent = { std::max(sourceImage->GetWidth() >> mipLevel, 1U), std::max(sourceImage->GetHeight() >> mipLevel, 1U) };
+        const MTLSize sourceSize = MTLSizeMake(pixelRange.x != 0 ? pixelRange.x : mipLevelExtent.x, pixelRange.y != 0 ? pixelRange.y : mipLevelExtent.y, 1);
+        const uint32 blockExtent = sourceImage->GetBlockExtent();
+
+        SR_ERROR_IF(sourcePixelOffset.x + sourceSize.width > mipLevelExtent.x || sourcePixelOffset.y + sourceSize.height > mipLevelExtent.y, "[Metal]: Cannot copy pixel range [{0}x{1}], which is offset by another [{2}x{3}] pixels, from image [{4}] to buffer [{5}] within command buffer [{6}], as resulting pixel range of a total of [{7}x{8}] pixels exceeds the dimensions of mip level [{9}] - [{10}x{11}]!", sourceSize.width, sourceSize.height, sourcePixelOffset.x, sourcePixelOffset.y, sourceImage->GetName(), destinationBuffer->GetName(), GetName(), sourcePixelOffset.x + sourceSize.width, sourcePixelOffset.y + sourceSize.height, mipLevel, mipLevelExtent.x, mipLevelExtent.y);
+        SR_ERROR_IF(sourcePixelOffset.x % blockExtent != 0 || sourcePixelOffset.y % blockExtent != 0 || (sourceSize.width % blockExtent != 0 && sourcePixelOffset.x + sourceSize.width != mipLevelExtent.x) || (sourceSize.height % blockExtent != 0 && sourcePixelOffset.y + sourceSize.height != mipLevelExtent.y), "[Metal]: Cannot copy pixel range [{0}x{1}], which is offset by another [{2}x{3}] pixels, from image [{4}] to buffer [{5}] within command buffer [{6}], as it is not aligned to the image's compression block extent of [{7}x{7}]!", sourceSize.width, sourceSize.height, sourcePixelOffset.x, sourcePixelOffset.y, sourceImage->GetName(), destinationBuffer->GetName(), GetName(), blockExtent);
+
+        const uint64 copyMemorySize = ImageFormatToRegionMemorySize(sourceImage->GetFormat(), sourceSize.width, sourceSize.height);
+        SR_ERROR_IF(destinationByteOffset + copyMemorySize > destinationBuffer->GetMemorySize(), "[Metal]: Cannot copy pixel range [{0}x{1}] from image [{2}] to buffer [{3}], at byte offset [{4}], within command buffer [{5}], as total memory range [{6}] overflows that of the buffer - [{7}]!", sourceSize.width, sourceSize.height, sourceImage->GetName(), destinationBuffer->GetName(), destinationByteOffset, GetName(), destinationByteOffset + copyMemorySize, destinationBuffer->GetMemorySize());
+
+        // Rows of compressed images are made of blocks, rather than pixels
+        const NSUInteger destinationBytesPerRow = (sourceSize.width + blockExtent - 1) / blockExtent * sourceImage->GetBlockMemorySize();
 
         if (currentBlitEncoder == nil)
         {
@@ -138,13 +195,14 @@ namespace Sierra
             device.SetResourceName(currentBlitEncoder , "Transfer Encoder");
         }
 
-        [currentBlitEncoder copyFromBuffer: metalSourceBuffer.GetMetalBuffer() sourceOffset: sourceByteOffset sourceBytesPerRow: sourceSize.width * destinationImage->GetPixelMemorySize() sourceBytesPerImage: 0 sourceSize: sourceSize toTexture: metalDestinationImage.GetMetalTexture() destinationSlice: layer destinationLevel: mipLevel destinationOrigin: MTLOriginMake(destinationPixelOffset.x, destinationPixelOffset.y, 0)];
+        [currentBlitEncoder copyFromTexture: metalSourceImage.GetMetalTexture() sourceSlice: layer sourceLevel: mipLevel sourceOrigin: MTLOriginMake(sourcePixelOffset.x, sourcePixelOffset.y, 0) sourceSize: sourceSize toBuffer: metalDestinationBuffer.GetMetalBuffer() destinationOffset: destinationByteOffset destinationBytesPerRow: destinationBytesPerRow destinationBytesPerImage: 0];
     }
 
     void MetalCommandBuffer::GenerateMipMapsForImage(const std::unique_ptr<Image> &image)
     {
         SR_ERROR_IF(image->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot generate mip maps for image [{0}], whose graphics API differs from [GraphicsAPI::Metal], within command buffer [{1}]!", image->GetName(), GetName());
         SR_ERROR_IF(image->GetMipLevelCount() <= 1, "[Metal]: Cannot generate mip maps for image [{0}], as it has a single mip level only!", image->GetName());
+        SR_ERROR_IF(image->IsCompressed(), "[Metal]: Cannot generate mip maps for image [{0}], as it uses a compressed format, whose mip levels must be precomputed!", image->GetName());
 
         if (currentBlitEncoder == nil)
         {
@@ -208,6 +266,19 @@ namespace Sierra
         SR_ERROR_IF(renderPass->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot begin next subpass of render pass [{0}], whose graphics API differs from [GraphicsAPI::Metal], from command buffer [{1}]!", renderPass->GetName(), GetName());
         const MetalRenderPass &metalRenderPass = static_cast<MetalRenderPass&>(*renderPass);
 
+        // Transfers must have been encoded before a render encoder can be created
+        if (currentBlitEncoder != nil)
+        {
+            [currentBlitEncoder endEncoding];
+            #if SR_PLATFORM_macOS
+                [currentBlitEncoder release];
+            #endif
+            currentBlitEncoder = nil;
+        }
+
+        // Write occlusion queries to the last reset occlusion query pool
+        [metalRenderPass.GetSubpass(currentSubpass) setVisibilityResultBuffer: currentOcclusionQueryPool != nullptr ? currentOcclusionQueryPool->GetVisibilityResultBuffer() : nil];
+
         // Begin encoding next subpass
         currentRenderEncoder = [commandBuffer renderCommandEncoderWithDescriptor: metalRenderPass.GetSubpass(currentSubpass)];
         device.SetResourceName(currentComputeEncoder, "Render encoder for render pass [" + renderPass->GetName() + "]");
@@ -278,7 +349,7 @@ namespace Sierra
         currentGraphicsPipeline = nil;
     }
 
-    void MetalCommandBuffer::BindVertexBuffer(const std::unique_ptr<Buffer> &vertexBuffer, const uint64 byteOffset)
+    void MetalCommandBuffer::BindVertexBuffer(const std::unique_ptr<Buffer> &vertexBuffer, const uint64 byteOffset, const uint32 stream)
     {
         SR_ERROR_IF(vertexBuffer->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot bind vertex buffer [{0}], whose graphics API differs from [GraphicsAPI::Metal], within command buffer [{1}]!", vertexBuffer->GetName(), GetName());
         const MetalBuffer &metalVertexBuffer = static_cast<MetalBuffer&>(*vertexBuffer);
@@ -286,11 +357,13 @@ namespace Sierra
         SR_ERROR_IF(currentRenderEncoder == nil, "[Metal]: Cannot bind vertex buffer [{0}] if no render encoder is active within command buffer [{1}]!", vertexBuffer->GetName(), GetName());
 
         SR_ERROR_IF(byteOffset > vertexBuffer->GetMemorySize(), "[Metal]: Cannot bind vertex buffer [{0}] within command buffer [{1}] using specified offset of [{2}] bytes, which is outside of the [{3}] bytes size of the size of the buffer!", vertexBuffer->GetName(), GetName(), byteOffset, vertexBuffer->GetMemorySize());
-        [currentRenderEncoder setVertexBuffer: metalVertexBuffer.GetMetalBuffer() offset: byteOffset atIndex: MetalPipelineLayout::VERTEX_BUFFER_SHADER_INDEX];
-        currentVertexBufferByteOffset = byteOffset;
+        SR_ERROR_IF(stream >= GraphicsPipeline::MAX_VERTEX_STREAM_COUNT, "[Metal]: Cannot bind vertex buffer [{0}] within command buffer [{1}] to stream [{2}], as it exceeds the maximum of [{3}] vertex streams!", vertexBuffer->GetName(), GetName(), stream, GraphicsPipeline::MAX_VERTEX_STREAM_COUNT);
+
+        [currentRenderEncoder setVertexBuffer: metalVertexBuffer.GetMetalBuffer() offset: byteOffset atIndex: MetalPipelineLayout::GetVertexBufferShaderIndex(stream)];
+        currentVertexBufferByteOffsets[stream] = byteOffset;
     }
 
-    void MetalCommandBuffer::BindIndexBuffer(const std::unique_ptr<Buffer> &indexBuffer, const uint64 byteOffset)
+    void MetalCommandBuffer::BindIndexBuffer(const std::unique_ptr<Buffer> &indexBuffer, const uint64 byteOffset, const IndexBufferType indexType)
     {
         SR_ERROR_IF(indexBuffer->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot bind index buffer [{0}], whose graphics API differs from [GraphicsAPI::Metal], within command buffer [{1}]!", indexBuffer->GetName(), GetName());
         const MetalBuffer &metalIndexBuffer = static_cast<MetalBuffer&>(*indexBuffer);
@@ -300,6 +373,7 @@ namespace Sierra
 
         currentIndexBuffer = metalIndexBuffer.GetMetalBuffer();
         currentIndexBufferByteOffset = byteOffset;
+        currentIndexBufferType = indexType;
     }
 
     void MetalCommandBuffer::SetScissor(const Vector4UInt &scissor)
@@ -308,20 +382,36 @@ namespace Sierra
         [currentRenderEncoder setScissorRect: { scissor.x, scissor.y, scissor.z, scissor.w }];
     }
 
+    void MetalCommandBuffer::SetCullMode(const CullMode cullMode)
+    {
+        SR_ERROR_IF(currentGraphicsPipeline == nil, "[Metal]: Cannot set cull mode if no graphics pipeline is active within command buffer [{0}]!", GetName());
+        [currentRenderEncoder setCullMode: MetalGraphicsPipeline::CullModeToCullMode(cullMode)];
+    }
+
+    void MetalCommandBuffer::SetFrontFaceMode(const FrontFaceMode frontFaceMode)
+    {
+        SR_ERROR_IF(currentGraphicsPipeline == nil, "[Metal]: Cannot set front face mode if no graphics pipeline is active within command buffer [{0}]!", GetName());
+        [currentRenderEncoder setFrontFacingWinding: MetalGraphicsPipeline::FrontFaceModeToWinding(frontFaceMode)];
+    }
+
+    void MetalCommandBuffer::SetDepthMode(const DepthMode depthMode)
+    {
+        SR_ERROR_IF(currentGraphicsPipeline == nil, "[Metal]: Cannot set depth mode if no graphics pipeline is active within command buffer [{0}]!", GetName());
+        if (currentGraphicsPipeline->GetDepthStencilState(depthMode) != nil) [currentRenderEncoder setDepthStencilState: currentGraphicsPipeline->GetDepthStencilState(depthMode)];
+    }
+
     void MetalCommandBuffer::Draw(const uint32 vertexCount, const uint32 vertexOffset)
     {
         SR_ERROR_IF(currentRenderEncoder == nil, "[Metal]: Cannot draw if no render encoder is active within command buffer [{0}]!", GetName());
-        const uint64 newVertexBufferByteOffset = currentVertexBufferByteOffset + (static_cast<uint64>(vertexOffset) * currentGraphicsPipeline->GetVertexByteStride());
-        if (newVertexBufferByteOffset > 0) [currentRenderEncoder setVertexBufferOffset: newVertexBufferByteOffset atIndex: MetalPipelineLayout::VERTEX_BUFFER_SHADER_INDEX];
+        ApplyVertexOffset(vertexOffset);
         [currentRenderEncoder drawPrimitives: MTLPrimitiveTypeTriangle vertexStart: 0 vertexCount: vertexCount];
     }
 
     void MetalCommandBuffer::DrawIndexed(const uint32 indexCount, const uint32 indexOffset, const uint32 vertexOffset)
     {
         SR_ERROR_IF(currentRenderEncoder == nil, "[Metal]: Cannot draw indexed if no render encoder is active within command buffer [{0}]!", GetName());
-        const uint64 newVertexBufferByteOffset = currentVertexBufferByteOffset + (static_cast<uint64>(vertexOffset) * currentGraphicsPipeline->GetVertexByteStride());
-        if (newVertexBufferByteOffset > 0) [currentRenderEncoder setVertexBufferOffset: newVertexBufferByteOffset atIndex: MetalPipelineLayout::VERTEX_BUFFER_SHADER_INDEX];
-        [currentRenderEncoder drawIndexedPrimitives: MTLPrimitiveTypeTriangle indexCount: indexCount indexType: MTLIndexTypeUInt32 indexBuffer: currentIndexBuffer indexBufferOffset: currentIndexBufferByteOffset + indexOffset * sizeof(uint32) instanceCount: 1];
+        ApplyVertexOffset(vertexOffset);
+        [currentRenderEncoder drawIndexedPrimitives: MTLPrimitiveTypeTriangle indexCount: indexCount indexType: IndexBufferTypeToIndexType(currentIndexBufferType) indexBuffer: currentIndexBuffer indexBufferOffset: currentIndexBufferByteOffset + static_cast<uint64>(indexOffset) * IndexBufferTypeToMemorySize(currentIndexBufferType) instanceCount: 1];
     }
 
     void MetalCommandBuffer::BeginComputePipeline(const std::unique_ptr<ComputePipeline> &computePipeline)
@@ -394,29 +484,42 @@ namespace Sierra
         }
     }
 
-    void MetalCommandBuffer::BindImage(const uint32 binding, const std::unique_ptr<Image> &image, const uint32 arrayIndex)
+    void MetalCommandBuffer::BindImage(const uint32 binding, const std::unique_ptr<Image> &image, const uint32 arrayIndex, const ImageSubresourceRange &subresourceRange)
     {
         SR_ERROR_IF(image->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot bind image [{0}], whose graphics API differs from [GraphicsAPI::Metal], to binding [{1}] within command buffer [{2}]!", image->GetName(), binding, GetName());
         const MetalImage &metalImage = static_cast<MetalImage&>(*image);
+        const id<MTLTexture> textureView = metalImage.GetMetalTextureView(subresourceRange);
 
         SR_ERROR_IF(currentRenderEncoder == nil && currentComputeEncoder == nil, "[Metal]: Cannot bind image [{0}] if no encoder is active within command buffer [{1}]!", image->GetName(), GetName());
         if (currentComputeEncoder != nil)
         {
             const MetalPipelineBinding bindingData = currentComputePipeline->GetLayout().GetBindingData(binding);
-            [currentComputeEncoder setTexture: metalImage.GetMetalTexture() atIndex: bindingData.index];
+            [currentComputeEncoder setTexture: textureView atIndex: bindingData.index];
+
+            // Images bound to a binding with an immutable sampler are sampled using it
+            if (currentComputePipeline->GetLayout().HasImmutableSampler(binding)) [currentComputeEncoder setSamplerState: currentComputePipeline->GetLayout().GetImmutableSamplerState(binding) atIndex: bindingData.index];
         }
         else
         {
             const MetalPipelineBinding bindingData = currentGraphicsPipeline->GetLayout().GetBindingData(binding);
-            [currentRenderEncoder setVertexTexture: metalImage.GetMetalTexture() atIndex: bindingData.index];
-            if (currentGraphicsPipeline->HasFragmentShader()) [currentRenderEncoder setFragmentTexture: metalImage.GetMetalTexture() atIndex: bindingData.index];
+            [currentRenderEncoder setVertexTexture: textureView atIndex: bindingData.index];
+            if (currentGraphicsPipeline->HasFragmentShader()) [currentRenderEncoder setFragmentTexture: textureView atIndex: bindingData.index];
+
+            // Images bound to a binding with an immutable sampler are sampled using it
+            if (currentGraphicsPipeline->GetLayout().HasImmutableSampler(binding))
+            {
+                const id<MTLSamplerState> samplerState = currentGraphicsPipeline->GetLayout().GetImmutableSamplerState(binding);
+                [currentRenderEncoder setVertexSamplerState: samplerState atIndex: bindingData.data.textureData.samplerIndex];
+                if (currentGraphicsPipeline->HasFragmentShader()) [currentRenderEncoder setFragmentSamplerState: samplerState atIndex: bindingData.data.textureData.samplerIndex];
+            }
         }
     }
 
-    void MetalCommandBuffer::BindImage(const uint32 binding, const std::unique_ptr<Image> &image, const std::unique_ptr<Sampler> &sampler, const uint32 arrayIndex)
+    void MetalCommandBuffer::BindImage(const uint32 binding, const std::unique_ptr<Image> &image, const std::unique_ptr<Sampler> &sampler, const uint32 arrayIndex, const ImageSubresourceRange &subresourceRange)
     {
         SR_ERROR_IF(image->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot bind image [{0}], whose graphics API differs from [GraphicsAPI::Metal], to binding [{1}] within command buffer [{2}]!", image->GetName(), binding, GetName());
         const MetalImage &metalImage = static_cast<MetalImage&>(*image);
+        const id<MTLTexture> textureView = metalImage.GetMetalTextureView(subresourceRange);
 
         SR_ERROR_IF(sampler->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot bind image [{0}] using sampler [{1}], whose graphics API differs from [GraphicsAPI::Metal], to binding [{2}] within command buffer [{3}]!", image->GetName(), sampler->GetName(), binding, GetName());
         const MetalSampler &metalSampler = static_cast<MetalSampler&>(*sampler);
@@ -426,17 +529,17 @@ namespace Sierra
         if (currentComputeEncoder != nil)
         {
             const MetalPipelineBinding bindingData = currentComputePipeline->GetLayout().GetBindingData(binding);
-            [currentComputeEncoder setTexture: metalImage.GetMetalTexture() atIndex: bindingData.index];
+            [currentComputeEncoder setTexture: textureView atIndex: bindingData.index];
             [currentComputeEncoder setSamplerState: metalSampler.GetSamplerState() atIndex: bindingData.index];
         }
         else
         {
             const MetalPipelineBinding bindingData = currentGraphicsPipeline->GetLayout().GetBindingData(binding);
-            [currentRenderEncoder setVertexTexture: metalImage.GetMetalTexture() atIndex: bindingData.index];
+            [currentRenderEncoder setVertexTexture: textureView atIndex: bindingData.index];
             [currentRenderEncoder setVertexSamplerState: metalSampler.GetSamplerState() atIndex: bindingData.data.textureData.samplerIndex];
             if (currentGraphicsPipeline->HasFragmentShader())
             {
-                [currentRenderEncoder setFragmentTexture: metalImage.GetMetalTexture() atIndex: bindingData.index];
+                [currentRenderEncoder setFragmentTexture: textureView atIndex: bindingData.index];
                 [currentRenderEncoder setFragmentSamplerState: metalSampler.GetSamplerState() atIndex: bindingData.data.textureData.samplerIndex];
             }
         }
@@ -466,8 +569,128 @@ namespace Sierra
         [commandBuffer popDebugGroup];
     }
 
+    void MetalCommandBuffer::ResetQueryPool(const std::unique_ptr<QueryPool> &queryPool, const uint32 firstQuery, uint32 queryCount)
+    {
+        SR_ERROR_IF(queryPool->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot reset query pool [{0}], whose graphics API differs from [GraphicsAPI::Metal], within command buffer [{1}]!", queryPool->GetName(), GetName());
+        MetalQueryPool &metalQueryPool = static_cast<MetalQueryPool&>(*queryPool);
+
+        queryCount = queryCount != 0 ? queryCount : queryPool->GetQueryCount() - firstQuery;
+        SR_ERROR_IF(firstQuery + queryCount > queryPool->GetQueryCount(), "[Metal]: Cannot reset queries [{0}-{1}] of query pool [{2}] within command buffer [{3}], as they exceed its query count - [{4}]!", firstQuery, firstQuery + queryCount - 1, queryPool->GetName(), GetName(), queryPool->GetQueryCount());
+        SR_ERROR_IF(currentRenderEncoder != nil, "[Metal]: Cannot reset query pool [{0}] within command buffer [{1}] while a render pass is active!", queryPool->GetName(), GetName());
+
+        // Counter samples are always overwritten, so only visibility results need clearing
+        if (queryPool->GetType() != QueryType::Occlusion) return;
+
+        if (currentBlitEncoder == nil)
+        {
+            currentBlitEncoder = [commandBuffer blitCommandEncoder];
+            device.SetResourceName(currentBlitEncoder , "Transfer Encoder");
+        }
+
+        [currentBlitEncoder fillBuffer: metalQueryPool.GetVisibilityResultBuffer() range: NSMakeRange(firstQuery * sizeof(uint64), queryCount * sizeof(uint64)) value: 0];
+        metalQueryPool.SetLastWriteSignalValue(completionSignalValue);
+        currentOcclusionQueryPool = &metalQueryPool;
+    }
+
+    void MetalCommandBuffer::BeginQuery(const std::unique_ptr<QueryPool> &queryPool, const uint32 query)
+    {
+        SR_ERROR_IF(queryPool->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot begin query of query pool [{0}], whose graphics API differs from [GraphicsAPI::Metal], within command buffer [{1}]!", queryPool->GetName(), GetName());
+        MetalQueryPool &metalQueryPool = static_cast<MetalQueryPool&>(*queryPool);
+
+        SR_ERROR_IF(queryPool->GetType() == QueryType::Timestamp, "[Metal]: Cannot begin query of query pool [{0}] within command buffer [{1}], as timestamp queries can only be written to, using CommandBuffer::WriteTimestamp()!", queryPool->GetName(), GetName());
+        SR_ERROR_IF(query >= queryPool->GetQueryCount(), "[Metal]: Cannot begin query [{0}] of query pool [{1}] within command buffer [{2}], as it does not have it!", query, queryPool->GetName(), GetName());
+        metalQueryPool.SetLastWriteSignalValue(completionSignalValue);
+
+        if (queryPool->GetType() == QueryType::Occlusion)
+        {
+            SR_ERROR_IF(currentRenderEncoder == nil, "[Metal]: Cannot begin occlusion query of query pool [{0}] if no render pass is active within command buffer [{1}]!", queryPool->GetName(), GetName());
+            SR_ERROR_IF(currentOcclusionQueryPool != &metalQueryPool, "[Metal]: Cannot begin occlusion query of query pool [{0}] within command buffer [{1}], as it must have been the last occlusion query pool to be reset before the active render pass was began!", queryPool->GetName(), GetName());
+            [currentRenderEncoder setVisibilityResultMode: MTLVisibilityResultModeBoolean offset: query * sizeof(uint64)];
+            return;
+        }
+
+        SampleCounters(metalQueryPool.GetCounterSampleBuffer(), query * 2);
+    }
+
+    void MetalCommandBuffer::EndQuery(const std::unique_ptr<QueryPool> &queryPool, const uint32 query)
+    {
+        SR_ERROR_IF(queryPool->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot end query of query pool [{0}], whose graphics API differs from [GraphicsAPI::Metal], within command buffer [{1}]!", queryPool->GetName(), GetName());
+        const MetalQueryPool &metalQueryPool = static_cast<MetalQueryPool&>(*queryPool);
+
+        SR_ERROR_IF(query >= queryPool->GetQueryCount(), "[Metal]: Cannot end query [{0}] of query pool [{1}] within command buffer [{2}], as it does not have it!", query, queryPool->GetName(), GetName());
+
+        if (queryPool->GetType() == QueryType::Occlusion)
+        {
+            SR_ERROR_IF(currentRenderEncoder == nil, "[Metal]: Cannot end occlusion query of query pool [{0}] if no render pass is active within command buffer [{1}]!", queryPool->GetName(), GetName());
+            [currentRenderEncoder setVisibilityResultMode: MTLVisibilityResultModeDisabled offset: query * sizeof(uint64)];
+            return;
+        }
+
+        SampleCounters(metalQueryPool.GetCounterSampleBuffer(), query * 2 + 1);
+    }
+
+    void MetalCommandBuffer::WriteTimestamp(const std::unique_ptr<QueryPool> &queryPool, const uint32 query)
+    {
+        SR_ERROR_IF(queryPool->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot write timestamp to query pool [{0}], whose graphics API differs from [GraphicsAPI::Metal], within command buffer [{1}]!", queryPool->GetName(), GetName());
+        MetalQueryPool &metalQueryPool = static_cast<MetalQueryPool&>(*queryPool);
+
+        SR_ERROR_IF(queryPool->GetType() != QueryType::Timestamp, "[Metal]: Cannot write timestamp to query pool [{0}] within command buffer [{1}], as it was not created with [QueryType::Timestamp]!", queryPool->GetName(), GetName());
+        SR_ERROR_IF(query >= queryPool->GetQueryCount(), "[Metal]: Cannot write timestamp to query [{0}] of query pool [{1}] within command buffer [{2}], as it does not have it!", query, queryPool->GetName(), GetName());
+
+        metalQueryPool.SetLastWriteSignalValue(completionSignalValue);
+        SampleCounters(metalQueryPool.GetCounterSampleBuffer(), query);
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    void MetalCommandBuffer::SampleCounters(const id<MTLCounterSampleBuffer> counterSampleBuffer, const uint32 sampleIndex)
+    {
+        // Sample within whichever encoder is active, or within a transfer one, if there is none
+        if (currentRenderEncoder != nil)
+        {
+            [currentRenderEncoder sampleCountersInBuffer: counterSampleBuffer atSampleIndex: sampleIndex withBarrier: YES];
+            return;
+        }
+        if (currentComputeEncoder != nil)
+        {
+            [currentComputeEncoder sampleCountersInBuffer: counterSampleBuffer atSampleIndex: sampleIndex withBarrier: YES];
+            return;
+        }
+
+        if (currentBlitEncoder == nil)
+        {
+            currentBlitEncoder = [commandBuffer blitCommandEncoder];
+            device.SetResourceName(currentBlitEncoder , "Transfer Encoder");
+        }
+        [currentBlitEncoder sampleCountersInBuffer: counterSampleBuffer atSampleIndex: sampleIndex withBarrier: YES];
+    }
+
+    void MetalCommandBuffer::ApplyVertexOffset(const uint32 vertexOffset)
+    {
+        // Metal has no vertex offset for non-instanced draws, so each bound stream's offset is advanced by its own stride instead
+        for (uint32 i = 0; i < GraphicsPipeline::MAX_VERTEX_STREAM_COUNT; i++)
+        {
+            const uint32 vertexByteStride = currentGraphicsPipeline->GetVertexByteStride(i);
+            if (vertexByteStride == 0) continue;
+
+            const uint64 newVertexBufferByteOffset = currentVertexBufferByteOffsets[i] + (static_cast<uint64>(vertexOffset) * vertexByteStride);
+            if (newVertexBufferByteOffset > 0) [currentRenderEncoder setVertexBufferOffset: newVertexBufferByteOffset atIndex: MetalPipelineLayout::GetVertexBufferShaderIndex(i)];
+        }
+    }
+
     /* --- CONVERSIONS --- */
 
+    MTLIndexType MetalCommandBuffer::IndexBufferTypeToIndexType(const IndexBufferType indexType)
+    {
+        switch (indexType)
+        {
+            case IndexBufferType::UInt16:       return MTLIndexTypeUInt16;
+            case IndexBufferType::UInt32:       return MTLIndexTypeUInt32;
+        }
+
+        return MTLIndexTypeUInt32;
+    }
+
     MTLRenderStages MetalCommandBuffer::BufferCommandUsageToRenderStages(const BufferCommandUsage bufferCommandUsage)
     {
         switch (bufferCommandUsage)
@@ -476,7 +699,8 @@ namespace Sierra
             case BufferCommandUsage::MemoryRead:
             case BufferCommandUsage::MemoryWrite:
             case BufferCommandUsage::ComputeRead:
-            case BufferCommandUsage::ComputeWrite:       return 0;
+            case BufferCommandUsage::ComputeWrite:
+            case BufferCommandUsage::HostRead:           return 0;
             case BufferCommandUsage::VertexRead:
             case BufferCommandUsage::IndexRead:          return MTLRenderStageVertex;
             case BufferCommandUsage::GraphicsWrite:
@@ -503,4 +727,4 @@ namespace Sierra
         }
     }
 
-}
+}
\ No newline at end of file
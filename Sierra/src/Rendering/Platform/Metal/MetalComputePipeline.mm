@@ -25,9 +25,11 @@ namespace Sierra
 
         // Create pipeline
         NSError* error = nil;
-        computePipelineState = [device.GetMetalDevice() newComputePipelineStateWithFunction: metalComputeShader.GetEntryFunction() error: &error];
+        const id<MTLFunction> computeFunction = metalComputeShader.CreateEntryFunction(createInfo.shaderConstants);
+        computePipelineState = [device.GetMetalDevice() newComputePipelineStateWithFunction: computeFunction error: &error];
         SR_ERROR_IF(error != nil, "[Metal]: Could not create compute pipeline [{0}]! Error: {1}.", GetName(), [error.description cStringUsingEncoding: NSASCIIStringEncoding]);
 
+        [computeFunction release];
         [computePipelineDescriptor release];
     }
 
@@ -14,6 +14,7 @@
 #include "MetalGraphicsPipeline.h"
 #include "MetalComputePipeline.h"
 #include "MetalCommandBuffer.h"
+#include "MetalQueryPool.h"
 
 namespace Sierra
 {
@@ -50,6 +51,7 @@ namespace Sierra
 
     std::unique_ptr<Swapchain> MetalContext::CreateSwapchain(const SwapchainCreateInfo &createInfo) const
     {
+        SR_ERROR_IF(IsHeadless(), "[Metal]: Cannot create swapchain [{0}] within headless context [{1}]! Use RenderingContext::CreateOffscreenSwapchain() instead.", createInfo.name, GetName());
         return std::make_unique<MetalSwapchain>(device, createInfo);
     }
 
@@ -78,4 +80,9 @@ namespace Sierra
         return std::make_unique<MetalCommandBuffer>(device, createInfo);
     }
 
+    std::unique_ptr<QueryPool> MetalContext::CreateQueryPool(const QueryPoolCreateInfo &createInfo) const
+    {
+        return std::make_unique<MetalQueryPool>(device, createInfo);
+    }
+
 }
\ No newline at end of file
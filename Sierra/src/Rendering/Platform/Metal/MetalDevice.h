@@ -33,20 +33,28 @@ namespace Sierra
 
         /* --- POLLING METHODS --- */
         void SubmitCommandBuffer(std::unique_ptr<CommandBuffer> &commandBuffer,  const std::initializer_list<std::reference_wrapper<std::unique_ptr<CommandBuffer>>> &commandBuffersToWait = { }) const override;
-        void WaitForCommandBuffer(const std::unique_ptr<CommandBuffer> &commandBuffer) const override;
+        bool WaitForSignalValue(uint64 signalValue, uint64 timeoutInNanoseconds = std::numeric_limits<uint64>::max()) const override;
+
+        // Metal manages and compacts its own heaps, so there is never anything to defragment
+        inline bool DefragmentMemory(uint64 maxBytesPerStep = 64 * 1024 * 1024, uint32 maxAllocationsPerStep = 64) const override { return false; }
 
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline const std::string& GetDeviceName() const override { return deviceName; }
+        [[nodiscard]] uint64 GetCompletedSignalValue() const override;
 
         [[nodiscard]] bool IsImageFormatSupported(ImageFormat format, ImageUsage usage) const override;
         [[nodiscard]] bool IsImageSamplingSupported(ImageSampling sampling) const override;
         [[nodiscard]] bool IsSamplerAnisotropySupported(SamplerAnisotropy anisotropy) const override;
+        [[nodiscard]] bool IsQueryTypeSupported(QueryType queryType) const override;
+        [[nodiscard]] inline bool IsExtendedDynamicStateSupported() const override { return true; }
 
         [[nodiscard]] inline id<MTLDevice> GetMetalDevice() const { return device; }
         [[nodiscard]] inline id<MTLCommandQueue> GetCommandQueue() const { return commandQueue; }
 
         [[nodiscard]] inline id<MTLSharedEvent> GetSharedSignalSemaphore() const { return sharedSignalSemaphore; }
         [[nodiscard]] inline uint64 GetNewSignalValue() const { lastReservedSignalValue++; return lastReservedSignalValue; }
+        [[nodiscard]] inline uint64 GetLastReservedSignalValue() const { return lastReservedSignalValue; }
+        [[nodiscard]] inline uint64 GetLastSubmittedSignalValue() const override { return lastSubmittedSignalValue; }
 
         /* --- SETTER METHODS --- */
         template<typename T>
@@ -60,12 +68,16 @@ namespace Sierra
         /* --- DESTRUCTOR --- */
         ~MetalDevice() override;
 
+    protected:
+        void QueryMemoryHeapBudgets(std::vector<MemoryHeapBudget> &heapBudgets) const override;
+
     private:
         std::string deviceName;
         id<MTLDevice> device = nil;
         id<MTLCommandQueue> commandQueue = nil;
 
         mutable uint64 lastReservedSignalValue = 0;
+        mutable uint64 lastSubmittedSignalValue = 0;
         id<MTLSharedEvent> sharedSignalSemaphore = nil;
 
         struct CommandBufferQueueEntry
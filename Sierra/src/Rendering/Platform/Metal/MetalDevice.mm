@@ -6,6 +6,7 @@
 
 #include "MetalImage.h"
 #include "MetalCommandBuffer.h"
+#include "MetalQueryPool.h"
 
 namespace Sierra
 {
@@ -37,6 +38,7 @@ namespace Sierra
     {
         SR_ERROR_IF(commandBuffer->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot, from device [{0}], submit command buffer [{1}] with a graphics API, that differs from [GraphicsAPI::Metal]!", GetName(), commandBuffer->GetName());
         const MetalCommandBuffer &metalCommandBuffer = static_cast<MetalCommandBuffer&>(*commandBuffer);
+        lastSubmittedSignalValue = std::max(lastSubmittedSignalValue, metalCommandBuffer.GetCompletionSignalValue()); // Command buffers waiting on others are committed later, but will signal all the same
 
         // If we do not need any manual synchronization, directly submit command buffer
         if (commandBuffersToWait.size() == 0)
@@ -74,19 +76,51 @@ namespace Sierra
         }
     }
 
-    void MetalDevice::WaitForCommandBuffer(const std::unique_ptr<CommandBuffer> &commandBuffer) const
+    bool MetalDevice::WaitForSignalValue(const uint64 signalValue, const uint64 timeoutInNanoseconds) const
     {
-        SR_ERROR_IF(commandBuffer->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot, from device [{0}], wait for command buffer [{1}] with a graphics API, that differs from [GraphicsAPI::Metal]!", GetName(), commandBuffer->GetName());
-        const MetalCommandBuffer &metalCommandBuffer = static_cast<MetalCommandBuffer&>(*commandBuffer);
+        // Yield to other threads, until either the event is signalled, or the timeout expires
+        const auto startTime = std::chrono::steady_clock::now();
+        while ([sharedSignalSemaphore signaledValue] < signalValue)
+        {
+            if (timeoutInNanoseconds != std::numeric_limits<uint64>::max() && static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count()) >= timeoutInNanoseconds) return false;
+            std::this_thread::yield();
+        }
 
-        // Wait for completion
-        while ([sharedSignalSemaphore signaledValue] < metalCommandBuffer.GetCompletionSignalValue());
+        return true;
     }
 
     /* --- GETTER METHODS --- */
 
+    uint64 MetalDevice::GetCompletedSignalValue() const
+    {
+        return [sharedSignalSemaphore signaledValue];
+    }
+
     bool MetalDevice::IsImageFormatSupported(const ImageFormat format, const ImageUsage usage) const
     {
+        // Compressed formats can only ever be sampled from and copied to
+        if (format.compression != ImageCompression::None)
+        {
+            if (usage & ImageUsage::Storage || usage & ImageUsage::ColorAttachment || usage & ImageUsage::DepthAttachment || usage & ImageUsage::InputAttachment || usage & ImageUsage::ResolveAttachment || usage & ImageUsage::TransientAttachment) return false;
+            switch (format.compression)
+            {
+                case ImageCompression::BC1:
+                case ImageCompression::BC2:
+                case ImageCompression::BC3:
+                case ImageCompression::BC4:
+                case ImageCompression::BC5:
+                case ImageCompression::BC6H:
+                case ImageCompression::BC7:         return device.supportsBCTextureCompression;
+                case ImageCompression::ETC2:
+                case ImageCompression::EAC:
+                case ImageCompression::ASTC4x4:
+                case ImageCompression::ASTC6x6:
+                case ImageCompression::ASTC8x8:     return [device supportsFamily: MTLGPUFamilyApple2];
+                default:                            break;
+            }
+            return false;
+        }
+
         // Not RGB format is supported by Metal
         if (format.channels == ImageChannels::RGB) return false;
 
@@ -176,10 +210,28 @@ namespace Sierra
         return anisotropy == SamplerAnisotropy::x1;
     }
 
+    bool MetalDevice::IsQueryTypeSupported(const QueryType queryType) const
+    {
+        if (queryType == QueryType::Occlusion) return true;
+
+        // Counters are sampled within whichever encoder is active, so sampling must be supported at the boundaries of all of them
+        return MetalQueryPool::QueryTypeToCounterSet(device, queryType) != nil && [device supportsCounterSampling: MTLCounterSamplingPointAtDrawBoundary] && [device supportsCounterSampling: MTLCounterSamplingPointAtDispatchBoundary] && [device supportsCounterSampling: MTLCounterSamplingPointAtBlitBoundary];
+    }
+
+    /* --- PROTECTED METHODS --- */
+
+    void MetalDevice::QueryMemoryHeapBudgets(std::vector<MemoryHeapBudget> &heapBudgets) const
+    {
+        // Metal does not expose individual heaps, so the whole device is reported as a single one
+        heapBudgets.resize(1);
+        heapBudgets[0] = { .usage = [device currentAllocatedSize], .budget = [device recommendedMaxWorkingSetSize], .deviceLocal = true };
+    }
+
     /* --- DESTRUCTOR --- */
 
     MetalDevice::~MetalDevice()
     {
+        DestroyAllQueuedResources();
         [sharedSignalSemaphore release];
         [commandQueue release];
         [device release];
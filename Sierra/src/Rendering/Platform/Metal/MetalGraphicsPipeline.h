@@ -22,10 +22,11 @@ namespace Sierra
 
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline id<MTLRenderPipelineState> GetRenderPipelineState() const { return renderPipelineState; }
-        [[nodiscard]] inline id<MTLDepthStencilState> GetDepthStencilState() const { return depthStencilState; }
+        [[nodiscard]] inline id<MTLDepthStencilState> GetDepthStencilState() const { return depthStencilStates[static_cast<uint8>(depthMode)]; }
+        [[nodiscard]] inline id<MTLDepthStencilState> GetDepthStencilState(const DepthMode otherDepthMode) const { return depthStencilStates[static_cast<uint8>(otherDepthMode)]; }
         [[nodiscard]] inline const MetalPipelineLayout& GetLayout() const { return layout; }
 
-        [[nodiscard]] inline uint32 GetVertexByteStride() const { return vertexByteStride; }
+        [[nodiscard]] inline uint32 GetVertexByteStride(const uint32 stream = 0) const { return vertexByteStrides[stream]; }
         [[nodiscard]] inline bool HasFragmentShader() const { return hasFragmentShader; }
 
         [[nodiscard]] inline MTLCullMode GetCullMode() const { return cullMode; }
@@ -44,9 +45,10 @@ namespace Sierra
         const MetalPipelineLayout &layout;
 
         id<MTLRenderPipelineState> renderPipelineState = nil;
-        id<MTLDepthStencilState> depthStencilState = nil;
+        std::array<id<MTLDepthStencilState>, 2> depthStencilStates = { nil, nil }; // Indexed by DepthMode, so it can be overridden dynamically
+        DepthMode depthMode = DepthMode::None;
 
-        uint32 vertexByteStride = 0;
+        std::array<uint32, MAX_VERTEX_STREAM_COUNT> vertexByteStrides = { };
         bool hasFragmentShader = false;
 
         MTLCullMode cullMode = MTLCullModeNone;
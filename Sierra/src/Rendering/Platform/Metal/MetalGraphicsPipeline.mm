@@ -29,13 +29,17 @@ namespace Sierra
         device.SetResourceName(renderPipelineDescriptor, GetName());
 
         // Configure pipeline descriptor's shaders
-        [renderPipelineDescriptor setVertexFunction: metalVertexShader.GetEntryFunction()];
+        const id<MTLFunction> vertexFunction = metalVertexShader.CreateEntryFunction(createInfo.shaderConstants);
+        [renderPipelineDescriptor setVertexFunction: vertexFunction];
+        [vertexFunction release];
         if (createInfo.fragmentShader.has_value() && createInfo.fragmentShader->get() != nil)
         {
             SR_ERROR_IF(createInfo.fragmentShader->get()->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot create graphics pipeline [{0}] with fragment shader [{1}], as its graphics API differs from [GraphicsAPI::Metal]!", GetName(), createInfo.fragmentShader->get()->GetName());
             const MetalShader &metalFragmentShader = static_cast<MetalShader&>(*createInfo.fragmentShader->get());
 
-            [renderPipelineDescriptor setFragmentFunction: metalFragmentShader.GetEntryFunction()];
+            const id<MTLFunction> fragmentFunction = metalFragmentShader.CreateEntryFunction(createInfo.shaderConstants);
+            [renderPipelineDescriptor setFragmentFunction: fragmentFunction];
+            [fragmentFunction release];
             hasFragmentShader = true;
         }
 
@@ -64,7 +68,10 @@ namespace Sierra
         MTLVertexDescriptor* const vertexDescriptor = [[MTLVertexDescriptor alloc] init];
         for (uint32 i = 0; i < createInfo.vertexInputs.size(); i++)
         {
-            [vertexDescriptor.attributes[i] setBufferIndex: MetalPipelineLayout::VERTEX_BUFFER_SHADER_INDEX];
+            const uint32 streamIndex = createInfo.vertexInputStreams.size() != 0 ? *(createInfo.vertexInputStreams.begin() + i) : 0;
+            uint32 &vertexByteStride = vertexByteStrides[streamIndex];
+
+            [vertexDescriptor.attributes[i] setBufferIndex: MetalPipelineLayout::GetVertexBufferShaderIndex(streamIndex)];
             [vertexDescriptor.attributes[i] setOffset: vertexByteStride];
             switch (*(createInfo.vertexInputs.begin() + i))
             {
@@ -76,7 +83,7 @@ namespace Sierra
                 case VertexInput::UInt16:        { [vertexDescriptor.attributes[i] setFormat: MTLVertexFormatUShort];           vertexByteStride += 1 * 2; break; }
                 case VertexInput::Norm16:        { [vertexDescriptor.attributes[i] setFormat: MTLVertexFormatShortNormalized];  vertexByteStride += 1 * 2; break; }
                 case VertexInput::UNorm16:       { [vertexDescriptor.attributes[i] setFormat: MTLVertexFormatUShortNormalized]; vertexByteStride += 1 * 2; break; }
-                case VertexInput::Float16:       { [vertexDescriptor.attributes[i] setFormat: MTLVertexFormatHalf];             vertexByteStride += 1 * 4; break; }
+                case VertexInput::Float16:       { [vertexDescriptor.attributes[i] setFormat: MTLVertexFormatHalf];             vertexByteStride += 1 * 2; break; }
                 case VertexInput::Int32:         { [vertexDescriptor.attributes[i] setFormat: MTLVertexFormatInt];              vertexByteStride += 1 * 4; break; }
                 case VertexInput::UInt32:        { [vertexDescriptor.attributes[i] setFormat: MTLVertexFormatUInt];             vertexByteStride += 1 * 4; break; }
                 case VertexInput::Float32:       { [vertexDescriptor.attributes[i] setFormat: MTLVertexFormatFloat];            vertexByteStride += 1 * 4; break; }
@@ -121,18 +128,27 @@ namespace Sierra
                 case VertexInput::Float32_4D:    { [vertexDescriptor.attributes[i] setFormat: MTLVertexFormatFloat4];            vertexByteStride += 4 * 4; break; }
             }
         }
-        [vertexDescriptor.layouts[MetalPipelineLayout::VERTEX_BUFFER_SHADER_INDEX] setStride: vertexByteStride];
+        for (uint32 i = 0; i < MAX_VERTEX_STREAM_COUNT; i++)
+        {
+            if (vertexByteStrides[i] == 0) continue;
+            [vertexDescriptor.layouts[MetalPipelineLayout::GetVertexBufferShaderIndex(i)] setStride: vertexByteStrides[i]];
+        }
         [renderPipelineDescriptor setVertexDescriptor: vertexDescriptor];
 
-        // Set depth testing
+        // Set depth testing (a state for either depth mode is created, so it can be switched without another pipeline)
+        depthMode = createInfo.depthMode;
         if (metalRenderPass.HasDepthAttachment())
         {
             MTLDepthStencilDescriptor* const depthStencilDescriptor = [[MTLDepthStencilDescriptor alloc] init];
             device.SetResourceName(depthStencilDescriptor, "Depth Stencil state of Graphics Pipeline [" + GetName() + "]");
-            [depthStencilDescriptor setDepthWriteEnabled: createInfo.depthMode == DepthMode::WriteDepth];
             [depthStencilDescriptor setDepthCompareFunction: MTLCompareFunctionLessEqual];
 
-            depthStencilState = [device.GetMetalDevice() newDepthStencilStateWithDescriptor: depthStencilDescriptor];
+            [depthStencilDescriptor setDepthWriteEnabled: NO];
+            depthStencilStates[static_cast<uint8>(DepthMode::None)] = [device.GetMetalDevice() newDepthStencilStateWithDescriptor: depthStencilDescriptor];
+
+            [depthStencilDescriptor setDepthWriteEnabled: YES];
+            depthStencilStates[static_cast<uint8>(DepthMode::WriteDepth)] = [device.GetMetalDevice() newDepthStencilStateWithDescriptor: depthStencilDescriptor];
+
             [depthStencilDescriptor release];
         }
 
@@ -150,7 +166,10 @@ namespace Sierra
     MetalGraphicsPipeline::~MetalGraphicsPipeline()
     {
         [renderPipelineState release];
-        if (depthStencilState != nil) [depthStencilState release];
+        for (const id<MTLDepthStencilState> depthStencilState : depthStencilStates)
+        {
+            if (depthStencilState != nil) [depthStencilState release];
+        }
     }
     
     /* --- CONVERSIONS --- */
@@ -20,6 +20,8 @@ namespace Sierra
 
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline const id<MTLTexture> GetMetalTexture() const { return texture; }
+        // Returns a view of the given subresources, which is created on first use, and kept until the image is destroyed
+        [[nodiscard]] id<MTLTexture> GetMetalTextureView(const ImageSubresourceRange &subresourceRange) const;
 
         /* --- DESTRUCTOR --- */
         ~MetalImage() override;
@@ -33,7 +35,18 @@ namespace Sierra
         static MTLCPUCacheMode ImageMemoryLocationToCPUCacheMode(ImageMemoryLocation memoryLocation);
 
     private:
+        const MetalDevice &device;
         id<MTLTexture> texture = nil;
+        struct TextureView
+        {
+            std::array<uint32, 4> description = { }; // Compared on lookup, as different ranges may share a hash
+            id<MTLTexture> texture = nil;
+        };
+        mutable std::unordered_multimap<Hash, TextureView> textureViews;
+        mutable std::mutex textureViewMutex;
+
+        std::string memoryCategory;
+        uint64 allocatedMemorySize = 0;
 
         friend class MetalSwapchain;
         struct SwapchainImageCreateInfo
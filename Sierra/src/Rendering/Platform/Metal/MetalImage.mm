@@ -10,7 +10,7 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     MetalImage::MetalImage(const MetalDevice &device, const ImageCreateInfo &createInfo)
-        : Image(createInfo), MetalResource(createInfo.name)
+        : Image(createInfo), MetalResource(createInfo.name), device(device), memoryCategory(createInfo.memoryCategory)
     {
         SR_ERROR_IF(!device.IsImageSamplingSupported(createInfo.sampling), "[Metal]: Cannot create image [{0}] with unsupported sampling! Make sure to use Device::IsImageSamplingSupported() to query image sampling support.", GetName());
         SR_ERROR_IF(!device.IsImageFormatSupported(createInfo.format, createInfo.usage), "[Metal]: Cannot create [{0}] image with unsupported format! Use Device::IsImageFormatSupported() to query format support.", GetName());
@@ -36,21 +36,60 @@ namespace Sierra
         SR_ERROR_IF(texture == nil, "[Metal]: Could not create image!");
         device.SetResourceName(texture, GetName());
 
+        // Account for allocated memory
+        allocatedMemorySize = [texture allocatedSize];
+        device.TrackMemoryAllocation(memoryCategory, allocatedMemorySize);
+
         [textureDescriptor release];
     }
 
     MetalImage::MetalImage(const MetalDevice &device, const SwapchainImageCreateInfo &createInfo)
         : Image({ .name = createInfo.name, .width = createInfo.width, .height = createInfo.height, .format = SwapchainPixelFormatToImageFormat(createInfo.format), .usage = ImageUsage::ColorAttachment, .memoryLocation = ImageMemoryLocation::Device }), MetalResource(createInfo.name),
-          texture(createInfo.texture), swapchainImage(true)
+          device(device), texture(createInfo.texture), swapchainImage(true)
+    {
+
+    }
+
+    /* --- GETTER METHODS --- */
+
+    id<MTLTexture> MetalImage::GetMetalTextureView(const ImageSubresourceRange &subresourceRange) const
     {
+        const uint32 mipLevelCount = subresourceRange.mipLevelCount != 0 ? subresourceRange.mipLevelCount : GetMipLevelCount() - std::min(subresourceRange.baseMipLevel, GetMipLevelCount());
+        const uint32 layerCount = subresourceRange.layerCount != 0 ? subresourceRange.layerCount : GetLayerCount() - std::min(subresourceRange.baseLayer, GetLayerCount());
+        SR_ERROR_IF(subresourceRange.baseMipLevel + mipLevelCount > GetMipLevelCount() || mipLevelCount == 0, "[Metal]: Cannot create view of mip levels [{0}-{1}] of image [{2}], as they exceed its mip level count - [{3}]!", subresourceRange.baseMipLevel, subresourceRange.baseMipLevel + mipLevelCount - 1, GetName(), GetMipLevelCount());
+        SR_ERROR_IF(subresourceRange.baseLayer + layerCount > GetLayerCount() || layerCount == 0, "[Metal]: Cannot create view of layers [{0}-{1}] of image [{2}], as they exceed its layer count - [{3}]!", subresourceRange.baseLayer, subresourceRange.baseLayer + layerCount - 1, GetName(), GetLayerCount());
+
+        // Whole image needs no view
+        if (subresourceRange.baseMipLevel == 0 && mipLevelCount == GetMipLevelCount() && subresourceRange.baseLayer == 0 && layerCount == GetLayerCount()) return texture;
+
+        const std::array<uint32, 4> description = { subresourceRange.baseMipLevel, mipLevelCount, subresourceRange.baseLayer, layerCount };
+        Hash key = 0;
+        for (const uint32 value : description) HashCombine(key, value);
+
+        // Views may be requested by command buffers recorded on different threads
+        std::lock_guard lock(textureViewMutex);
+        for (auto [iterator, end] = textureViews.equal_range(key); iterator != end; iterator++)
+        {
+            if (iterator->second.description == description) return iterator->second.texture;
+        }
 
+        const id<MTLTexture> textureView = [texture newTextureViewWithPixelFormat: [texture pixelFormat] textureType: ImageSettingsToTextureType(GetSampling(), layerCount) levels: NSMakeRange(subresourceRange.baseMipLevel, mipLevelCount) slices: NSMakeRange(subresourceRange.baseLayer, layerCount)];
+        SR_ERROR_IF(textureView == nil, "[Metal]: Could not create view of mip levels [{0}-{1}] and layers [{2}-{3}] of image [{4}]!", subresourceRange.baseMipLevel, subresourceRange.baseMipLevel + mipLevelCount - 1, subresourceRange.baseLayer, subresourceRange.baseLayer + layerCount - 1, GetName());
+
+        textureViews.emplace(key, TextureView { .description = description, .texture = textureView });
+        return textureView;
     }
 
     /* --- DESTRUCTOR --- */
 
     MetalImage::~MetalImage()
     {
-        if (!swapchainImage) [texture release];
+        for (const auto &[key, textureView] : textureViews) [textureView.texture release];
+        if (!swapchainImage)
+        {
+            [texture release];
+            device.UntrackMemoryAllocation(memoryCategory, allocatedMemorySize);
+        }
     }
 
     /* --- PRIVATE METHODS --- */
@@ -83,6 +122,84 @@ namespace Sierra
 
     MTLPixelFormat MetalImage::ImageFormatToPixelFormat(const ImageFormat format)
     {
+        const bool sRGB = format.memoryType == ImageMemoryType::SRGB8;
+        switch (format.compression)
+        {
+            case ImageCompression::None:            break;
+            case ImageCompression::BC1:
+            {
+                if ((format.channels == ImageChannels::RGB || format.channels == ImageChannels::RGBA) && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? MTLPixelFormatBC1_RGBA_sRGB : MTLPixelFormatBC1_RGBA;
+                break;
+            }
+            case ImageCompression::BC2:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? MTLPixelFormatBC2_RGBA_sRGB : MTLPixelFormatBC2_RGBA;
+                break;
+            }
+            case ImageCompression::BC3:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? MTLPixelFormatBC3_RGBA_sRGB : MTLPixelFormatBC3_RGBA;
+                break;
+            }
+            case ImageCompression::BC4:
+            {
+                if (format.channels == ImageChannels::R && format.memoryType == ImageMemoryType::UNorm8) return MTLPixelFormatBC4_RUnorm;
+                if (format.channels == ImageChannels::R && format.memoryType == ImageMemoryType::Norm8) return MTLPixelFormatBC4_RSnorm;
+                break;
+            }
+            case ImageCompression::BC5:
+            {
+                if (format.channels == ImageChannels::RG && format.memoryType == ImageMemoryType::UNorm8) return MTLPixelFormatBC5_RGUnorm;
+                if (format.channels == ImageChannels::RG && format.memoryType == ImageMemoryType::Norm8) return MTLPixelFormatBC5_RGSnorm;
+                break;
+            }
+            case ImageCompression::BC6H:
+            {
+                if (format.channels == ImageChannels::RGB && format.memoryType == ImageMemoryType::Float16) return MTLPixelFormatBC6H_RGBUfloat;
+                break;
+            }
+            case ImageCompression::BC7:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? MTLPixelFormatBC7_RGBAUnorm_sRGB : MTLPixelFormatBC7_RGBAUnorm;
+                break;
+            }
+            case ImageCompression::ETC2:
+            {
+                if (format.channels == ImageChannels::RGB && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? MTLPixelFormatETC2_RGB8_sRGB : MTLPixelFormatETC2_RGB8;
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? MTLPixelFormatEAC_RGBA8_sRGB : MTLPixelFormatEAC_RGBA8;
+                break;
+            }
+            case ImageCompression::EAC:
+            {
+                if (format.channels == ImageChannels::R && format.memoryType == ImageMemoryType::UNorm8) return MTLPixelFormatEAC_R11Unorm;
+                if (format.channels == ImageChannels::R && format.memoryType == ImageMemoryType::Norm8) return MTLPixelFormatEAC_R11Snorm;
+                if (format.channels == ImageChannels::RG && format.memoryType == ImageMemoryType::UNorm8) return MTLPixelFormatEAC_RG11Unorm;
+                if (format.channels == ImageChannels::RG && format.memoryType == ImageMemoryType::Norm8) return MTLPixelFormatEAC_RG11Snorm;
+                break;
+            }
+            case ImageCompression::ASTC4x4:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? MTLPixelFormatASTC_4x4_sRGB : MTLPixelFormatASTC_4x4_LDR;
+                break;
+            }
+            case ImageCompression::ASTC6x6:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? MTLPixelFormatASTC_6x6_sRGB : MTLPixelFormatASTC_6x6_LDR;
+                break;
+            }
+            case ImageCompression::ASTC8x8:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? MTLPixelFormatASTC_8x8_sRGB : MTLPixelFormatASTC_8x8_LDR;
+                break;
+            }
+        }
+
+        if (format.compression != ImageCompression::None)
+        {
+            SR_ERROR("[Metal]: Cannot determine image format of invalid compression, channel and memory configuration!");
+            return MTLPixelFormatInvalid;
+        }
+
         switch (format.channels)
         {
             case ImageChannels::R:
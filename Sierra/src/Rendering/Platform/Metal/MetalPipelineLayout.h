@@ -8,6 +8,7 @@
 #include "MetalResource.h"
 
 #include "MetalDevice.h"
+#include "MetalSampler.h"
 
 namespace Sierra
 {
@@ -31,17 +32,18 @@ namespace Sierra
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline MetalPipelineBinding GetBindingData(const uint32 binding) const { return bindings[binding]; };
         [[nodiscard]] inline MetalPipelineBinding GetPushConstantBinding() const { return bindings.back(); };
-        [[nodiscard]] inline uint16 GetPushConstantSize() const { return pushConstantSize; }
+        [[nodiscard]] inline id<MTLSamplerState> GetImmutableSamplerState(const uint32 binding) const { return immutableSamplerStates[binding]; }
 
         /* --- CONSTANTS --- */
         constexpr static NSUInteger VERTEX_BUFFER_SHADER_INDEX = 30;
+        [[nodiscard]] constexpr static NSUInteger GetVertexBufferShaderIndex(const uint32 stream) { return VERTEX_BUFFER_SHADER_INDEX - stream; } // Streams are indexed downwards, so they never collide with bound buffers
 
         /* --- DESTRUCTOR --- */
-        ~MetalPipelineLayout() override = default;
+        ~MetalPipelineLayout() override;
 
     private:
         std::vector<MetalPipelineBinding> bindings;
-        uint16 pushConstantSize = 0;
+        std::vector<id<MTLSamplerState>> immutableSamplerStates; // Metal has no layout-level samplers, so these are retained and set whenever an image is bound without one
 
     };
 
@@ -10,22 +10,22 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     MetalPipelineLayout::MetalPipelineLayout(const MetalDevice &metalDevice, const PipelineLayoutCreateInfo &createInfo)
-        : PipelineLayout(createInfo), MetalResource(createInfo.name), pushConstantSize(createInfo.pushConstantSize)
+        : PipelineLayout(createInfo), MetalResource(createInfo.name)
     {
         uint32 currentBufferIndex = 0;
         uint32 currentTextureIndex = 0;
         uint32 currentSamplerIndex = 0;
 
         // Calculate binding index offsets (indexing on Metal is not supported, so a separate resource for every entry in the array is created)
-        bindings.resize(createInfo.bindings.size() + static_cast<uint32>(createInfo.pushConstantSize > 0));
-        for (uint32 i = 0; i < createInfo.bindings.size(); i++)
+        bindings.resize(GetBindings().size() + static_cast<uint32>(GetPushConstantSize() > 0));
+        for (uint32 i = 0; i < GetBindings().size(); i++)
         {
-            const PipelineBinding &binding = *(createInfo.bindings.begin() + i);
+            const PipelineBinding &binding = GetBindings()[i];
             switch (binding.type)
             {
                 case PipelineBindingType::Undefined:
                 {
-                    SR_ERROR("[Metal]: Cannot create pipeline layout [{0}], as binding [{1}] must not be of type [PipelineBindingType::Undefined]!", GetName(), i);
+                    // Binding indices, which no shader accesses, take up no Metal argument slots
                     break;
                 }
                 case PipelineBindingType::UniformBuffer:
@@ -54,7 +54,22 @@ namespace Sierra
         }
 
         // Push constants range is always the last indexed buffer
-        if (createInfo.pushConstantSize > 0) bindings.back().index = currentBufferIndex;
+        if (GetPushConstantSize() > 0) bindings.back().index = currentBufferIndex;
+
+        // Retain immutable sampler states
+        immutableSamplerStates.resize(GetBindings().size(), nil);
+        for (const PipelineImmutableSampler &immutableSampler : createInfo.immutableSamplers)
+        {
+            SR_ERROR_IF(immutableSampler.sampler->GetAPI() != GraphicsAPI::Metal, "[Metal]: Cannot create pipeline layout [{0}] with immutable sampler [{1}], whose graphics API differs from [GraphicsAPI::Metal]!", GetName(), immutableSampler.sampler->GetName());
+            immutableSamplerStates[immutableSampler.binding] = [static_cast<const MetalSampler&>(*immutableSampler.sampler).GetSamplerState() retain];
+        }
+    }
+
+    /* --- DESTRUCTOR --- */
+
+    MetalPipelineLayout::~MetalPipelineLayout()
+    {
+        for (const id<MTLSamplerState> samplerState : immutableSamplerStates) [samplerState release];
     }
 
 }
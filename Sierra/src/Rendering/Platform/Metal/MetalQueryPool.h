@@ -0,0 +1,49 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "../../QueryPool.h"
+#include "MetalResource.h"
+
+#include "MetalDevice.h"
+
+namespace Sierra
+{
+
+    class SIERRA_API MetalQueryPool final : public QueryPool, public MetalResource
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        MetalQueryPool(const MetalDevice &device, const QueryPoolCreateInfo &createInfo);
+
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] bool GetResults(uint32 firstQuery, uint32 queryCount, std::vector<uint64> &results) const override;
+
+        [[nodiscard]] inline id<MTLBuffer> GetVisibilityResultBuffer() const { return visibilityResultBuffer; }
+        [[nodiscard]] inline id<MTLCounterSampleBuffer> GetCounterSampleBuffer() const { return counterSampleBuffer; }
+
+        /* --- SETTER METHODS --- */
+        // Results only become readable once the command buffer, which last wrote to the pool, has finished
+        inline void SetLastWriteSignalValue(const uint64 signalValue) { lastWriteSignalValue = signalValue; }
+
+        /* --- DESTRUCTOR --- */
+        ~MetalQueryPool() override;
+
+        /* --- CONVERSIONS --- */
+        [[nodiscard]] static id<MTLCounterSet> QueryTypeToCounterSet(id<MTLDevice> device, QueryType queryType);
+
+    private:
+        const MetalDevice &device;
+
+        id<MTLBuffer> visibilityResultBuffer = nil;
+        id<MTLCounterSampleBuffer> counterSampleBuffer = nil;
+        uint64 lastWriteSignalValue = 0;
+
+        MTLTimestamp referenceCPUTimestamp = 0;
+        MTLTimestamp referenceGPUTimestamp = 0;
+
+    };
+
+}
@@ -0,0 +1,140 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "MetalQueryPool.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    MetalQueryPool::MetalQueryPool(const MetalDevice &device, const QueryPoolCreateInfo &createInfo)
+        : QueryPool(createInfo), MetalResource(createInfo.name), device(device)
+    {
+        SR_ERROR_IF(!device.IsQueryTypeSupported(createInfo.type), "[Metal]: Cannot create query pool [{0}] of unsupported type! Make sure to use Device::IsQueryTypeSupported() to query support.", GetName());
+
+        // Occlusion queries are written by render encoders to a plain buffer, one value per query
+        if (createInfo.type == QueryType::Occlusion)
+        {
+            visibilityResultBuffer = [device.GetMetalDevice() newBufferWithLength: createInfo.queryCount * sizeof(uint64) options: MTLResourceStorageModeShared];
+            SR_ERROR_IF(visibilityResultBuffer == nil, "[Metal]: Could not create visibility result buffer of query pool [{0}]!", GetName());
+            device.SetResourceName(visibilityResultBuffer, GetName());
+            return;
+        }
+
+        // Set up counter sample buffer descriptor (pipeline statistics are sampled both at the beginning and the end of every query)
+        MTLCounterSampleBufferDescriptor* const counterSampleBufferDescriptor = [[MTLCounterSampleBufferDescriptor alloc] init];
+        [counterSampleBufferDescriptor setLabel: [NSString stringWithUTF8String: GetName().c_str()]];
+        [counterSampleBufferDescriptor setCounterSet: QueryTypeToCounterSet(device.GetMetalDevice(), createInfo.type)];
+        [counterSampleBufferDescriptor setStorageMode: MTLStorageModeShared];
+        [counterSampleBufferDescriptor setSampleCount: createInfo.type == QueryType::PipelineStatistics ? createInfo.queryCount * 2 : createInfo.queryCount];
+
+        // Create counter sample buffer
+        NSError* error = nil;
+        counterSampleBuffer = [device.GetMetalDevice() newCounterSampleBufferWithDescriptor: counterSampleBufferDescriptor error: &error];
+        SR_ERROR_IF(error != nil, "[Metal]: Could not create query pool [{0}]! Error: {1}.", GetName(), error.description.UTF8String);
+
+        [counterSampleBufferDescriptor release];
+
+        // GPU timestamps are in an unspecified unit, so they are later correlated to CPU ones, which are in nanoseconds
+        if (createInfo.type == QueryType::Timestamp) [device.GetMetalDevice() sampleTimestamps: &referenceCPUTimestamp gpuTimestamp: &referenceGPUTimestamp];
+    }
+
+    /* --- GETTER METHODS --- */
+
+    bool MetalQueryPool::GetResults(const uint32 firstQuery, uint32 queryCount, std::vector<uint64> &results) const
+    {
+        queryCount = queryCount != 0 ? queryCount : GetQueryCount() - firstQuery;
+        SR_ERROR_IF(firstQuery + queryCount > GetQueryCount(), "[Metal]: Cannot get results of queries [{0}-{1}] of query pool [{2}], as they exceed its query count - [{3}]!", firstQuery, firstQuery + queryCount - 1, GetName(), GetQueryCount());
+
+        // Results are not available until the command buffer writing them has completed
+        if (device.GetCompletedSignalValue() < lastWriteSignalValue) return false;
+
+        switch (GetType())
+        {
+            case QueryType::Occlusion:
+            {
+                results.resize(queryCount);
+                std::memcpy(results.data(), reinterpret_cast<const uint64*>([visibilityResultBuffer contents]) + firstQuery, queryCount * sizeof(uint64));
+                return true;
+            }
+            case QueryType::PipelineStatistics:
+            {
+                NSData* const data = [counterSampleBuffer resolveCounterRange: NSMakeRange(firstQuery * 2, queryCount * 2)];
+                if (data == nil) return false;
+
+                // Metal does not count input assembly, so vertex shader invocations and clipper invocations are reported instead
+                const MTLCounterResultStatistic* const samples = reinterpret_cast<const MTLCounterResultStatistic*>(data.bytes);
+                results.resize(static_cast<uint64>(queryCount) * PIPELINE_STATISTIC_COUNT);
+                for (uint32 i = 0; i < queryCount; i++)
+                {
+                    const MTLCounterResultStatistic &begin = samples[i * 2];
+                    const MTLCounterResultStatistic &end = samples[i * 2 + 1];
+
+                    const QueryPipelineStatistics statistics
+                    {
+                        .inputAssemblyVertexCount = end.vertexInvocations - begin.vertexInvocations,
+                        .inputAssemblyPrimitiveCount = end.clipperInvocations - begin.clipperInvocations,
+                        .vertexShaderInvocationCount = end.vertexInvocations - begin.vertexInvocations,
+                        .clippingInvocationCount = end.clipperInvocations - begin.clipperInvocations,
+                        .clippingPrimitiveCount = end.clipperPrimitivesOut - begin.clipperPrimitivesOut,
+                        .fragmentShaderInvocationCount = end.fragmentInvocations - begin.fragmentInvocations,
+                        .computeShaderInvocationCount = end.computeKernelInvocations - begin.computeKernelInvocations
+                    };
+                    std::memcpy(results.data() + static_cast<uint64>(i) * PIPELINE_STATISTIC_COUNT, &statistics, sizeof(QueryPipelineStatistics));
+                }
+                return true;
+            }
+            case QueryType::Timestamp:
+            {
+                NSData* const data = [counterSampleBuffer resolveCounterRange: NSMakeRange(firstQuery, queryCount)];
+                if (data == nil) return false;
+
+                // Convert GPU timestamps to nanoseconds, using the rate at which both clocks have advanced since the pool's creation
+                MTLTimestamp currentCPUTimestamp = 0;
+                MTLTimestamp currentGPUTimestamp = 0;
+                [device.GetMetalDevice() sampleTimestamps: &currentCPUTimestamp gpuTimestamp: &currentGPUTimestamp];
+                const float64 nanosecondsPerTick = currentGPUTimestamp > referenceGPUTimestamp ? static_cast<float64>(currentCPUTimestamp - referenceCPUTimestamp) / static_cast<float64>(currentGPUTimestamp - referenceGPUTimestamp) : 1.0;
+
+                const MTLCounterResultTimestamp* const samples = reinterpret_cast<const MTLCounterResultTimestamp*>(data.bytes);
+                results.resize(queryCount);
+                for (uint32 i = 0; i < queryCount; i++)
+                {
+                    results[i] = referenceCPUTimestamp + static_cast<uint64>(static_cast<float64>(samples[i].timestamp - referenceGPUTimestamp) * nanosecondsPerTick);
+                }
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /* --- DESTRUCTOR --- */
+
+    MetalQueryPool::~MetalQueryPool()
+    {
+        if (visibilityResultBuffer != nil) [visibilityResultBuffer release];
+        if (counterSampleBuffer != nil) [counterSampleBuffer release];
+    }
+
+    /* --- CONVERSIONS --- */
+
+    id<MTLCounterSet> MetalQueryPool::QueryTypeToCounterSet(const id<MTLDevice> device, const QueryType queryType)
+    {
+        NSString* counterSetName = nil;
+        switch (queryType)
+        {
+            case QueryType::Occlusion:                  return nil;
+            case QueryType::PipelineStatistics:         counterSetName = MTLCommonCounterSetStatistic; break;
+            case QueryType::Timestamp:                  counterSetName = MTLCommonCounterSetTimestamp; break;
+        }
+
+        for (const id<MTLCounterSet> counterSet in device.counterSets)
+        {
+            if ([counterSet.name isEqualToString: counterSetName]) return counterSet;
+        }
+        return nil;
+    }
+
+}
@@ -71,7 +71,9 @@ namespace Sierra
                         SR_ERROR_IF(renderTarget.resolveImage->get()->GetAPI() != GraphicsAPI::Metal, "[Metal]: Could not use image [{0}] of attachment [{1}] in render pass [{2}] for resolving, as its graphics API differs from [GraphicsAPI::Metal]!", renderTarget.resolveImage->get()->GetName(), renderTargetIndex, GetName());
                         const MetalImage &metalResolveImage = static_cast<MetalImage&>(*renderTarget.resolveImage->get());
 
-                        [colorAttachment setStoreAction: renderTarget.storeOperation == RenderPassAttachmentStoreOperation::Store ? MTLStoreActionStoreAndMultisampleResolve : MTLStoreActionDontCare];
+                        // Memoryless (transient) textures cannot be stored, so only their resolved result is
+                        if (renderTarget.storeOperation == RenderPassAttachmentStoreOperation::Store) [colorAttachment setStoreAction: metalImage.GetUsage() & ImageUsage::TransientAttachment ? MTLStoreActionMultisampleResolve : MTLStoreActionStoreAndMultisampleResolve];
+                        else [colorAttachment setStoreAction: MTLStoreActionDontCare];
                         [colorAttachment setResolveTexture: metalResolveImage.GetMetalTexture()];  // NOTE: We assign texture here, even though it will be overwritten at Begin(), so that pipeline can query its pixel format
                     }
 
@@ -120,6 +122,7 @@ namespace Sierra
         {
             case RenderPassAttachmentLoadOperation::Clear:        return MTLLoadActionClear;
             case RenderPassAttachmentLoadOperation::Load:         return MTLLoadActionLoad;
+            case RenderPassAttachmentLoadOperation::DontCare:     return MTLLoadActionDontCare;
         }
 
         return MTLLoadActionDontCare;
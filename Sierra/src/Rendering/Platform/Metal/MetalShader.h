@@ -18,6 +18,10 @@ namespace Sierra
         /* --- CONSTRUCTORS --- */
         MetalShader(const MetalDevice &device, const ShaderCreateInfo &createInfo);
 
+        /* --- POLLING METHODS --- */
+        // Returns a retained entry function, specialized with the given function constants, which the caller must release
+        [[nodiscard]] id<MTLFunction> CreateEntryFunction(const std::initializer_list<ShaderConstant> &shaderConstants) const;
+
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline id<MTLFunction> GetEntryFunction() const { return entryFunction; }
 
@@ -25,6 +29,7 @@ namespace Sierra
         ~MetalShader() override;
 
     private:
+        id<MTLLibrary> library = nil;
         id<MTLFunction> entryFunction = nil;
 
     };
@@ -13,24 +13,75 @@ namespace Sierra
         : Shader(createInfo), MetalResource(createInfo.name)
     {
         #if SR_PLATFORM_macOS
-            const std::filesystem::path shaderLibraryFilePath = createInfo.shaderBundlePath / "shader.macos.metallib";
+            constexpr std::string_view SHADER_LIBRARY_FILE_NAME = "shader.macos.metallib";
         #elif SR_PLATFORM_iOS && !SR_PLATFORM_EMULATOR
-            const std::filesystem::path shaderLibraryFilePath = createInfo.shaderBundlePath / "shader.ios.metallib";
+            constexpr std::string_view SHADER_LIBRARY_FILE_NAME = "shader.ios.metallib";
         #elif SR_PLATFORM_iOS && SR_PLATFORM_EMULATOR
-            const std::filesystem::path shaderLibraryFilePath = createInfo.shaderBundlePath / "shader.ios-simulator.metallib";
+            constexpr std::string_view SHADER_LIBRARY_FILE_NAME = "shader.ios-simulator.metallib";
         #endif
 
-        SR_ERROR_IF(!File::FileExists(shaderLibraryFilePath), "[Metal]: Could not load Metal library from shader bundle [{0}]! Verify its presence and try again.", createInfo.shaderBundlePath.string().c_str());
+        // Embedded and archived libraries are loaded from memory
+        ShaderMemory libraryMemory = createInfo.metalLibraryMemory;
+        if (libraryMemory.data == nullptr && createInfo.shaderArchive != nullptr)
+        {
+            libraryMemory = createInfo.shaderArchive->GetFileMemory(createInfo.shaderBundlePath.generic_string(), SHADER_LIBRARY_FILE_NAME);
+            SR_ERROR_IF(libraryMemory.data == nullptr, "[Metal]: Could not load Metal library of shader bundle [{0}] from its shader archive! Verify its presence and try again.", createInfo.shaderBundlePath.string().c_str());
+        }
 
-        // Load library
         NSError* error = nil;
-        const id<MTLLibrary> library = [device.GetMetalDevice() newLibraryWithURL: [NSURL fileURLWithPath: [NSString stringWithCString: shaderLibraryFilePath.string().c_str() encoding: NSASCIIStringEncoding]] error: &error];
-        SR_ERROR_IF(error != nil, "Could not load Metal shader library [{0} - {1}]! Error: {2}.", GetName(), shaderLibraryFilePath.string().c_str(), error.description.UTF8String);
+        if (libraryMemory.data != nullptr)
+        {
+            // Load library from memory (data is copied, as it only needs to stay valid until creation returns)
+            const dispatch_data_t libraryData = dispatch_data_create(libraryMemory.data, libraryMemory.memorySize, nil, DISPATCH_DATA_DESTRUCTOR_DEFAULT);
+            library = [device.GetMetalDevice() newLibraryWithData: libraryData error: &error];
+            dispatch_release(libraryData);
+            SR_ERROR_IF(error != nil, "[Metal]: Could not load Metal shader library of shader [{0}] from memory! Error: {1}.", GetName(), error.description.UTF8String);
+        }
+        else
+        {
+            const std::filesystem::path shaderLibraryFilePath = createInfo.shaderBundlePath / SHADER_LIBRARY_FILE_NAME;
+            SR_ERROR_IF(createInfo.shaderBundlePath.empty() || !File::FileExists(shaderLibraryFilePath), "[Metal]: Could not load Metal library from shader bundle [{0}]! Verify its presence and try again.", createInfo.shaderBundlePath.string().c_str());
+
+            // Load library (Metal reads the file itself, so no copy of it is made)
+            library = [device.GetMetalDevice() newLibraryWithURL: [NSURL fileURLWithPath: [NSString stringWithCString: shaderLibraryFilePath.string().c_str() encoding: NSASCIIStringEncoding]] error: &error];
+            SR_ERROR_IF(error != nil, "Could not load Metal shader library [{0} - {1}]! Error: {2}.", GetName(), shaderLibraryFilePath.string().c_str(), error.description.UTF8String);
+        }
         device.SetResourceName(library, GetName());
 
-        // Load entry point
+        // Load entry point (library is kept, so the function can later be specialized with constants)
         entryFunction = [library newFunctionWithName: @"main0"];
-        [library release];
+
+        // Resources are reflected from the SPIR-V, which the Metal library was cross-compiled from
+        std::optional<MappedFile> mappedSpirvFile = std::nullopt;
+        const ShaderMemory spirvMemory = createInfo.spirvMemory.data != nullptr ? createInfo.spirvMemory : LoadBundleFile(createInfo, "shader.spv", mappedSpirvFile);
+        if (spirvMemory.data != nullptr) Reflect(static_cast<const uint32*>(spirvMemory.data), spirvMemory.memorySize / sizeof(uint32));
+    }
+
+    /* --- POLLING METHODS --- */
+
+    id<MTLFunction> MetalShader::CreateEntryFunction(const std::initializer_list<ShaderConstant> &shaderConstants) const
+    {
+        if (shaderConstants.size() == 0) return [entryFunction retain];
+
+        // SPIRV-Cross emits every specialization constant as a function constant, whose index matches its constant ID
+        MTLFunctionConstantValues* const constantValues = [[MTLFunctionConstantValues alloc] init];
+        for (const ShaderConstant &shaderConstant : shaderConstants)
+        {
+            switch (shaderConstant.type)
+            {
+                case ShaderConstantType::Bool:          { [constantValues setConstantValue: &shaderConstant.value.boolValue type: MTLDataTypeBool atIndex: shaderConstant.constantID]; break; }
+                case ShaderConstantType::Int32:         { [constantValues setConstantValue: &shaderConstant.value.int32Value type: MTLDataTypeInt atIndex: shaderConstant.constantID]; break; }
+                case ShaderConstantType::UInt32:        { [constantValues setConstantValue: &shaderConstant.value.uint32Value type: MTLDataTypeUInt atIndex: shaderConstant.constantID]; break; }
+                case ShaderConstantType::Float32:       { [constantValues setConstantValue: &shaderConstant.value.float32Value type: MTLDataTypeFloat atIndex: shaderConstant.constantID]; break; }
+            }
+        }
+
+        NSError* error = nil;
+        const id<MTLFunction> specializedFunction = [library newFunctionWithName: @"main0" constantValues: constantValues error: &error];
+        SR_ERROR_IF(error != nil, "[Metal]: Could not specialize entry function of shader [{0}]! Error: {1}.", GetName(), error.description.UTF8String);
+
+        [constantValues release];
+        return specializedFunction;
     }
 
     /* --- DESTRUCTOR --- */
@@ -38,6 +89,7 @@ namespace Sierra
     MetalShader::~MetalShader()
     {
         [entryFunction release];
+        [library release];
     }
 
 }
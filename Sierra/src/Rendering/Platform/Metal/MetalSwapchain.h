@@ -22,13 +22,14 @@ namespace Sierra
         /* --- POLLING METHODS --- */
         void AcquireNextImage() override;
         void Present(std::unique_ptr<CommandBuffer> &commandBuffer) override;
+        bool WaitForPreviousPresent(uint64 timeoutInNanoseconds = std::numeric_limits<uint64>::max()) const override;
 
         /* -- GETTER METHODS --- */
         [[nodiscard]] inline uint32 GetCurrentFrame() const override { return currentFrame; }
-        [[nodiscard]] inline uint32 GetConcurrentFrameCount() const override { return CONCURRENT_FRAME_COUNT; }
+        [[nodiscard]] inline uint32 GetConcurrentFrameCount() const override { return concurrentFrameCount; }
 
         [[nodiscard]] inline const std::unique_ptr<Image>& GetCurrentImage() const override { return swapchainImage; };
-        [[nodiscard]] inline const std::unique_ptr<Image>& GetImage(const uint32 frameIndex) const override { SR_ERROR_IF(frameIndex >= CONCURRENT_FRAME_COUNT, "[Metal]: Cannot return image with an index [{0}] of swapchain [{1}], as index is out of bounds! Use Swapchain::GetConcurrentFrameCount() to query image count.", frameIndex, GetName()); return swapchainImage; };
+        [[nodiscard]] inline const std::unique_ptr<Image>& GetImage(const uint32 frameIndex) const override { SR_ERROR_IF(frameIndex >= concurrentFrameCount, "[Metal]: Cannot return image with an index [{0}] of swapchain [{1}], as index is out of bounds! Use Swapchain::GetConcurrentFrameCount() to query image count.", frameIndex, GetName()); return swapchainImage; };
 
         /* --- DESTRUCTOR --- */
         ~MetalSwapchain() override = default;
@@ -43,8 +44,13 @@ namespace Sierra
         std::unique_ptr<Image> swapchainImage;
         dispatch_semaphore_t isFrameRenderedSemaphores = nil;
 
+        mutable std::mutex presentMutex;
+        mutable std::condition_variable presentCondition;
+        uint64 presentCount = 0;
+        uint64 displayedPresentCount = 0;
+
+        uint32 concurrentFrameCount = 0;
         uint32 currentFrame = 0;
-        constexpr static NSUInteger CONCURRENT_FRAME_COUNT = 3;
         void Recreate();
 
     };
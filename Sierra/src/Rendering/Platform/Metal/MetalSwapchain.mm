@@ -20,8 +20,10 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     MetalSwapchain::MetalSwapchain(const MetalDevice &device, const SwapchainCreateInfo &createInfo)
-        : Swapchain(createInfo), MetalResource(createInfo.name), device(device), window(*createInfo.window)
+        : Swapchain(createInfo), MetalResource(createInfo.name), device(device), window(*createInfo.window), concurrentFrameCount(createInfo.maxQueuedFrameCount)
     {
+        SR_ERROR_IF(createInfo.maxQueuedFrameCount == 0, "[Metal]: Cannot create swapchain [{0}] with a max queued frame count of [0]!", GetName());
+
         #if SR_PLATFORM_macOS
             SR_ERROR_IF(window.GetAPI() != PlatformAPI::Cocoa, "[Metal]: Cannot create Metal swapchain [{0}] for window [{1}], because its platform API does not match [PlatformAPI::Cocoa]!", GetName(), window.GetTitle());
             const CocoaWindow &cocoaWindow = static_cast<const CocoaWindow&>(window);
@@ -42,7 +44,7 @@ namespace Sierra
 
         // Configure Metal layer
         [metalLayer setDevice: (__bridge id<MTLDevice>) device.GetMetalDevice()];
-        [metalLayer setMaximumDrawableCount: CONCURRENT_FRAME_COUNT];
+        [metalLayer setMaximumDrawableCount: std::clamp(concurrentFrameCount, 2U, 3U)]; // Only 2 or 3 drawables are allowed
         [metalLayer setDrawsAsynchronously: YES];
         [metalLayer setDrawableSize: CGSizeMake(window.GetFramebufferSize().x, window.GetFramebufferSize().y)];
         switch (createInfo.preferredImageMemoryType) // These formats are guaranteed to be supported
@@ -52,7 +54,8 @@ namespace Sierra
             case SwapchainImageMemoryType::UNorm16:     { [metalLayer setPixelFormat: MTLPixelFormatRGBA16Float];      break; }
         }
         #if SR_PLATFORM_macOS
-            [metalLayer setDisplaySyncEnabled:createInfo.preferredPresentationMode == SwapchainPresentationMode::VSync]; // This is only present on macOS
+            // Metal has no notion of mailbox or relaxed presentation, so they fall back to VSync (only immediate presentation can disable it, and that is only possible on macOS)
+            [metalLayer setDisplaySyncEnabled: createInfo.preferredPresentationMode != SwapchainPresentationMode::Immediate];
         #endif
 
         #if SR_PLATFORM_macOS
@@ -71,7 +74,7 @@ namespace Sierra
         }));
 
         // Create sync objects
-        isFrameRenderedSemaphores = dispatch_semaphore_create(CONCURRENT_FRAME_COUNT);
+        isFrameRenderedSemaphores = dispatch_semaphore_create(concurrentFrameCount);
 
         // Handle resizing
         createInfo.window->OnEvent<WindowResizeEvent>([this](const WindowResizeEvent &event)
@@ -116,7 +119,17 @@ namespace Sierra
         const id<MTLCommandBuffer> presentationCommandBuffer = [device.GetCommandQueue() commandBuffer];
         device.SetResourceName(presentationCommandBuffer, "Presentation command buffer of swapchain [" + GetName() + "]");
         [presentationCommandBuffer encodeWaitForEvent: device.GetSharedSignalSemaphore() value: metalCommandBuffer.GetCompletionSignalValue()];
+        [metalDrawable addPresentedHandler: ^(id<MTLDrawable>)
+        {
+            // Notify threads waiting for the frame to be displayed
+            {
+                std::lock_guard lock(presentMutex);
+                displayedPresentCount++;
+            }
+            presentCondition.notify_all();
+        }];
         [presentationCommandBuffer presentDrawable: metalDrawable];
+        presentCount++;
         [presentationCommandBuffer addCompletedHandler: ^(id<MTLCommandBuffer> executedCommandBuffer)
         {
             dispatch_semaphore_signal(isFrameRenderedSemaphores);
@@ -127,7 +140,20 @@ namespace Sierra
         [presentationCommandBuffer commit];
 
         // Increment current frame
-        currentFrame = (currentFrame + 1) % CONCURRENT_FRAME_COUNT;
+        currentFrame = (currentFrame + 1) % concurrentFrameCount;
+    }
+
+    bool MetalSwapchain::WaitForPreviousPresent(const uint64 timeoutInNanoseconds) const
+    {
+        std::unique_lock lock(presentMutex);
+        const auto IsPreviousFrameDisplayed = [this] { return displayedPresentCount >= presentCount; };
+
+        if (timeoutInNanoseconds == std::numeric_limits<uint64>::max())
+        {
+            presentCondition.wait(lock, IsPreviousFrameDisplayed);
+            return true;
+        }
+        return presentCondition.wait_for(lock, std::chrono::nanoseconds(timeoutInNanoseconds), IsPreviousFrameDisplayed);
     }
 
     /* --- PRIVATE METHODS --- */
@@ -10,8 +10,11 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     VulkanBuffer::VulkanBuffer(const VulkanDevice &device, const BufferCreateInfo &createInfo)
-        : Buffer(createInfo), VulkanResource(createInfo.name), device(device), usageFlags(BufferUsageToVkBufferUsageFlags(createInfo.usage)), memorySize(createInfo.memorySize)
+        : Buffer(createInfo), VulkanResource(createInfo.name), device(device), usageFlags(BufferUsageToVkBufferUsageFlags(createInfo.usage)), memorySize(createInfo.memorySize), memoryCategory(createInfo.memoryCategory)
     {
+        // GPU buffers may get moved around by the defragmenter, which copies their memory over
+        if (createInfo.memoryLocation == BufferMemoryLocation::GPU) usageFlags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
         // Set up buffer create info
         VkBufferCreateInfo bufferCreateInfo = { };
         bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -19,19 +22,26 @@ namespace Sierra
         bufferCreateInfo.usage = usageFlags;
         bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-        // Set up buffer allocation info
+        // Set up buffer allocation info (only CPU buffers are mapped, so GPU ones get placed in device-local, movable blocks)
+        allocationOwner.buffer = this;
         VmaAllocationCreateInfo allocationCreateInfo = { };
-        allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT;
+        allocationCreateInfo.flags = createInfo.memoryLocation == BufferMemoryLocation::CPU ? VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT : 0;
+        allocationCreateInfo.pUserData = &allocationOwner;
         allocationCreateInfo.usage = BufferMemoryLocationToVmaMemoryUsage(createInfo.memoryLocation);
         allocationCreateInfo.memoryTypeBits = std::numeric_limits<uint32>::max();
         allocationCreateInfo.memoryTypeBits = 0;
         allocationCreateInfo.priority = 0.5f;
 
         // Create and allocate buffer
-        const VkResult result = vmaCreateBuffer(device.GetMemoryAllocator(), &bufferCreateInfo, &allocationCreateInfo, &buffer, &allocation, nullptr);
+        VmaAllocationInfo allocationInfo = { };
+        const VkResult result = vmaCreateBuffer(device.GetMemoryAllocator(), &bufferCreateInfo, &allocationCreateInfo, &buffer, &allocation, &allocationInfo);
         SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Failed to create buffer [{0}]! Error code: {1}.", GetName(), result);
         device.SetObjectName(buffer, VK_OBJECT_TYPE_BUFFER, GetName());
 
+        // Account for allocated memory
+        allocatedMemorySize = allocationInfo.size;
+        device.TrackMemoryAllocation(memoryCategory, allocatedMemorySize);
+
         // Map and reset memory if CPU-visible
         if (createInfo.memoryLocation == BufferMemoryLocation::CPU)
         {
@@ -51,11 +61,29 @@ namespace Sierra
         vmaFlushAllocation(device.GetMemoryAllocator(), allocation, destinationByteOffset, memoryRange);
     }
 
+    /* --- GETTER METHODS --- */
+
+    const void* VulkanBuffer::GetData() const
+    {
+        // Make sure writes done by the GPU are visible, should memory not be host-coherent
+        if (data != nullptr) vmaInvalidateAllocation(device.GetMemoryAllocator(), allocation, 0, VK_WHOLE_SIZE);
+        return data;
+    }
+
     /* --- DESTRUCTOR --- */
 
     VulkanBuffer::~VulkanBuffer()
     {
-        if (allocation != VK_NULL_HANDLE) vmaUnmapMemory(device.GetMemoryAllocator(), allocation);
+        device.UntrackMemoryAllocation(memoryCategory, allocatedMemorySize);
+        if (data != nullptr) vmaUnmapMemory(device.GetMemoryAllocator(), allocation);
+
+        // Memory, which is being moved, is freed by the defragmenter once it finishes the move
+        if (allocationOwner.pendingMove != nullptr)
+        {
+            allocationOwner.pendingMove->operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_DESTROY;
+            device.GetFunctionTable().vkDestroyBuffer(device.GetLogicalDevice(), buffer, nullptr);
+            return;
+        }
         vmaDestroyBuffer(device.GetMemoryAllocator(), buffer, allocation);
     }
 
@@ -9,6 +9,7 @@
 
 #include <vk_mem_alloc.h>
 #include "VulkanDevice.h"
+#include "VulkanDefragmenter.h"
 
 namespace Sierra
 {
@@ -23,7 +24,7 @@ namespace Sierra
         void CopyFromMemory(const void* memoryPointer, uint64 memoryRange = 0, uint64 sourceByteOffset = 0, uint64 destinationByteOffset = 0) override;
 
         /* --- GETTER METHODS --- */
-        [[nodiscard]] inline const void* GetData() const override { return data; }
+        [[nodiscard]] const void* GetData() const override;
         [[nodiscard]] inline uint64 GetMemorySize() const override { return memorySize; }
 
         [[nodiscard]] inline VkBuffer GetVulkanBuffer() const { return buffer; }
@@ -46,6 +47,12 @@ namespace Sierra
         void* data = nullptr;
         uint64 memorySize = 0;
 
+        std::string memoryCategory;
+        uint64 allocatedMemorySize = 0;
+
+        friend class VulkanDefragmenter;
+        VulkanAllocationOwner allocationOwner = { };
+
     };
 
 }
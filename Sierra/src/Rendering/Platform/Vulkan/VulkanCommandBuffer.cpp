@@ -7,8 +7,10 @@
 #include "VulkanBuffer.h"
 #include "VulkanImage.h"
 #include "VulkanSampler.h"
+#include "VulkanQueryPool.h"
 
 #include "VulkanRenderPass.h"
+#include "VulkanMipMapGenerator.h"
 
 namespace Sierra
 {
@@ -51,6 +53,7 @@ namespace Sierra
         // Free queued resources
         queuedBuffers = std::queue<std::unique_ptr<Buffer>>();
         queuedImages = std::queue<std::unique_ptr<Image>>();
+        pushConstantData.clear();
 
         // Reset command buffer
         device.GetFunctionTable().vkResetCommandPool(device.GetLogicalDevice(), commandPool, 0);
@@ -66,6 +69,7 @@ namespace Sierra
 
         // Get new code
         completionSignalValue = device.GetNewSignalValue();
+        recordedImageLayouts.clear();
     }
 
     void VulkanCommandBuffer::End()
@@ -102,7 +106,7 @@ namespace Sierra
     void VulkanCommandBuffer::SynchronizeImageUsage(const std::unique_ptr<Image> &image, const ImageCommandUsage previousUsage, const ImageCommandUsage nextUsage, const uint32 baseMipLevel, const uint32 mipLevelCount, const uint32 baseLayer, uint32 layerCount)
     {
         SR_ERROR_IF(image->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Could not synchronize usage of image [{0}] within command buffer [{1}], as its graphics API differs from [GraphicsAPI::Vulkan]!", image->GetName(), GetName());
-        const VulkanImage &vulkanImage = static_cast<VulkanImage&>(*image);
+        VulkanImage &vulkanImage = static_cast<VulkanImage&>(*image);
 
         SR_ERROR_IF(nextUsage == ImageCommandUsage::None, "[Vulkan]: Cannot synchronize image [{0}], as specified next usage must not be ImageCommandUsage::None!", image->GetName());
 
@@ -125,11 +129,21 @@ namespace Sierra
         pipelineBarrier.subresourceRange.baseArrayLayer = baseLayer;
         pipelineBarrier.subresourceRange.layerCount = layerCount != 0 ? layerCount : image->GetLayerCount() - baseLayer;
 
+        // Images of offscreen swapchains cannot be presented (nor is the swapchain extension loaded in headless contexts), so they are left ready for reading back instead
+        if (!vulkanImage.IsSwapchainImage())
+        {
+            if (pipelineBarrier.oldLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR) pipelineBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            if (pipelineBarrier.newLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR) pipelineBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        }
+
         SR_ERROR_IF(baseMipLevel + pipelineBarrier.subresourceRange.levelCount > image->GetMipLevelCount(), "[Vulkan]: Cannot synchronize mip levels [{0}-{1}] of image [{2}] within command buffer [{3}], as they exceed image's mip level count - [{4}]!", baseMipLevel, baseMipLevel + mipLevelCount - 1, image->GetName(), GetName(), image->GetMipLevelCount());
         SR_ERROR_IF(baseLayer + pipelineBarrier.subresourceRange.layerCount > image->GetLayerCount(), "[Vulkan]: Cannot synchronize layers [{0}-{1}] of image [{2}] within command buffer [{3}], as they exceed image's layer count - [{4}]!", baseLayer, baseLayer + layerCount - 1, image->GetName(), GetName(), image->GetLayerCount());
 
         // Bind barrier
         device.GetFunctionTable().vkCmdPipelineBarrier(commandBuffer, ImageCommandUsageToVkPipelineStageFlags(previousUsage), ImageCommandUsageToVkPipelineStageFlags(nextUsage), 0, 0, nullptr, 0, nullptr, 1, &pipelineBarrier);
+        // Keep track of image's layout, so it can later be moved around in memory (applied on submission, as that is when the GPU will actually get to it)
+        const bool wholeImageSynchronized = pipelineBarrier.subresourceRange.levelCount == image->GetMipLevelCount() && pipelineBarrier.subresourceRange.layerCount == image->GetLayerCount();
+        recordedImageLayouts.emplace_back(&vulkanImage, wholeImageSynchronized ? pipelineBarrier.newLayout : VK_IMAGE_LAYOUT_MAX_ENUM);
     }
 
     void VulkanCommandBuffer::CopyBufferToBuffer(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Buffer> &destinationBuffer, const uint64 memoryRange, const uint64 sourceByteOffset, const uint64 destinationByteOffset)
@@ -153,6 +167,11 @@ namespace Sierra
     }
 
     void VulkanCommandBuffer::CopyBufferToImage(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Image> &destinationImage, const uint32 mipLevel, const Vector2UInt &pixelRange, const uint32 layer, const uint64 sourceByteOffset, const Vector2UInt &destinationPixelOffset)
+    {
+        CopyBufferToImageRegions(sourceBuffer, destinationImage, { { .sourceByteOffset = sourceByteOffset, .mipLevel = mipLevel, .layer = layer, .pixelRange = pixelRange, .destinationPixelOffset = destinationPixelOffset } });
+    }
+
+    void VulkanCommandBuffer::CopyBufferToImageRegions(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Image> &destinationImage, const std::vector<BufferImageCopyRegion> &regions)
     {
         SR_ERROR_IF(sourceBuffer->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Could not copy from buffer [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], to image [{1}] within command buffer [{2}]!", sourceBuffer->GetName(), destinationImage->GetName(), GetName());
         const VulkanBuffer &vulkanSourceBuffer = static_cast<VulkanBuffer&>(*sourceBuffer);
@@ -160,39 +179,122 @@ namespace Sierra
         SR_ERROR_IF(destinationImage->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Could not from buffer [{0}] to image [{1}], graphics API differs from [GraphicsAPI::Vulkan], within command buffer [{2}]!", sourceBuffer->GetName(), destinationImage->GetName(), GetName());
         const VulkanImage &vulkanDestinationImage = static_cast<VulkanImage&>(*destinationImage);
 
-        SR_ERROR_IF(mipLevel >= destinationImage->GetMipLevelCount(), "[Vulkan]: Cannot copy from buffer [{0}] to mip level [{1}] of image [{2}] within command buffer [{3}], as image does not contain it!", sourceBuffer->GetName(), mipLevel, destinationImage->GetName(), GetName());
-        SR_ERROR_IF(layer >= destinationImage->GetLayerCount(), "[Vulkan]: Cannot copy from buffer [{0}] to layer [{1}] of image [{2}] within command buffer [{3}], as image does not contain it!", sourceBuffer->GetName(), layer, destinationImage->GetName(), GetName());
+        SR_ERROR_IF(regions.empty(), "[Vulkan]: Cannot copy from buffer [{0}] to image [{1}] within command buffer [{2}], as no copy regions were specified!", sourceBuffer->GetName(), destinationImage->GetName(), GetName());
+        const uint32 blockExtent = destinationImage->GetBlockExtent();
+
+        std::vector<VkBufferImageCopy> copyRegions;
+        copyRegions.reserve(regions.size());
+        for (const BufferImageCopyRegion &region : regions)
+        {
+            SR_ERROR_IF(region.mipLevel >= destinationImage->GetMipLevelCount(), "[Vulkan]: Cannot copy from buffer [{0}] to mip level [{1}] of image [{2}] within command buffer [{3}], as image does not contain it!", sourceBuffer->GetName(), region.mipLevel, destinationImage->GetName(), GetName());
+            SR_ERROR_IF(region.layer >= destinationImage->GetLayerCount(), "[Vulkan]: Cannot copy from buffer [{0}] to layer [{1}] of image [{2}] within command buffer [{3}], as image does not contain it!", sourceBuffer->GetName(), region.layer, destinationImage->GetName(), GetName());
+
+            // Determine copied extent (compressed images are copied in whole blocks, so the region must be block-aligned, unless it reaches the edge of the mip level)
+            const Vector2UInt mipLevelExtent = { std::max(destinationImage->GetWidth() >> region.mipLevel, 1U), std::max(destinationImage->GetHeight() >> region.mipLevel, 1U) };
+            const Vector2UInt copyExtent = { region.pixelRange.x != 0 ? region.pixelRange.x : mipLevelExtent.x, region.pixelRange.y != 0 ? region.pixelRange.y : mipLevelExtent.y };
+            const Vector2UInt &destinationPixelOffset = region.destinationPixelOffset;
+
+            SR_ERROR_IF(destinationPixelOffset.x + copyExtent.x > mipLevelExtent.x || destinationPixelOffset.y + copyExtent.y > mipLevelExtent.y, "[Vulkan]: Cannot copy from buffer [{0}] pixel range [{1}x{2}], which is offset by another [{3}x{4}] pixels to image [{5}] within command buffer [{6}], as resulting pixel range of a total of [{7}x{8}] pixels exceeds the dimensions of mip level [{9}] - [{10}x{11}]!", sourceBuffer->GetName(), copyExtent.x, copyExtent.y, destinationPixelOffset.x, destinationPixelOffset.y, destinationImage->GetName(), GetName(), destinationPixelOffset.x + copyExtent.x, destinationPixelOffset.y + copyExtent.y, region.mipLevel, mipLevelExtent.x, mipLevelExtent.y);
+            SR_ERROR_IF(destinationPixelOffset.x % blockExtent != 0 || destinationPixelOffset.y % blockExtent != 0 || (copyExtent.x % blockExtent != 0 && destinationPixelOffset.x + copyExtent.x != mipLevelExtent.x) || (copyExtent.y % blockExtent != 0 && destinationPixelOffset.y + copyExtent.y != mipLevelExtent.y), "[Vulkan]: Cannot copy from buffer [{0}] pixel range [{1}x{2}], which is offset by another [{3}x{4}] pixels, to image [{5}] within command buffer [{6}], as it is not aligned to the image's compression block extent of [{7}x{7}]!", sourceBuffer->GetName(), copyExtent.x, copyExtent.y, destinationPixelOffset.x, destinationPixelOffset.y, destinationImage->GetName(), GetName(), blockExtent);
+
+            const uint64 copyMemorySize = ImageFormatToRegionMemorySize(destinationImage->GetFormat(), copyExtent.x, copyExtent.y);
+            SR_ERROR_IF(region.sourceByteOffset + copyMemorySize > sourceBuffer->GetMemorySize(), "[Vulkan]: Cannot copy from buffer [{0}] pixel range [{1}x{2}], which is offset by another [{3}] bytes, to image [{4}], as total memory range [{5}] overflows that of the buffer - [{6}]!", sourceBuffer->GetName(), copyExtent.x, copyExtent.y, region.sourceByteOffset, destinationImage->GetName(), region.sourceByteOffset + copyMemorySize, sourceBuffer->GetMemorySize());
+            SR_ERROR_IF(region.sourceByteOffset % destinationImage->GetBlockMemorySize() != 0, "[Vulkan]: Cannot copy from buffer [{0}], at byte offset [{1}], to image [{2}] within command buffer [{3}], as offset must be a multiple of the image's block memory size - [{4}]!", sourceBuffer->GetName(), region.sourceByteOffset, destinationImage->GetName(), GetName(), destinationImage->GetBlockMemorySize());
+
+            // Set copy region (buffer dimensions are in texels, but must span whole blocks)
+            VkBufferImageCopy &copyRegion = copyRegions.emplace_back();
+            copyRegion.bufferOffset = region.sourceByteOffset;
+            copyRegion.bufferRowLength = (copyExtent.x + blockExtent - 1) / blockExtent * blockExtent;
+            copyRegion.bufferImageHeight = (copyExtent.y + blockExtent - 1) / blockExtent * blockExtent;
+            copyRegion.imageSubresource.aspectMask = vulkanDestinationImage.GetVulkanAspectFlags();
+            copyRegion.imageSubresource.mipLevel = region.mipLevel;
+            copyRegion.imageSubresource.baseArrayLayer = region.layer;
+            copyRegion.imageSubresource.layerCount = 1;
+            copyRegion.imageOffset.x = static_cast<int32>(destinationPixelOffset.x);
+            copyRegion.imageOffset.y = static_cast<int32>(destinationPixelOffset.y);
+            copyRegion.imageOffset.z = 0;
+            copyRegion.imageExtent.width = copyExtent.x;
+            copyRegion.imageExtent.height = copyExtent.y;
+            copyRegion.imageExtent.depth = 1;
+        }
+
+        // Copy all regions within a single command
+        device.GetFunctionTable().vkCmdCopyBufferToImage(commandBuffer, vulkanSourceBuffer.GetVulkanBuffer(), vulkanDestinationImage.GetVulkanImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32>(copyRegions.size()), copyRegions.data());
+    }
+
+    void VulkanCommandBuffer::CopyImageToBuffer(const std::unique_ptr<Image> &sourceImage, const std::unique_ptr<Buffer> &destinationBuffer, const uint32 mipLevel, const Vector2UInt &pixelRange, const uint32 layer, const Vector2UInt &sourcePixelOffset, const uint64 destinationByteOffset)
+    {
+        SR_ERROR_IF(sourceImage->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Could not copy from image [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], to buffer [{1}] within command buffer [{2}]!", sourceImage->GetName(), destinationBuffer->GetName(), GetName());
+        const VulkanImage &vulkanSourceImage = static_cast<VulkanImage&>(*sourceImage);
+
+        SR_ERROR_IF(destinationBuffer->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Could not copy from image [{0}] to buffer [{1}], whose graphics API differs from [GraphicsAPI::Vulkan], within command buffer [{2}]!", sourceImage->GetName(), destinationBuffer->GetName(), GetName());
+        const VulkanBuffer &vulkanDestinationBuffer = static_cast<VulkanBuffer&>(*destinationBuffer);
+
+        SR_ERROR_IF(mipLevel >= sourceImage->GetMipLevelCount(), "[Vulkan]: Cannot copy from mip level [{0}] of image [{1}] to buffer [{2}] within command buffer [{3}], as image does not contain it!", mipLevel, sourceImage->GetName(), destinationBuffer->GetName(), GetName());
+        SR_ERROR_IF(layer >= sourceImage->GetLayerCount(), "[Vulkan]: Cannot copy from layer [{0}] of image [{1}] to buffer [{2}] within command buffer [{3}], as image does not contain it!", layer, sourceImage->GetName(), destinationBuffer->GetName(), GetName());
 
-        // Set copy region
+        // Determine copied extent (compressed images are copied in whole blocks, so the region must be block-aligned, unless it reaches the edge of the mip level)
+        const Vector2UInt mipLevelExtent = { std::max(sourceImage->GetWidth() >> mipLevel, 1U), std::max(sourceImage->GetHeight() >> mipLevel, 1U) };
+        const Vector2UInt copyExtent = { pixelRange.x != 0 ? pixelRange.x : mipLevelExtent.x, pixelRange.y != 0 ? pixelRange.y : mipLevelExtent.y };
+        const uint32 blockExtent = sourceImage->GetBlockExtent();
+
+        SR_ERROR_IF(sourcePixelOffset.x + copyExtent.x > mipLevelExtent.x || sourcePixelOffset.y + copyExtent.y > mipLevelExtent.y, "[Vulkan]: Cannot copy pixel range [{0}x{1}], which is offset by another [{2}x{3}] pixels, from image [{4}] to buffer [{5}] within command buffer [{6}], as resulting pixel range of a total of [{7}x{8}] pixels exceeds the dimensions of mip level [{9}] - [{10}x{11}]!", copyExtent.x, copyExtent.y, sourcePixelOffset.x, sourcePixelOffset.y, sourceImage->GetName(), destinationBuffer->GetName(), GetName(), sourcePixelOffset.x + copyExtent.x, sourcePixelOffset.y + copyExtent.y, mipLevel, mipLevelExtent.x, mipLevelExtent.y);
+        SR_ERROR_IF(sourcePixelOffset.x % blockExtent != 0 || sourcePixelOffset.y % blockExtent != 0 || (copyExtent.x % blockExtent != 0 && sourcePixelOffset.x + copyExtent.x != mipLevelExtent.x) || (copyExtent.y % blockExtent != 0 && sourcePixelOffset.y + copyExtent.y != mipLevelExtent.y), "[Vulkan]: Cannot copy pixel range [{0}x{1}], which is offset by another [{2}x{3}] pixels, from image [{4}] to buffer [{5}] within command buffer [{6}], as it is not aligned to the image's compression block extent of [{7}x{7}]!", copyExtent.x, copyExtent.y, sourcePixelOffset.x, sourcePixelOffset.y, sourceImage->GetName(), destinationBuffer->GetName(), GetName(), blockExtent);
+
+        const uint64 copyMemorySize = ImageFormatToRegionMemorySize(sourceImage->GetFormat(), copyExtent.x, copyExtent.y);
+        SR_ERROR_IF(destinationByteOffset + copyMemorySize > destinationBuffer->GetMemorySize(), "[Vulkan]: Cannot copy pixel range [{0}x{1}] from image [{2}] to buffer [{3}], at byte offset [{4}], within command buffer [{5}], as total memory range [{6}] overflows that of the buffer - [{7}]!", copyExtent.x, copyExtent.y, sourceImage->GetName(), destinationBuffer->GetName(), destinationByteOffset, GetName(), destinationByteOffset + copyMemorySize, destinationBuffer->GetMemorySize());
+        SR_ERROR_IF(destinationByteOffset % sourceImage->GetBlockMemorySize() != 0, "[Vulkan]: Cannot copy from image [{0}] to buffer [{1}], at byte offset [{2}], within command buffer [{3}], as offset must be a multiple of the image's block memory size - [{4}]!", sourceImage->GetName(), destinationBuffer->GetName(), destinationByteOffset, GetName(), sourceImage->GetBlockMemorySize());
+
+        // Set copy region (rows are tightly packed within the buffer)
         VkBufferImageCopy copyRegion = { };
-        copyRegion.bufferOffset = sourceByteOffset;
-        copyRegion.bufferRowLength = pixelRange.x != 0 ? pixelRange.x : destinationImage->GetWidth() >> mipLevel;
-        copyRegion.bufferImageHeight = pixelRange.y != 0 ? pixelRange.y : destinationImage->GetHeight() >> mipLevel;
-        copyRegion.imageSubresource.aspectMask = vulkanDestinationImage.GetVulkanAspectFlags();
+        copyRegion.bufferOffset = destinationByteOffset;
+        copyRegion.bufferRowLength = (copyExtent.x + blockExtent - 1) / blockExtent * blockExtent;
+        copyRegion.bufferImageHeight = (copyExtent.y + blockExtent - 1) / blockExtent * blockExtent;
+        copyRegion.imageSubresource.aspectMask = vulkanSourceImage.GetVulkanAspectFlags();
         copyRegion.imageSubresource.mipLevel = mipLevel;
         copyRegion.imageSubresource.baseArrayLayer = layer;
         copyRegion.imageSubresource.layerCount = 1;
-        copyRegion.imageOffset.x = static_cast<int32>(destinationPixelOffset.x);
-        copyRegion.imageOffset.y = static_cast<int32>(destinationPixelOffset.y);
+        copyRegion.imageOffset.x = static_cast<int32>(sourcePixelOffset.x);
+        copyRegion.imageOffset.y = static_cast<int32>(sourcePixelOffset.y);
         copyRegion.imageOffset.z = 0;
-        copyRegion.imageExtent.width = pixelRange.x != 0 ? pixelRange.x : destinationImage->GetWidth() >> mipLevel;
-        copyRegion.imageExtent.height = pixelRange.y != 0 ? pixelRange.y : destinationImage->GetHeight() >> mipLevel;
+        copyRegion.imageExtent.width = copyExtent.x;
+        copyRegion.imageExtent.height = copyExtent.y;
         copyRegion.imageExtent.depth = 1;
 
-        SR_ERROR_IF(destinationPixelOffset.x + copyRegion.imageExtent.width > destinationImage->GetWidth() || destinationPixelOffset.y + copyRegion.imageExtent.height > destinationImage->GetHeight(), "[Vulkan]: Cannot copy from buffer [{0}] pixel range [{1}x{2}], which is offset by another [{3}x{4}] pixels to image [{5}] within command buffer [{6}], as resulting pixel range of a total of [{7}x{8}] pixels exceeds the image's dimensions - [{9}x{10}]!", sourceBuffer->GetName(), copyRegion.imageExtent.width, copyRegion.imageExtent.height, destinationPixelOffset.x, destinationPixelOffset.y, destinationImage->GetName(), GetName(), destinationPixelOffset.x + copyRegion.imageExtent.width, destinationPixelOffset.y + copyRegion.imageExtent.height, destinationImage->GetWidth(), destinationImage->GetHeight());
-        SR_ERROR_IF(sourceByteOffset + static_cast<uint64>(copyRegion.imageExtent.width) * copyRegion.imageExtent.height * destinationImage->GetPixelMemorySize() > sourceBuffer->GetMemorySize(), "[Vulkan]: Cannot copy from buffer [{0}] pixel range [{1}x{2}], which is offset by another [{3}] bytes, to image [{4}], as total memory range [{5}] overflows that of the buffer - [{6}]!", sourceBuffer->GetName(), copyRegion.imageExtent.width, copyRegion.imageExtent.height, sourceByteOffset, destinationImage->GetName(), sourceByteOffset + static_cast<uint64>(pixelRange.x) * copyRegion.imageExtent.height * destinationImage->GetPixelMemorySize(), sourceBuffer->GetMemorySize());
-
-        // Copy data and change layout
-        device.GetFunctionTable().vkCmdCopyBufferToImage(commandBuffer, vulkanSourceBuffer.GetVulkanBuffer(), vulkanDestinationImage.GetVulkanImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyRegion);
+        // Copy data (image must have been transitioned to ImageCommandUsage::MemoryRead beforehand)
+        device.GetFunctionTable().vkCmdCopyImageToBuffer(commandBuffer, vulkanSourceImage.GetVulkanImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, vulkanDestinationBuffer.GetVulkanBuffer(), 1, &copyRegion);
     }
 
     void VulkanCommandBuffer::GenerateMipMapsForImage(const std::unique_ptr<Image> &image)
     {
         SR_ERROR_IF(image->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot generate mip maps for image [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], within command buffer [{1}]!", image->GetName(), GetName());
-        const VulkanImage &vulkanImage = static_cast<VulkanImage&>(*image);
+        VulkanImage &vulkanImage = static_cast<VulkanImage&>(*image);
 
         SR_ERROR_IF(vulkanImage.GetMipLevelCount() <= 1, "[Vulkan]: Cannot generate mip maps for image [{0}], as it has a single mip level only!", vulkanImage.GetName());
+        SR_ERROR_IF(vulkanImage.IsCompressed(), "[Vulkan]: Cannot generate mip maps for image [{0}], as it uses a compressed format, whose mip levels must be precomputed!", vulkanImage.GetName());
 
+        // Mip levels get left in differing layouts
+        recordedImageLayouts.emplace_back(&vulkanImage, VK_IMAGE_LAYOUT_MAX_ENUM);
+
+        // Generate all mip levels within a single dispatch if possible
+        const VulkanMipMapGenerator* mipMapGenerator = device.GetMipMapGenerator();
+        if (mipMapGenerator != nullptr && mipMapGenerator->IsImageSupported(vulkanImage))
+        {
+            mipMapGenerator->GenerateMipMaps(commandBuffer, vulkanImage);
+
+            // Generator overrides bound compute state and push constants, so restore them
+            if (currentComputePipeline != nullptr) device.GetFunctionTable().vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, currentComputePipeline->GetVulkanPipeline());
+            if ((currentGraphicsPipeline != nullptr || currentComputePipeline != nullptr) && !pushConstantData.empty())
+            {
+                const VulkanPipelineLayout &currentPipelineLayout = currentComputePipeline != nullptr ? currentComputePipeline->GetLayout() : currentGraphicsPipeline->GetLayout();
+                const uint32 restoredMemoryRange = std::min(static_cast<uint32>(pushConstantData.size()), static_cast<uint32>(currentPipelineLayout.GetPushConstantSize()));
+                if (restoredMemoryRange > 0) device.GetFunctionTable().vkCmdPushConstants(commandBuffer, currentPipelineLayout.GetVulkanPipelineLayout(), currentPipelineLayout.GetPushConstantStageFlags(), 0, restoredMemoryRange, pushConstantData.data());
+            }
+            resourcesBound = false;
+            return;
+        }
+
+        // Otherwise, blit every mip level from the one before it
         // Set up base pipeline barrier
         VkImageMemoryBarrier pipelineBarrier = { };
         pipelineBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -255,7 +357,7 @@ namespace Sierra
             const VulkanImage &vulkanImage = static_cast<VulkanImage&>(*attachment.image);
 
             // Configure attachment info
-            attachmentViews[i] = vulkanImage.GetVulkanImageView();
+            attachmentViews[i] = vulkanImage.GetVulkanImageView({ .mipLevelCount = 1 }); // Attachments must be viewed with a single mip level
             if (attachment.image->GetFormat().channels == ImageChannels::D)
             {
                 clearValues[i].depthStencil = { 1.0f, 0 };
@@ -329,6 +431,13 @@ namespace Sierra
         const VulkanGraphicsPipeline &vulkanGraphicsPipeline = static_cast<VulkanGraphicsPipeline&>(*graphicsPipeline);
 
         device.GetFunctionTable().vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vulkanGraphicsPipeline.GetVulkanPipeline());
+        if (vulkanGraphicsPipeline.HasExtendedDynamicState())
+        {
+            // Dynamic states must be set before drawing, so apply pipeline's own values, which setters may later override
+            device.GetFunctionTable().vkCmdSetCullModeEXT(commandBuffer, vulkanGraphicsPipeline.GetCullMode());
+            device.GetFunctionTable().vkCmdSetFrontFaceEXT(commandBuffer, vulkanGraphicsPipeline.GetFrontFace());
+            device.GetFunctionTable().vkCmdSetDepthWriteEnableEXT(commandBuffer, vulkanGraphicsPipeline.GetDepthWriteEnable());
+        }
         currentGraphicsPipeline = &vulkanGraphicsPipeline;
     }
 
@@ -338,24 +447,25 @@ namespace Sierra
         currentGraphicsPipeline = nullptr;
     }
 
-    void VulkanCommandBuffer::BindVertexBuffer(const std::unique_ptr<Buffer> &vertexBuffer, const uint64 byteOffset)
+    void VulkanCommandBuffer::BindVertexBuffer(const std::unique_ptr<Buffer> &vertexBuffer, const uint64 byteOffset, const uint32 stream)
     {
         SR_ERROR_IF(vertexBuffer->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot bind vertex buffer [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], within command buffer [{1}]!", vertexBuffer->GetName(), GetName());
         const VulkanBuffer &vulkanVertexBuffer = static_cast<VulkanBuffer&>(*vertexBuffer);
 
         SR_ERROR_IF(byteOffset > vertexBuffer->GetMemorySize(), "[Vulkan]: Cannot bind vertex buffer [{0}] within command buffer [{1}] using specified offset of [{2}] bytes, which is outside of the [{3}] bytes size of the size of the buffer!", vertexBuffer->GetName(), GetName(), byteOffset, vertexBuffer->GetMemorySize());
+        SR_ERROR_IF(stream >= GraphicsPipeline::MAX_VERTEX_STREAM_COUNT, "[Vulkan]: Cannot bind vertex buffer [{0}] within command buffer [{1}] to stream [{2}], as it exceeds the maximum of [{3}] vertex streams!", vertexBuffer->GetName(), GetName(), stream, GraphicsPipeline::MAX_VERTEX_STREAM_COUNT);
 
         VkBuffer vkBuffer = vulkanVertexBuffer.GetVulkanBuffer();
-        device.GetFunctionTable().vkCmdBindVertexBuffers(commandBuffer, 0, 1, &vkBuffer, &byteOffset);
+        device.GetFunctionTable().vkCmdBindVertexBuffers(commandBuffer, stream, 1, &vkBuffer, &byteOffset);
     }
 
-    void VulkanCommandBuffer::BindIndexBuffer(const std::unique_ptr<Buffer> &indexBuffer, const uint64 byteOffset)
+    void VulkanCommandBuffer::BindIndexBuffer(const std::unique_ptr<Buffer> &indexBuffer, const uint64 byteOffset, const IndexBufferType indexType)
     {
         SR_ERROR_IF(indexBuffer->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot bind index buffer [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], within command buffer [{1}]!", indexBuffer->GetName(), GetName());
         const VulkanBuffer &vulkanIndexBuffer = static_cast<VulkanBuffer&>(*indexBuffer);
 
         SR_ERROR_IF(byteOffset > indexBuffer->GetMemorySize(), "[Vulkan]: Cannot bind index buffer [{0}] within command buffer [{1}] using specified offset of [{2}] bytes, which is outside of the [{3}] bytes size of the size of the buffer!", indexBuffer->GetName(), GetName(), byteOffset, indexBuffer->GetMemorySize());
-        device.GetFunctionTable().vkCmdBindIndexBuffer(commandBuffer, vulkanIndexBuffer.GetVulkanBuffer(), byteOffset, VK_INDEX_TYPE_UINT32); // 32-bit indices are required, due to Metal shaders enforcing it
+        device.GetFunctionTable().vkCmdBindIndexBuffer(commandBuffer, vulkanIndexBuffer.GetVulkanBuffer(), byteOffset, IndexBufferTypeToVkIndexType(indexType));
     }
 
     void VulkanCommandBuffer::SetScissor(const Vector4UInt &scissor)
@@ -371,6 +481,24 @@ namespace Sierra
         device.GetFunctionTable().vkCmdSetScissor(commandBuffer, 0, 1, &scissorRect);
     }
 
+    void VulkanCommandBuffer::SetCullMode(const CullMode cullMode)
+    {
+        SR_ERROR_IF(currentGraphicsPipeline == nullptr || !currentGraphicsPipeline->HasExtendedDynamicState(), "[Vulkan]: Cannot set cull mode within command buffer [{0}], as no graphics pipeline is active, or extended dynamic state is not supported! Use Device::IsExtendedDynamicStateSupported() to query support.", GetName());
+        device.GetFunctionTable().vkCmdSetCullModeEXT(commandBuffer, VulkanGraphicsPipeline::CullModeToVkCullMode(cullMode));
+    }
+
+    void VulkanCommandBuffer::SetFrontFaceMode(const FrontFaceMode frontFaceMode)
+    {
+        SR_ERROR_IF(currentGraphicsPipeline == nullptr || !currentGraphicsPipeline->HasExtendedDynamicState(), "[Vulkan]: Cannot set front face mode within command buffer [{0}], as no graphics pipeline is active, or extended dynamic state is not supported! Use Device::IsExtendedDynamicStateSupported() to query support.", GetName());
+        device.GetFunctionTable().vkCmdSetFrontFaceEXT(commandBuffer, VulkanGraphicsPipeline::FrontFaceModeToVkFrontFace(frontFaceMode));
+    }
+
+    void VulkanCommandBuffer::SetDepthMode(const DepthMode depthMode)
+    {
+        SR_ERROR_IF(currentGraphicsPipeline == nullptr || !currentGraphicsPipeline->HasExtendedDynamicState(), "[Vulkan]: Cannot set depth mode within command buffer [{0}], as no graphics pipeline is active, or extended dynamic state is not supported! Use Device::IsExtendedDynamicStateSupported() to query support.", GetName());
+        device.GetFunctionTable().vkCmdSetDepthWriteEnableEXT(commandBuffer, depthMode == DepthMode::WriteDepth);
+    }
+
     void VulkanCommandBuffer::Draw(const uint32 vertexCount, const uint32 vertexOffset)
     {
         SR_ERROR_IF(currentGraphicsPipeline == nullptr, "[Vulkan]: Cannot draw if no graphics pipeline is active within command buffer [{0}]!", GetName());
@@ -416,7 +544,11 @@ namespace Sierra
         const VulkanPipelineLayout &currentPipelineLayout = currentComputePipeline != nullptr ? currentComputePipeline->GetLayout() : currentGraphicsPipeline->GetLayout();
 
         SR_ERROR_IF(memoryRange > currentPipelineLayout.GetPushConstantSize(), "[Vulkan]: Cannot push [{0}] bytes of push constant data within command buffer [{1}], as specified memory range is bigger than specified in the current pipeline's layout, which is [{2}] bytes!", memoryRange, GetName(), currentPipelineLayout.GetPushConstantSize());
-        device.GetFunctionTable().vkCmdPushConstants(commandBuffer, currentPipelineLayout.GetVulkanPipelineLayout(), VK_SHADER_STAGE_ALL, byteOffset, memoryRange, data);
+        device.GetFunctionTable().vkCmdPushConstants(commandBuffer, currentPipelineLayout.GetVulkanPipelineLayout(), currentPipelineLayout.GetPushConstantStageFlags(), byteOffset, memoryRange, data);
+
+        // Keep a copy of pushed data, as internal dispatches (e.g. mip map generation) overwrite it
+        if (pushConstantData.size() < static_cast<size>(byteOffset) + memoryRange) pushConstantData.resize(static_cast<size>(byteOffset) + memoryRange);
+        std::memcpy(pushConstantData.data() + byteOffset, data, memoryRange);
     }
 
     void VulkanCommandBuffer::BindBuffer(const uint32 binding, const std::unique_ptr<Buffer> &buffer, const uint32 arrayIndex, uint64 memoryRange, const uint64 byteOffset)
@@ -431,16 +563,17 @@ namespace Sierra
         resourcesBound = false;
     }
 
-    void VulkanCommandBuffer::BindImage(const uint32 binding, const std::unique_ptr<Image> &image, const uint32 arrayIndex)
+    void VulkanCommandBuffer::BindImage(const uint32 binding, const std::unique_ptr<Image> &image, const uint32 arrayIndex, const ImageSubresourceRange &subresourceRange)
     {
         SR_ERROR_IF(image->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot bind image [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], to binding [{1}] within command buffer [{2}]!", image->GetName(), binding, GetName());
         const VulkanImage &vulkanImage = static_cast<VulkanImage&>(*image);
 
-        pushDescriptorSet.BindImage(binding, vulkanImage, nullptr, VK_IMAGE_LAYOUT_GENERAL, arrayIndex);
+        // Whether the image is sampled (through an immutable sampler) or used as storage depends on the binding's type within the layout it gets pushed with
+        pushDescriptorSet.BindImage(binding, vulkanImage.GetVulkanImageView(subresourceRange), arrayIndex);
         resourcesBound = false;
     }
 
-    void VulkanCommandBuffer::BindImage(const uint32 binding, const std::unique_ptr<Image> &image, const std::unique_ptr<Sampler> &sampler, const uint32 arrayIndex)
+    void VulkanCommandBuffer::BindImage(const uint32 binding, const std::unique_ptr<Image> &image, const std::unique_ptr<Sampler> &sampler, const uint32 arrayIndex, const ImageSubresourceRange &subresourceRange)
     {
         SR_ERROR_IF(image->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot bind image [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], to binding [{1}] within command buffer [{2}]!", image->GetName(), binding, GetName());
         const VulkanImage &vulkanImage = static_cast<VulkanImage&>(*image);
@@ -448,7 +581,7 @@ namespace Sierra
         SR_ERROR_IF(sampler->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot bind image [{0}] using sampler [{1}], whose graphics API differs from [GraphicsAPI::Vulkan], to binding [{2}] within command buffer [{3}]!", image->GetName(), sampler->GetName(), binding, GetName());
         const VulkanSampler &vulkanSampler = static_cast<VulkanSampler&>(*sampler);
 
-        pushDescriptorSet.BindImage(binding, vulkanImage, &vulkanSampler, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, arrayIndex);
+        pushDescriptorSet.BindImage(binding, vulkanImage.GetVulkanImageView(subresourceRange), VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, vulkanSampler.GetVulkanSampler(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, arrayIndex);
         resourcesBound = false;
     }
 
@@ -494,6 +627,49 @@ namespace Sierra
         device.GetFunctionTable().vkCmdDebugMarkerEndEXT(commandBuffer);
     }
 
+    void VulkanCommandBuffer::ResetQueryPool(const std::unique_ptr<QueryPool> &queryPool, const uint32 firstQuery, uint32 queryCount)
+    {
+        SR_ERROR_IF(queryPool->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot reset query pool [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], within command buffer [{1}]!", queryPool->GetName(), GetName());
+        const VulkanQueryPool &vulkanQueryPool = static_cast<VulkanQueryPool&>(*queryPool);
+
+        queryCount = queryCount != 0 ? queryCount : queryPool->GetQueryCount() - firstQuery;
+        SR_ERROR_IF(firstQuery + queryCount > queryPool->GetQueryCount(), "[Vulkan]: Cannot reset queries [{0}-{1}] of query pool [{2}] within command buffer [{3}], as they exceed its query count - [{4}]!", firstQuery, firstQuery + queryCount - 1, queryPool->GetName(), GetName(), queryPool->GetQueryCount());
+
+        device.GetFunctionTable().vkCmdResetQueryPool(commandBuffer, vulkanQueryPool.GetVulkanQueryPool(), firstQuery, queryCount);
+    }
+
+    void VulkanCommandBuffer::BeginQuery(const std::unique_ptr<QueryPool> &queryPool, const uint32 query)
+    {
+        SR_ERROR_IF(queryPool->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot begin query of query pool [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], within command buffer [{1}]!", queryPool->GetName(), GetName());
+        const VulkanQueryPool &vulkanQueryPool = static_cast<VulkanQueryPool&>(*queryPool);
+
+        SR_ERROR_IF(queryPool->GetType() == QueryType::Timestamp, "[Vulkan]: Cannot begin query of query pool [{0}] within command buffer [{1}], as timestamp queries can only be written to, using CommandBuffer::WriteTimestamp()!", queryPool->GetName(), GetName());
+        SR_ERROR_IF(query >= queryPool->GetQueryCount(), "[Vulkan]: Cannot begin query [{0}] of query pool [{1}] within command buffer [{2}], as it does not have it!", query, queryPool->GetName(), GetName());
+
+        device.GetFunctionTable().vkCmdBeginQuery(commandBuffer, vulkanQueryPool.GetVulkanQueryPool(), query, 0);
+    }
+
+    void VulkanCommandBuffer::EndQuery(const std::unique_ptr<QueryPool> &queryPool, const uint32 query)
+    {
+        SR_ERROR_IF(queryPool->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot end query of query pool [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], within command buffer [{1}]!", queryPool->GetName(), GetName());
+        const VulkanQueryPool &vulkanQueryPool = static_cast<VulkanQueryPool&>(*queryPool);
+
+        SR_ERROR_IF(query >= queryPool->GetQueryCount(), "[Vulkan]: Cannot end query [{0}] of query pool [{1}] within command buffer [{2}], as it does not have it!", query, queryPool->GetName(), GetName());
+        device.GetFunctionTable().vkCmdEndQuery(commandBuffer, vulkanQueryPool.GetVulkanQueryPool(), query);
+    }
+
+    void VulkanCommandBuffer::WriteTimestamp(const std::unique_ptr<QueryPool> &queryPool, const uint32 query)
+    {
+        SR_ERROR_IF(queryPool->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot write timestamp to query pool [{0}], whose graphics API differs from [GraphicsAPI::Vulkan], within command buffer [{1}]!", queryPool->GetName(), GetName());
+        const VulkanQueryPool &vulkanQueryPool = static_cast<VulkanQueryPool&>(*queryPool);
+
+        SR_ERROR_IF(queryPool->GetType() != QueryType::Timestamp, "[Vulkan]: Cannot write timestamp to query pool [{0}] within command buffer [{1}], as it was not created with [QueryType::Timestamp]!", queryPool->GetName(), GetName());
+        SR_ERROR_IF(query >= queryPool->GetQueryCount(), "[Vulkan]: Cannot write timestamp to query [{0}] of query pool [{1}] within command buffer [{2}], as it does not have it!", query, queryPool->GetName(), GetName());
+
+        // Timestamp is written once all previously submitted work has finished
+        device.GetFunctionTable().vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, vulkanQueryPool.GetVulkanQueryPool(), query);
+    }
+
     /* --- DESTRUCTOR --- */
 
     VulkanCommandBuffer::~VulkanCommandBuffer()
@@ -514,12 +690,24 @@ namespace Sierra
         const VkPipelineBindPoint bindPoint = currentComputePipeline != nullptr ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS;
         const VulkanPipelineLayout &currentPipelineLayout = currentComputePipeline != nullptr ? currentComputePipeline->GetLayout() : currentGraphicsPipeline->GetLayout();
 
+        pushDescriptorSet.ResolveImageDescriptors(currentPipelineLayout);
         if (!pushDescriptorSet.GetWriteDescriptorSets().empty()) device.GetFunctionTable().vkCmdPushDescriptorSetKHR(commandBuffer, bindPoint, currentPipelineLayout.GetVulkanPipelineLayout(), 0, pushDescriptorSet.GetWriteDescriptorSets().size(), pushDescriptorSet.GetWriteDescriptorSets().data());
         resourcesBound = true;
     }
 
     /* --- CONVERSIONS --- */
 
+    VkIndexType VulkanCommandBuffer::IndexBufferTypeToVkIndexType(const IndexBufferType indexType)
+    {
+        switch (indexType)
+        {
+            case IndexBufferType::UInt16:       return VK_INDEX_TYPE_UINT16;
+            case IndexBufferType::UInt32:       return VK_INDEX_TYPE_UINT32;
+        }
+
+        return VK_INDEX_TYPE_UINT32;
+    }
+
     VkAccessFlags VulkanCommandBuffer::BufferCommandUsageToVkAccessFlags(const BufferCommandUsage bufferCommandUsage)
     {
         switch (bufferCommandUsage)
@@ -533,6 +721,7 @@ namespace Sierra
             case BufferCommandUsage::ComputeRead:       return VK_ACCESS_SHADER_READ_BIT;
             case BufferCommandUsage::GraphicsWrite:
             case BufferCommandUsage::ComputeWrite:      return VK_ACCESS_SHADER_WRITE_BIT;
+            case BufferCommandUsage::HostRead:          return VK_ACCESS_HOST_READ_BIT;
         }
 
         return VK_ACCESS_NONE;
@@ -551,6 +740,7 @@ namespace Sierra
             case BufferCommandUsage::GraphicsWrite:    return VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
             case BufferCommandUsage::ComputeRead:
             case BufferCommandUsage::ComputeWrite:     return VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+            case BufferCommandUsage::HostRead:         return VK_PIPELINE_STAGE_HOST_BIT;
         }
 
         return VK_PIPELINE_STAGE_NONE;
@@ -31,6 +31,8 @@ namespace Sierra
 
         void CopyBufferToBuffer(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Buffer> &destinationBuffer, uint64 memoryRange = 0, uint64 sourceByteOffset = 0, uint64 destinationByteOffset = 0) override;
         void CopyBufferToImage(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Image> &destinationImage, uint32 mipLevel, const Vector2UInt &pixelRange = { 0, 0 }, uint32 layer = 0, uint64 sourceByteOffset = 0, const Vector2UInt &destinationPixelOffset = { 0, 0 }) override;
+        void CopyBufferToImageRegions(const std::unique_ptr<Buffer> &sourceBuffer, const std::unique_ptr<Image> &destinationImage, const std::vector<BufferImageCopyRegion> &regions) override;
+        void CopyImageToBuffer(const std::unique_ptr<Image> &sourceImage, const std::unique_ptr<Buffer> &destinationBuffer, uint32 mipLevel = 0, const Vector2UInt &pixelRange = { 0, 0 }, uint32 layer = 0, const Vector2UInt &sourcePixelOffset = { 0, 0 }, uint64 destinationByteOffset = 0) override;
         void GenerateMipMapsForImage(const std::unique_ptr<Image> &image) override;
 
         void BeginRenderPass(const std::unique_ptr<RenderPass> &renderPass, const std::initializer_list<RenderPassBeginAttachment> &attachments) override;
@@ -40,10 +42,13 @@ namespace Sierra
         void BeginGraphicsPipeline(const std::unique_ptr<GraphicsPipeline> &graphicsPipeline) override;
         void EndGraphicsPipeline(const std::unique_ptr<GraphicsPipeline> &graphicsPipeline) override;
 
-        void BindVertexBuffer(const std::unique_ptr<Buffer> &vertexBuffer, uint64 byteOffset = 0) override;
-        void BindIndexBuffer(const std::unique_ptr<Buffer> &indexBuffer, uint64 byteOffset = 0) override;
+        void BindVertexBuffer(const std::unique_ptr<Buffer> &vertexBuffer, uint64 byteOffset = 0, uint32 stream = 0) override;
+        void BindIndexBuffer(const std::unique_ptr<Buffer> &indexBuffer, uint64 byteOffset = 0, IndexBufferType indexType = IndexBufferType::UInt32) override;
 
         void SetScissor(const Vector4UInt &scissor) override;
+        void SetCullMode(CullMode cullMode) override;
+        void SetFrontFaceMode(FrontFaceMode frontFaceMode) override;
+        void SetDepthMode(DepthMode depthMode) override;
         void Draw(uint32 vertexCount, uint32 vertexOffset = 0) override;
         void DrawIndexed(uint32 indexCount, uint32 indexOffset = 0, uint32 vertexOffset = 0) override;
 
@@ -54,21 +59,28 @@ namespace Sierra
 
         void PushConstants(const void* data, uint16 memoryRange, uint16 byteOffset = 0) override;
         void BindBuffer(uint32 binding, const std::unique_ptr<Buffer> &buffer, uint32 arrayIndex = 0, uint64 memoryRange = 0, uint64 byteOffset = 0) override;
-        void BindImage(uint32 binding, const std::unique_ptr<Image> &image, uint32 arrayIndex = 0) override;
-        void BindImage(uint32 binding, const std::unique_ptr<Image> &image, const std::unique_ptr<Sampler> &sampler, uint32 arrayIndex = 0) override;
+        void BindImage(uint32 binding, const std::unique_ptr<Image> &image, uint32 arrayIndex = 0, const ImageSubresourceRange &subresourceRange = { }) override;
+        void BindImage(uint32 binding, const std::unique_ptr<Image> &image, const std::unique_ptr<Sampler> &sampler, uint32 arrayIndex = 0, const ImageSubresourceRange &subresourceRange = { }) override;
 
         void BeginDebugRegion(const std::string &regionName, const Color &color = Color(1.0f, 1.0f, 0.0f, 1.0f)) override;
         void InsertDebugMarker(const std::string &markerName, const Color &color = Color(1.0f, 1.0f, 0.0f, 1.0f)) override;
         void EndDebugRegion() override;
 
+        void ResetQueryPool(const std::unique_ptr<QueryPool> &queryPool, uint32 firstQuery = 0, uint32 queryCount = 0) override;
+        void BeginQuery(const std::unique_ptr<QueryPool> &queryPool, uint32 query) override;
+        void EndQuery(const std::unique_ptr<QueryPool> &queryPool, uint32 query) override;
+        void WriteTimestamp(const std::unique_ptr<QueryPool> &queryPool, uint32 query) override;
+
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline VkCommandBuffer GetVulkanCommandBuffer() const { return commandBuffer; }
-        [[nodiscard]] inline uint64 GetCompletionSignalValue() const { return completionSignalValue; }
+        [[nodiscard]] inline uint64 GetCompletionSignalValue() const override { return completionSignalValue; }
+        [[nodiscard]] inline const std::vector<std::pair<VulkanImage*, VkImageLayout>>& GetRecordedImageLayouts() const { return recordedImageLayouts; }
 
         /* --- DESTRUCTOR --- */
         ~VulkanCommandBuffer() override;
 
         /* --- CONVERSIONS --- */
+        [[nodiscard]] static VkIndexType IndexBufferTypeToVkIndexType(IndexBufferType indexType);
         [[nodiscard]] static VkAccessFlags BufferCommandUsageToVkAccessFlags(BufferCommandUsage bufferCommandUsage);
         [[nodiscard]] static VkPipelineStageFlags BufferCommandUsageToVkPipelineStageFlags(BufferCommandUsage bufferCommandUsage);
         [[nodiscard]] static VkImageLayout ImageCommandUsageToVkLayout(ImageCommandUsage imageCommandUsage);
@@ -81,9 +93,11 @@ namespace Sierra
         VkCommandPool commandPool = VK_NULL_HANDLE;
         VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
         uint64 completionSignalValue = 0;
+        std::vector<std::pair<VulkanImage*, VkImageLayout>> recordedImageLayouts; // Whole-image layout changes, in recording order
 
         const VulkanGraphicsPipeline* currentGraphicsPipeline = nullptr;
         const VulkanComputePipeline* currentComputePipeline = nullptr;
+        std::vector<uint8> pushConstantData; // Last pushed constant bytes, so they can be restored after internal dispatches
 
         VulkanPushDescriptorSet pushDescriptorSet;
         bool resourcesBound = false;
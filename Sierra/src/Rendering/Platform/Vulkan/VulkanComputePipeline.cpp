@@ -19,12 +19,18 @@ namespace Sierra
         SR_ERROR_IF(createInfo.computeShader->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot create compute pipeline [{0}] with compute shader [{1}], as its graphics API differs from [GraphicsAPI::Vulkan]!", GetName(), createInfo.computeShader->GetName());
         const VulkanShader &vulkanComputeShader = static_cast<VulkanShader&>(*createInfo.computeShader);
 
+        // Set up specialization constants
+        std::vector<VkSpecializationMapEntry> specializationMapEntries;
+        std::vector<uint32> specializationData;
+        const VkSpecializationInfo specializationInfo = VulkanShader::ShaderConstantsToVkSpecializationInfo(createInfo.shaderConstants, specializationMapEntries, specializationData);
+
         // Set up only shader stage
         VkPipelineShaderStageCreateInfo shaderStageCreateInfo = { };
         shaderStageCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
         shaderStageCreateInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
         shaderStageCreateInfo.module = vulkanComputeShader.GetVulkanShaderModule();
         shaderStageCreateInfo.pName = "main";
+        shaderStageCreateInfo.pSpecializationInfo = createInfo.shaderConstants.size() != 0 ? &specializationInfo : nullptr;
 
         // Set up compute pipeline create info
         VkComputePipelineCreateInfo pipelineCreateInfo = { };
@@ -14,6 +14,7 @@
 #include "VulkanGraphicsPipeline.h"
 #include "VulkanComputePipeline.h"
 #include "VulkanCommandBuffer.h"
+#include "VulkanQueryPool.h"
 
 namespace Sierra
 {
@@ -21,7 +22,7 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     VulkanContext::VulkanContext(const RenderingContextCreateInfo &createInfo)
-        : RenderingContext(createInfo), VulkanResource(createInfo.name), instance(VulkanInstance({ })), device(instance, { .name = "Default Vulkan Device" })
+        : RenderingContext(createInfo), VulkanResource(createInfo.name), instance(VulkanInstance({ .headless = createInfo.headless })), device(instance, { .name = "Default Vulkan Device" })
     {
         SR_INFO("Vulkan context created successfully! Device in use: [{0}].", device.GetDeviceName());
     }
@@ -50,6 +51,7 @@ namespace Sierra
 
     std::unique_ptr<Swapchain> VulkanContext::CreateSwapchain(const SwapchainCreateInfo &createInfo) const
     {
+        SR_ERROR_IF(IsHeadless(), "[Vulkan]: Cannot create swapchain [{0}] within headless context [{1}]! Use RenderingContext::CreateOffscreenSwapchain() instead.", createInfo.name, GetName());
         return std::make_unique<VulkanSwapchain>(instance, device, createInfo);
     }
 
@@ -78,4 +80,9 @@ namespace Sierra
         return std::make_unique<VulkanCommandBuffer>(device, createInfo);
     }
 
+    std::unique_ptr<QueryPool> VulkanContext::CreateQueryPool(const QueryPoolCreateInfo &createInfo) const
+    {
+        return std::make_unique<VulkanQueryPool>(device, createInfo);
+    }
+
 }
@@ -0,0 +1,335 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "VulkanDefragmenter.h"
+
+#include "VulkanBuffer.h"
+#include "VulkanImage.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    VulkanDefragmenter::VulkanDefragmenter(const VulkanDevice &device)
+        : device(device)
+    {
+        // Set up pool create info
+        VkCommandPoolCreateInfo commandPoolCreateInfo = { };
+        commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        commandPoolCreateInfo.queueFamilyIndex = device.GetGeneralQueueFamily();
+
+        // Create command pool
+        VkResult result = device.GetFunctionTable().vkCreateCommandPool(device.GetLogicalDevice(), &commandPoolCreateInfo, nullptr, &commandPool);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create command pool of defragmenter! Error code: {0}.", result);
+
+        // Set up allocate info
+        VkCommandBufferAllocateInfo allocateInfo = { };
+        allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.commandPool = commandPool;
+        allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocateInfo.commandBufferCount = 1;
+
+        // Allocate command buffer
+        result = device.GetFunctionTable().vkAllocateCommandBuffers(device.GetLogicalDevice(), &allocateInfo, &commandBuffer);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not allocate command buffer of defragmenter! Error code: {0}.", result);
+
+        // Set object names
+        device.SetObjectName(commandPool, VK_OBJECT_TYPE_COMMAND_POOL, "Command pool of defragmenter");
+        device.SetObjectName(commandBuffer, VK_OBJECT_TYPE_COMMAND_BUFFER, "Command buffer of defragmenter");
+    }
+
+    /* --- POLLING METHODS --- */
+
+    bool VulkanDefragmenter::Defragment(const uint64 maxBytesPerStep, const uint32 maxAllocationsPerStep)
+    {
+        // Finish the pass, whose copies a previous step has submitted, once they have executed (until then, old memory must stay in place)
+        if (passPending)
+        {
+            if (device.GetCompletedSignalValue() < passSignalValue) return true;
+            return EndDefragmentationPass();
+        }
+
+        // Command buffers, which have been begun, but not yet submitted, may reference current handles, and will only update image layouts once submitted
+        if (device.GetLastReservedSignalValue() > device.GetLastSubmittedSignalValue()) return true;
+
+        // Begin defragmentation, unless a previous step has left it in progress
+        if (defragmentationContext == nullptr)
+        {
+            VmaDefragmentationInfo defragmentationInfo = { };
+            defragmentationInfo.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_BALANCED_BIT;
+            defragmentationInfo.maxBytesPerPass = maxBytesPerStep;
+            defragmentationInfo.maxAllocationsPerPass = maxAllocationsPerStep;
+
+            const VkResult result = vmaBeginDefragmentation(device.GetMemoryAllocator(), &defragmentationInfo, &defragmentationContext);
+            SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not begin defragmentation of memory of device [{0}]! Error code: {1}.", device.GetName(), result);
+        }
+
+        // Query allocations to move (VK_SUCCESS here means there is nothing left to move)
+        passMoveInfo = { };
+        VkResult result = vmaBeginDefragmentationPass(device.GetMemoryAllocator(), defragmentationContext, &passMoveInfo);
+        if (result == VK_SUCCESS)
+        {
+            EndDefragmentation();
+            return false;
+        }
+        SR_ERROR_IF(result != VK_INCOMPLETE, "[Vulkan]: Could not begin defragmentation pass of device [{0}]! Error code: {1}.", device.GetName(), result);
+
+        // Create a new resource within every destination allocation, ignoring moves of resources, which cannot be copied transparently
+        std::vector<BufferMove> bufferMoves;
+        std::vector<ImageMove> imageMoves;
+        for (uint32 i = 0; i < passMoveInfo.moveCount; i++)
+        {
+            VmaDefragmentationMove &move = passMoveInfo.pMoves[i];
+
+            VmaAllocationInfo allocationInfo = { };
+            vmaGetAllocationInfo(device.GetMemoryAllocator(), move.srcAllocation, &allocationInfo);
+
+            VulkanAllocationOwner* allocationOwner = reinterpret_cast<VulkanAllocationOwner*>(allocationInfo.pUserData);
+            if (allocationOwner != nullptr && allocationOwner->buffer != nullptr && PrepareBufferMove(*allocationOwner->buffer, move.dstTmpAllocation, bufferMoves))
+            {
+                allocationOwner->pendingMove = &move;
+                continue;
+            }
+            if (allocationOwner != nullptr && allocationOwner->image != nullptr && PrepareImageMove(*allocationOwner->image, move.dstTmpAllocation, imageMoves))
+            {
+                allocationOwner->pendingMove = &move;
+                continue;
+            }
+
+            move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+        }
+
+        // Nothing to copy, so the pass can be finished right away
+        if (bufferMoves.empty() && imageMoves.empty()) return EndDefragmentationPass();
+
+        // Begin command buffer
+        device.GetFunctionTable().vkResetCommandPool(device.GetLogicalDevice(), commandPool, 0);
+
+        VkCommandBufferBeginInfo beginInfo = { };
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        result = device.GetFunctionTable().vkBeginCommandBuffer(commandBuffer, &beginInfo);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not begin command buffer of defragmenter! Error code: {0}.", result);
+
+        // Set up barriers, which wait for all prior work on the queue, and prepare images for copying (their layouts are those left by the last submitted command buffers, which all execute before the copies)
+        VkMemoryBarrier memoryBarrier = { };
+        memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+        std::vector<VkImageMemoryBarrier> imageBarriers;
+        imageBarriers.reserve(imageMoves.size() * 2);
+        for (const ImageMove &imageMove : imageMoves)
+        {
+            if (!imageMove.copied) continue;
+
+            VkImageMemoryBarrier imageBarrier = { };
+            imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.subresourceRange = { imageMove.image.GetVulkanAspectFlags(), 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS };
+
+            imageBarrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+            imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            imageBarrier.oldLayout = imageMove.image.GetVulkanLayout();
+            imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            imageBarrier.image = imageMove.image.GetVulkanImage();
+            imageBarriers.push_back(imageBarrier);
+
+            imageBarrier.srcAccessMask = 0;
+            imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            imageBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            imageBarrier.image = imageMove.newImage;
+            imageBarriers.push_back(imageBarrier);
+        }
+        device.GetFunctionTable().vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &memoryBarrier, 0, nullptr, static_cast<uint32>(imageBarriers.size()), imageBarriers.data());
+
+        // Copy buffers
+        for (const BufferMove &bufferMove : bufferMoves)
+        {
+            const VkBufferCopy copyRegion = { .srcOffset = 0, .dstOffset = 0, .size = bufferMove.buffer.GetMemorySize() };
+            device.GetFunctionTable().vkCmdCopyBuffer(commandBuffer, bufferMove.buffer.GetVulkanBuffer(), bufferMove.newBuffer, 1, &copyRegion);
+        }
+
+        // Copy every mip level of images
+        std::vector<VkImageCopy> copyRegions;
+        for (const ImageMove &imageMove : imageMoves)
+        {
+            if (!imageMove.copied) continue;
+
+            copyRegions.resize(imageMove.image.GetMipLevelCount());
+            for (uint32 mipLevel = 0; mipLevel < imageMove.image.GetMipLevelCount(); mipLevel++)
+            {
+                const VkImageSubresourceLayers subresourceLayers = { imageMove.image.GetVulkanAspectFlags(), mipLevel, 0, imageMove.image.GetLayerCount() };
+                copyRegions[mipLevel] = { .srcSubresource = subresourceLayers, .srcOffset = { 0, 0, 0 }, .dstSubresource = subresourceLayers, .dstOffset = { 0, 0, 0 }, .extent = { std::max(imageMove.image.GetWidth() >> mipLevel, 1U), std::max(imageMove.image.GetHeight() >> mipLevel, 1U), 1 } };
+            }
+            device.GetFunctionTable().vkCmdCopyImage(commandBuffer, imageMove.image.GetVulkanImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, imageMove.newImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32>(copyRegions.size()), copyRegions.data());
+        }
+
+        // Make copied memory visible to all subsequent work, and return images to their original layouts
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+        imageBarriers.clear();
+        for (const ImageMove &imageMove : imageMoves)
+        {
+            if (!imageMove.copied) continue;
+
+            VkImageMemoryBarrier imageBarrier = { };
+            imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            imageBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            imageBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+            imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            imageBarrier.newLayout = imageMove.image.GetVulkanLayout();
+            imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.image = imageMove.newImage;
+            imageBarrier.subresourceRange = { imageMove.image.GetVulkanAspectFlags(), 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS };
+            imageBarriers.push_back(imageBarrier);
+        }
+        device.GetFunctionTable().vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &memoryBarrier, 0, nullptr, static_cast<uint32>(imageBarriers.size()), imageBarriers.data());
+
+        // End command buffer
+        result = device.GetFunctionTable().vkEndCommandBuffer(commandBuffer);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not end command buffer of defragmenter! Error code: {0}.", result);
+
+        // Submit copies without waiting for them (the pass is only finished by a later step, once they have executed)
+        passSignalValue = device.GetNewSignalValue();
+        device.SubmitVulkanCommandBuffer(commandBuffer, passSignalValue, "defragmentation copies");
+        passPending = true;
+
+        // Swap resources' handles for the moved ones, so work submitted from now on uses them, and retire old handles until all work submitted so far (including the copies) has executed
+        const VulkanDevice &owningDevice = device;
+        for (const BufferMove &bufferMove : bufferMoves)
+        {
+            const VkBuffer oldBuffer = bufferMove.buffer.buffer;
+            device.QueueHandleForDestruction([&owningDevice, oldBuffer] { owningDevice.GetFunctionTable().vkDestroyBuffer(owningDevice.GetLogicalDevice(), oldBuffer, nullptr); });
+
+            bufferMove.buffer.buffer = bufferMove.newBuffer;
+            device.SetObjectName(bufferMove.buffer.buffer, VK_OBJECT_TYPE_BUFFER, bufferMove.buffer.GetName());
+        }
+        for (const ImageMove &imageMove : imageMoves)
+        {
+            std::vector<VkImageView> oldImageViews = { imageMove.image.imageView };
+            {
+                std::lock_guard lock(imageMove.image.subresourceImageViewMutex);
+                for (const auto &[key, subresourceImageView] : imageMove.image.subresourceImageViews) oldImageViews.push_back(subresourceImageView.imageView);
+                imageMove.image.subresourceImageViews.clear();
+            }
+
+            const VkImage oldImage = imageMove.image.image;
+            device.QueueHandleForDestruction([&owningDevice, oldImage, oldImageViews]
+            {
+                for (const VkImageView oldImageView : oldImageViews) owningDevice.GetFunctionTable().vkDestroyImageView(owningDevice.GetLogicalDevice(), oldImageView, nullptr);
+                owningDevice.GetFunctionTable().vkDestroyImage(owningDevice.GetLogicalDevice(), oldImage, nullptr);
+            });
+
+            imageMove.image.image = imageMove.newImage;
+            device.SetObjectName(imageMove.image.image, VK_OBJECT_TYPE_IMAGE, imageMove.image.GetName());
+            imageMove.image.CreateImageViews();
+        }
+
+        return true;
+    }
+
+    /* --- DESTRUCTOR --- */
+
+    VulkanDefragmenter::~VulkanDefragmenter()
+    {
+        if (passPending)
+        {
+            device.WaitForSignalValue(passSignalValue);
+            EndDefragmentationPass();
+        }
+        if (defragmentationContext != nullptr) EndDefragmentation();
+        device.GetFunctionTable().vkDestroyCommandPool(device.GetLogicalDevice(), commandPool, nullptr);
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    bool VulkanDefragmenter::PrepareBufferMove(VulkanBuffer &buffer, const VmaAllocation destinationAllocation, std::vector<BufferMove> &bufferMoves) const
+    {
+        // Mapped memory is referenced by the application, so it must stay in place
+        if (buffer.data != nullptr) return false;
+
+        // Set up buffer create info
+        VkBufferCreateInfo bufferCreateInfo = { };
+        bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferCreateInfo.size = buffer.GetMemorySize();
+        bufferCreateInfo.usage = buffer.GetVulkanUsageFlags();
+        bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        // Create buffer and bind it to its new memory
+        VkBuffer newBuffer = VK_NULL_HANDLE;
+        if (device.GetFunctionTable().vkCreateBuffer(device.GetLogicalDevice(), &bufferCreateInfo, nullptr, &newBuffer) != VK_SUCCESS) return false;
+        if (vmaBindBufferMemory(device.GetMemoryAllocator(), destinationAllocation, newBuffer) != VK_SUCCESS)
+        {
+            device.GetFunctionTable().vkDestroyBuffer(device.GetLogicalDevice(), newBuffer, nullptr);
+            return false;
+        }
+
+        bufferMoves.push_back({ .buffer = buffer, .newBuffer = newBuffer });
+        return true;
+    }
+
+    bool VulkanDefragmenter::PrepareImageMove(VulkanImage &image, const VmaAllocation destinationAllocation, std::vector<ImageMove> &imageMoves) const
+    {
+        // Attachments change layouts within render passes, so their layout is never known
+        constexpr VkImageUsageFlags ATTACHMENT_USAGE_FLAGS = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+        if (image.imageCreateInfo.usage & ATTACHMENT_USAGE_FLAGS) return false;
+
+        // Images, whose contents are still undefined, need not be copied
+        const bool copied = image.GetVulkanLayout() != VK_IMAGE_LAYOUT_UNDEFINED;
+        if (copied && (image.GetVulkanLayout() == VK_IMAGE_LAYOUT_MAX_ENUM || (image.imageCreateInfo.usage & (VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT)) != (VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT))) return false;
+
+        // Create image and bind it to its new memory
+        VkImage newImage = VK_NULL_HANDLE;
+        if (device.GetFunctionTable().vkCreateImage(device.GetLogicalDevice(), &image.imageCreateInfo, nullptr, &newImage) != VK_SUCCESS) return false;
+        if (vmaBindImageMemory(device.GetMemoryAllocator(), destinationAllocation, newImage) != VK_SUCCESS)
+        {
+            device.GetFunctionTable().vkDestroyImage(device.GetLogicalDevice(), newImage, nullptr);
+            return false;
+        }
+
+        imageMoves.push_back({ .image = image, .newImage = newImage, .copied = copied });
+        return true;
+    }
+
+    bool VulkanDefragmenter::EndDefragmentationPass()
+    {
+        // Resources, which are still alive, now own their new memory outright (destroyed ones have marked their moves accordingly)
+        for (uint32 i = 0; i < passMoveInfo.moveCount; i++)
+        {
+            const VmaDefragmentationMove &move = passMoveInfo.pMoves[i];
+            if (move.operation != VMA_DEFRAGMENTATION_MOVE_OPERATION_COPY) continue;
+
+            VmaAllocationInfo allocationInfo = { };
+            vmaGetAllocationInfo(device.GetMemoryAllocator(), move.srcAllocation, &allocationInfo);
+            reinterpret_cast<VulkanAllocationOwner*>(allocationInfo.pUserData)->pendingMove = nullptr;
+        }
+        passPending = false;
+
+        // Let allocations take over their new memory (VK_SUCCESS here means there is nothing left to move)
+        const VkResult result = vmaEndDefragmentationPass(device.GetMemoryAllocator(), defragmentationContext, &passMoveInfo);
+        if (result == VK_SUCCESS)
+        {
+            EndDefragmentation();
+            return false;
+        }
+        SR_ERROR_IF(result != VK_INCOMPLETE, "[Vulkan]: Could not end defragmentation pass of device [{0}]! Error code: {1}.", device.GetName(), result);
+
+        return true;
+    }
+
+    void VulkanDefragmenter::EndDefragmentation()
+    {
+        vmaEndDefragmentation(device.GetMemoryAllocator(), defragmentationContext, nullptr);
+        defragmentationContext = nullptr;
+    }
+
+}
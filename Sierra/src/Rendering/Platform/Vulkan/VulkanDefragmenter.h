@@ -0,0 +1,76 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "VulkanResource.h"
+
+#include "VulkanDevice.h"
+
+namespace Sierra
+{
+
+    class VulkanBuffer;
+    class VulkanImage;
+
+    // Stored as user data of every allocation, so the defragmenter can patch the resource it moves
+    struct VulkanAllocationOwner
+    {
+        VulkanBuffer* buffer = nullptr;
+        VulkanImage* image = nullptr;
+        VmaDefragmentationMove* pendingMove = nullptr; // Set while the resource's memory is being moved, in which case the defragmenter frees its old allocation
+    };
+
+    class SIERRA_API VulkanDefragmenter final
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        explicit VulkanDefragmenter(const VulkanDevice &device);
+
+        /* --- POLLING METHODS --- */
+        // Moves at most the given amount of allocations (the limits of the step, which started the current defragmentation, apply until it is finished), and returns whether more steps remain (copies are submitted by one step, and only finished by a later one, once they have executed)
+        bool Defragment(uint64 maxBytesPerStep, uint32 maxAllocationsPerStep);
+
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] inline bool IsDefragmenting() const { return defragmentationContext != nullptr; }
+
+        /* --- OPERATORS --- */
+        VulkanDefragmenter(const VulkanDefragmenter&) = delete;
+        VulkanDefragmenter& operator=(const VulkanDefragmenter&) = delete;
+
+        /* --- DESTRUCTOR --- */
+        ~VulkanDefragmenter();
+
+    private:
+        const VulkanDevice &device;
+
+        VkCommandPool commandPool = VK_NULL_HANDLE;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VmaDefragmentationContext defragmentationContext = nullptr;
+
+        VmaDefragmentationPassMoveInfo passMoveInfo = { };
+        uint64 passSignalValue = 0;
+        bool passPending = false;
+
+        struct BufferMove
+        {
+            VulkanBuffer &buffer;
+            VkBuffer newBuffer = VK_NULL_HANDLE;
+        };
+
+        struct ImageMove
+        {
+            VulkanImage &image;
+            VkImage newImage = VK_NULL_HANDLE;
+            bool copied = false;
+        };
+
+        [[nodiscard]] bool PrepareBufferMove(VulkanBuffer &buffer, VmaAllocation destinationAllocation, std::vector<BufferMove> &bufferMoves) const;
+        [[nodiscard]] bool PrepareImageMove(VulkanImage &image, VmaAllocation destinationAllocation, std::vector<ImageMove> &imageMoves) const;
+        bool EndDefragmentationPass();
+        void EndDefragmentation();
+
+    };
+
+}
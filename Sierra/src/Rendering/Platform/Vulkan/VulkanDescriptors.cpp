@@ -18,13 +18,8 @@ namespace Sierra
 
     void VulkanPushDescriptorSet::BindBuffer(const uint32 binding, const VulkanBuffer &buffer, const uint32 arrayIndex, const uint64 memoryRange, const uint64 byteOffset)
     {
-        // Check if resource has already been bound
-        auto descriptorSetIterator = std::find_if(writeDescriptorSets.begin(), writeDescriptorSets.end(), [binding, arrayIndex](const VkWriteDescriptorSet &item) { return item.dstBinding == binding && item.dstArrayElement == arrayIndex; });
-        if (descriptorSetIterator == writeDescriptorSets.end())
-        {
-            writeDescriptorSets.emplace_back();
-            descriptorSetIterator = writeDescriptorSets.end() - 1;
-        }
+        const auto descriptorSetIterator = GetWriteDescriptorSet(binding, arrayIndex);
+        layoutResolvedDescriptors[descriptorSetIterator - writeDescriptorSets.begin()] = false;
 
         // Overwrite resource data
         descriptorSetIterator->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -42,15 +37,10 @@ namespace Sierra
         descriptorSetIterator->pBufferInfo = bufferInfo;
     }
 
-    void VulkanPushDescriptorSet::BindImage(const uint32 binding, const VulkanImage &image, const VulkanSampler* sampler, const VkImageLayout imageLayout, const uint32 arrayIndex)
+    void VulkanPushDescriptorSet::BindImage(const uint32 binding, const VkImageView imageView, const VkDescriptorType descriptorType, const VkSampler sampler, const VkImageLayout imageLayout, const uint32 arrayIndex)
     {
-        // Check if resource has already been bound
-        auto descriptorSetIterator = std::find_if(writeDescriptorSets.begin(), writeDescriptorSets.end(), [binding, arrayIndex](const VkWriteDescriptorSet &item) { return item.dstBinding == binding && item.dstArrayElement == arrayIndex; });
-        if (descriptorSetIterator == writeDescriptorSets.end())
-        {
-            writeDescriptorSets.emplace_back();
-            descriptorSetIterator = writeDescriptorSets.end() - 1;
-        }
+        const auto descriptorSetIterator = GetWriteDescriptorSet(binding, arrayIndex);
+        layoutResolvedDescriptors[descriptorSetIterator - writeDescriptorSets.begin()] = false;
 
         // Overwrite resource data
         descriptorSetIterator->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -58,14 +48,49 @@ namespace Sierra
         descriptorSetIterator->dstBinding = binding;
         descriptorSetIterator->dstArrayElement = arrayIndex;
         descriptorSetIterator->descriptorCount = 1;
-        descriptorSetIterator->descriptorType = sampler != nullptr ? VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER : VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        descriptorSetIterator->descriptorType = descriptorType;
 
         // Set up buffer info
         VkDescriptorImageInfo* imageInfo = descriptorSetIterator->pImageInfo != nullptr ? const_cast<VkDescriptorImageInfo*>(descriptorSetIterator->pImageInfo) : &imageInfos.emplace_back();
-        imageInfo->sampler = sampler != nullptr ? sampler->GetVulkanSampler() : VK_NULL_HANDLE;
-        imageInfo->imageView = image.GetVulkanImageView();
+        imageInfo->sampler = sampler; // Ignored for bindings with an immutable sampler
+        imageInfo->imageView = imageView;
         imageInfo->imageLayout = imageLayout;
         descriptorSetIterator->pImageInfo = imageInfo;
     }
 
+    void VulkanPushDescriptorSet::BindImage(const uint32 binding, const VkImageView imageView, const uint32 arrayIndex)
+    {
+        // Image is treated as storage until resolved
+        BindImage(binding, imageView, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_NULL_HANDLE, VK_IMAGE_LAYOUT_GENERAL, arrayIndex);
+        layoutResolvedDescriptors[GetWriteDescriptorSet(binding, arrayIndex) - writeDescriptorSets.begin()] = true;
+    }
+
+    void VulkanPushDescriptorSet::ResolveImageDescriptors(const VulkanPipelineLayout &layout)
+    {
+        for (size i = 0; i < writeDescriptorSets.size(); i++)
+        {
+            if (!layoutResolvedDescriptors[i]) continue;
+            VkWriteDescriptorSet &writeDescriptorSet = writeDescriptorSets[i];
+
+            // Images without a sampler are sampled through the binding's immutable sampler (or read as input attachments), and are otherwise used as storage
+            const PipelineBindingType bindingType = writeDescriptorSet.dstBinding < layout.GetBindings().size() ? layout.GetBindings()[writeDescriptorSet.dstBinding].type : PipelineBindingType::Undefined;
+            const bool sampled = bindingType == PipelineBindingType::Texture || bindingType == PipelineBindingType::InputAttachment;
+            writeDescriptorSet.descriptorType = sampled ? VulkanPipelineLayout::PipelineBindingTypeToVkDescriptorType(bindingType) : VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            const_cast<VkDescriptorImageInfo*>(writeDescriptorSet.pImageInfo)->imageLayout = sampled ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL;
+        }
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    std::vector<VkWriteDescriptorSet>::iterator VulkanPushDescriptorSet::GetWriteDescriptorSet(const uint32 binding, const uint32 arrayIndex)
+    {
+        // Check if resource has already been bound
+        const auto descriptorSetIterator = std::find_if(writeDescriptorSets.begin(), writeDescriptorSets.end(), [binding, arrayIndex](const VkWriteDescriptorSet &item) { return item.dstBinding == binding && item.dstArrayElement == arrayIndex; });
+        if (descriptorSetIterator != writeDescriptorSets.end()) return descriptorSetIterator;
+
+        writeDescriptorSets.emplace_back();
+        layoutResolvedDescriptors.push_back(false);
+        return writeDescriptorSets.end() - 1;
+    }
+
 }
\ No newline at end of file
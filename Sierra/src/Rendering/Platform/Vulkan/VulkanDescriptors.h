@@ -9,6 +9,7 @@
 #include "VulkanBuffer.h"
 #include "VulkanImage.h"
 #include "VulkanSampler.h"
+#include "VulkanPipelineLayout.h"
 
 namespace Sierra
 {
@@ -26,7 +27,9 @@ namespace Sierra
 
         /* --- POLLING METHODS --- */
         void BindBuffer(uint32 binding, const VulkanBuffer &buffer, uint32 arrayIndex = 0, uint64 memoryRange = 0, uint64 byteOffset = 0);
-        void BindImage(uint32 binding, const VulkanImage &image, const VulkanSampler* sampler, VkImageLayout imageLayout, uint32 arrayIndex = 0);
+        void BindImage(uint32 binding, VkImageView imageView, VkDescriptorType descriptorType, VkSampler sampler, VkImageLayout imageLayout, uint32 arrayIndex = 0);
+        void BindImage(uint32 binding, VkImageView imageView, uint32 arrayIndex = 0); // Descriptor type and image layout are resolved from the binding's type, once the layout to push with is known
+        void ResolveImageDescriptors(const VulkanPipelineLayout &layout);
 
         /* --- GETTER METHODS --- */
         [[nodiscard]] const std::vector<VkWriteDescriptorSet>& GetWriteDescriptorSets() const { return writeDescriptorSets; }
@@ -40,10 +43,13 @@ namespace Sierra
 
     private:
         std::vector<VkWriteDescriptorSet> writeDescriptorSets;
+        std::vector<bool> layoutResolvedDescriptors; // Whether descriptor at the same index in writeDescriptorSets is an image, whose type is resolved from the layout
 
         std::deque<VkDescriptorBufferInfo> bufferInfos;
         std::deque<VkDescriptorImageInfo> imageInfos;
 
+        std::vector<VkWriteDescriptorSet>::iterator GetWriteDescriptorSet(uint32 binding, uint32 arrayIndex);
+
     };
 
 }
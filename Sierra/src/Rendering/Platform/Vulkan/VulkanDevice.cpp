@@ -17,6 +17,12 @@
 #include "VulkanImage.h"
 #include "VulkanCommandBuffer.h"
 #include "VulkanSwapchain.h"
+#include "VulkanMipMapGenerator.h"
+#include "VulkanDefragmenter.h"
+#include "VulkanPipelineLayoutCache.h"
+#include "VulkanPipelineLibraryCache.h"
+#include "VulkanRenderPassCache.h"
+#include "VulkanSamplerCache.h"
 
 namespace Sierra
 {
@@ -72,6 +78,7 @@ namespace Sierra
                 if (!foundGeneralQueueFamily && properties.queueFlags & VK_QUEUE_TRANSFER_BIT && properties.queueFlags & VK_QUEUE_COMPUTE_BIT && properties.queueFlags & VK_QUEUE_GRAPHICS_BIT)
                 {
                     generalQueueFamily = i;
+                    generalQueueFamilyTimestampValidBits = properties.timestampValidBits;
                     foundGeneralQueueFamily = true;
                 }
 
@@ -116,6 +123,18 @@ namespace Sierra
         extensionsToLoad.reserve(DEVICE_EXTENSIONS_TO_QUERY.size());
         for (const auto &extension : DEVICE_EXTENSIONS_TO_QUERY)
         {
+            // Swapchain extensions depend on surface ones, which headless instances do not load
+            if (instance.IsHeadless() && extension.presentationOnly)
+            {
+                // Data of skipped extensions (and their dependencies) is never chained, but still has to be freed with the rest
+                static std::function<void(const VulkanDeviceExtension&, std::vector<void*>&)> const CollectExtensionTreeDataLambda = [](const VulkanDeviceExtension &skippedExtension, std::vector<void*> &extensionData)
+                {
+                    if (skippedExtension.data != nullptr) extensionData.push_back(skippedExtension.data);
+                    for (const auto &dependency : skippedExtension.dependencies) CollectExtensionTreeDataLambda(dependency, extensionData);
+                };
+                CollectExtensionTreeDataLambda(extension, extensionDataToFree);
+                continue;
+            }
             AddExtensionIfSupported(extension, supportedExtensions, &physicalDeviceFeatures2, extensionsToLoad, extensionDataToFree);
         }
 
@@ -986,7 +1005,7 @@ namespace Sierra
         vmaCreteInfo.device = logicalDevice;
         vmaCreteInfo.vulkanApiVersion = instance.GetAPIVersion();
         vmaCreteInfo.pVulkanFunctions = &vulkanFunctions;
-        vmaCreteInfo.flags = VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+        if (IsExtensionLoaded(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)) vmaCreteInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
 
         // Create allocator
         vmaCreateAllocator(&vmaCreteInfo, &vmaAllocator);
@@ -994,6 +1013,12 @@ namespace Sierra
         // Set device names
         SetObjectName(physicalDevice, VK_OBJECT_TYPE_PHYSICAL_DEVICE, "Physical device of device [" + GetName() + "]");
         SetObjectName(logicalDevice, VK_OBJECT_TYPE_DEVICE, "Logical device of device [" + GetName() + "]");
+
+        // Create caches up front, as resources may be created from multiple threads (without the extension, graphics pipelines fall back to being compiled as a whole)
+        if (IsExtensionLoaded(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME)) pipelineLibraryCache = std::make_unique<VulkanPipelineLibraryCache>(*this);
+        pipelineLayoutCache = std::make_unique<VulkanPipelineLayoutCache>(*this);
+        renderPassCache = std::make_unique<VulkanRenderPassCache>(*this);
+        samplerCache = std::make_unique<VulkanSamplerCache>(*this);
     }
 
     /* --- POLLING METHODS --- */
@@ -1038,27 +1063,66 @@ namespace Sierra
         // Submit command buffer
         const VkResult result = functionTable.vkQueueSubmit(generalQueue, 1, &submitInfo, VK_NULL_HANDLE);
         SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Submission of command buffer [{0}] from device [{1}] failed! Error code: {2}.", vulkanCommandBuffer.GetName(), GetName(), result);
+        lastSubmittedSignalValue = std::max(lastSubmittedSignalValue, signalValue);
+
+        // Images are now left in the layouts the command buffer has transitioned them to, once all submitted work executes
+        for (const auto &[image, layout] : vulkanCommandBuffer.GetRecordedImageLayouts()) image->SetVulkanLayout(layout);
     }
 
-    void VulkanDevice::WaitForCommandBuffer(const std::unique_ptr<CommandBuffer> &commandBuffer) const
+    void VulkanDevice::SubmitVulkanCommandBuffer(VkCommandBuffer commandBuffer, const uint64 signalValue, const std::string &name) const
     {
-        SR_ERROR_IF(commandBuffer->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot, on device [{0}], wait for command buffer [{1}], as its graphics API differs from [GraphicsAPI::Vulkan]!", GetName(), commandBuffer->GetName());
-        const VulkanCommandBuffer &vulkanCommandBuffer = static_cast<VulkanCommandBuffer&>(*commandBuffer);
+        // Set up semaphore submit info
+        VkTimelineSemaphoreSubmitInfo semaphoreSubmitInfo = { };
+        semaphoreSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        semaphoreSubmitInfo.signalSemaphoreValueCount = 1;
+        semaphoreSubmitInfo.pSignalSemaphoreValues = &signalValue;
 
+        // Set up submit info
+        VkSubmitInfo submitInfo = { };
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &sharedTimelineSemaphore;
+        submitInfo.pNext = &semaphoreSubmitInfo;
+
+        // Submit command buffer
+        const VkResult result = functionTable.vkQueueSubmit(generalQueue, 1, &submitInfo, VK_NULL_HANDLE);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Submission of {0} from device [{1}] failed! Error code: {2}.", name, GetName(), result);
+        lastSubmittedSignalValue = std::max(lastSubmittedSignalValue, signalValue);
+    }
+
+    bool VulkanDevice::WaitForSignalValue(const uint64 signalValue, const uint64 timeoutInNanoseconds) const
+    {
         // Set up wait info
-        const uint64 waitValue = vulkanCommandBuffer.GetCompletionSignalValue();
         VkSemaphoreWaitInfo waitInfo = { };
         waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
         waitInfo.semaphoreCount = 1;
         waitInfo.pSemaphores = &sharedTimelineSemaphore;
-        waitInfo.pValues = &waitValue;
+        waitInfo.pValues = &signalValue;
 
         // Wait for semaphore
-        vkWaitSemaphores(logicalDevice, &waitInfo, std::numeric_limits<uint64>::max());
+        const VkResult result = functionTable.vkWaitSemaphores(logicalDevice, &waitInfo, timeoutInNanoseconds);
+        SR_ERROR_IF(result != VK_SUCCESS && result != VK_TIMEOUT, "[Vulkan]: Could not wait for signal value [{0}] on device [{1}]! Error code: {2}.", signalValue, GetName(), result);
+
+        return result == VK_SUCCESS;
+    }
+
+    bool VulkanDevice::DefragmentMemory(const uint64 maxBytesPerStep, const uint32 maxAllocationsPerStep) const
+    {
+        if (defragmenter == nullptr) defragmenter = std::make_unique<VulkanDefragmenter>(*this);
+        return defragmenter->Defragment(maxBytesPerStep, maxAllocationsPerStep);
     }
 
     /* --- GETTER METHODS --- */
 
+    uint64 VulkanDevice::GetCompletedSignalValue() const
+    {
+        uint64 signalValue = 0;
+        functionTable.vkGetSemaphoreCounterValue(logicalDevice, sharedTimelineSemaphore, &signalValue);
+        return signalValue;
+    }
+
     bool VulkanDevice::IsImageFormatSupported(const ImageFormat format, const ImageUsage usage) const
     {
         // Get format properties
@@ -1074,7 +1138,7 @@ namespace Sierra
         if (usage & ImageUsage::ColorAttachment     && !(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT)) return false;
         if (usage & ImageUsage::DepthAttachment     && !(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT   )) return false;
         if (usage & ImageUsage::InputAttachment     && !(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT              )) return false;
-        if (usage & ImageUsage::TransientAttachment && !(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT           )) return false;
+        if (usage & ImageUsage::TransientAttachment && !(formatProperties.optimalTilingFeatures & (VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT | VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT))) return false;
         return true;
     }
 
@@ -1103,11 +1167,62 @@ namespace Sierra
         return anisotropy == SamplerAnisotropy::x1;
     }
 
+    bool VulkanDevice::IsQueryTypeSupported(const QueryType queryType) const
+    {
+        switch (queryType)
+        {
+            case QueryType::Occlusion:                  return true;
+            case QueryType::PipelineStatistics:         return GetPhysicalDeviceFeatures().pipelineStatisticsQuery;
+            case QueryType::Timestamp:                  return GetPhysicalDeviceProperties().limits.timestampComputeAndGraphics;
+        }
+
+        return false;
+    }
+
+    bool VulkanDevice::IsExtendedDynamicStateSupported() const
+    {
+        return IsExtensionLoaded(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+    }
+
     bool VulkanDevice::IsExtensionLoaded(const std::string &extensionName) const
     {
         return std::find(loadedExtensions.begin(), loadedExtensions.end(), std::hash<std::string>{}(extensionName)) != loadedExtensions.end();
     }
 
+    const VulkanMipMapGenerator* VulkanDevice::GetMipMapGenerator() const
+    {
+        // Generator is only created on first use, and never if its shader has not been shipped
+        if (!mipMapGeneratorQueried)
+        {
+            mipMapGeneratorQueried = true;
+            if (IsExtensionLoaded(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME) && File::FileExists(File::GetResourcesDirectoryPath() / "shaders/MipMapGenerator.comp.shader/shader.spv"))
+            {
+                mipMapGenerator = std::make_unique<VulkanMipMapGenerator>(*this);
+            }
+        }
+        return mipMapGenerator.get();
+    }
+
+    const VulkanPipelineLibraryCache* VulkanDevice::GetPipelineLibraryCache() const
+    {
+        return pipelineLibraryCache.get();
+    }
+
+    const VulkanPipelineLayoutCache& VulkanDevice::GetPipelineLayoutCache() const
+    {
+        return *pipelineLayoutCache;
+    }
+
+    const VulkanRenderPassCache& VulkanDevice::GetRenderPassCache() const
+    {
+        return *renderPassCache;
+    }
+
+    const VulkanSamplerCache& VulkanDevice::GetSamplerCache() const
+    {
+        return *samplerCache;
+    }
+
     VkPhysicalDeviceProperties VulkanDevice::GetPhysicalDeviceProperties() const
     {
         VkPhysicalDeviceProperties physicalDeviceProperties = { };
@@ -1141,6 +1256,27 @@ namespace Sierra
         #endif
     }
 
+    /* --- PROTECTED METHODS --- */
+
+    void VulkanDevice::QueryMemoryHeapBudgets(std::vector<MemoryHeapBudget> &heapBudgets) const
+    {
+        // Advancing the frame index makes the allocator refetch budgets from the driver (without VK_EXT_memory_budget, they are instead estimated from its own allocations)
+        memoryBudgetFrameIndex++;
+        vmaSetCurrentFrameIndex(vmaAllocator, memoryBudgetFrameIndex);
+
+        const VkPhysicalDeviceMemoryProperties* memoryProperties = nullptr;
+        vmaGetMemoryProperties(vmaAllocator, &memoryProperties);
+
+        std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets = { };
+        vmaGetHeapBudgets(vmaAllocator, budgets.data());
+
+        heapBudgets.resize(memoryProperties->memoryHeapCount);
+        for (uint32 i = 0; i < memoryProperties->memoryHeapCount; i++)
+        {
+            heapBudgets[i] = { .usage = budgets[i].usage, .budget = budgets[i].budget, .deviceLocal = (memoryProperties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0 };
+        }
+    }
+
     /* --- PRIVATE METHODS --- */
 
     bool VulkanDevice::IsExtensionSupported(const char* extensionName, const std::vector<VkExtensionProperties> &supportedExtensions)
@@ -1205,6 +1341,13 @@ namespace Sierra
 
     VulkanDevice::~VulkanDevice()
     {
+        DestroyAllQueuedResources();
+        mipMapGenerator = nullptr;
+        defragmenter = nullptr;
+        pipelineLibraryCache = nullptr;
+        pipelineLayoutCache = nullptr;
+        renderPassCache = nullptr;
+        samplerCache = nullptr;
         functionTable.vkDestroySemaphore(logicalDevice, sharedTimelineSemaphore, nullptr);
         vmaDestroyAllocator(vmaAllocator);
         functionTable.vkDestroyDevice(logicalDevice, nullptr);
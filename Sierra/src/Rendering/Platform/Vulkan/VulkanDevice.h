@@ -13,6 +13,12 @@
 namespace Sierra
 {
 
+    class VulkanMipMapGenerator;
+    class VulkanDefragmenter;
+    class VulkanPipelineLibraryCache;
+    class VulkanPipelineLayoutCache;
+    class VulkanRenderPassCache;
+    class VulkanSamplerCache;
     class SIERRA_API VulkanDevice final : public Device, public VulkanResource
     {
     public:
@@ -21,30 +27,43 @@ namespace Sierra
 
         /* --- POLLING METHODS --- */
         void SubmitCommandBuffer(std::unique_ptr<CommandBuffer> &commandBuffer,  const std::initializer_list<std::reference_wrapper<std::unique_ptr<CommandBuffer>>> &commandBuffersToWait = { }) const override;
-        void WaitForCommandBuffer(const std::unique_ptr<CommandBuffer> &commandBuffer) const override;
+        bool WaitForSignalValue(uint64 signalValue, uint64 timeoutInNanoseconds = std::numeric_limits<uint64>::max()) const override;
+        void SubmitVulkanCommandBuffer(VkCommandBuffer commandBuffer, uint64 signalValue, const std::string &name) const; // For internally recorded work (e.g. defragmentation copies), which signals the shared semaphore once executed
+        bool DefragmentMemory(uint64 maxBytesPerStep = 64 * 1024 * 1024, uint32 maxAllocationsPerStep = 64) const override;
 
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline const std::string& GetDeviceName() const override { return deviceName; }
+        [[nodiscard]] uint64 GetCompletedSignalValue() const override;
 
         [[nodiscard]] bool IsImageFormatSupported(ImageFormat format, ImageUsage usage) const override;
         [[nodiscard]] bool IsImageSamplingSupported(ImageSampling sampling) const override;
         [[nodiscard]] bool IsSamplerAnisotropySupported(SamplerAnisotropy anisotropy) const override;
+        [[nodiscard]] bool IsQueryTypeSupported(QueryType queryType) const override;
+        [[nodiscard]] bool IsExtendedDynamicStateSupported() const override;
 
         [[nodiscard]] inline VkPhysicalDevice GetPhysicalDevice() const { return physicalDevice; }
         [[nodiscard]] inline VkDevice GetLogicalDevice() const { return logicalDevice; }
         [[nodiscard]] inline VmaAllocator GetMemoryAllocator() const { return vmaAllocator; }
 
         [[nodiscard]] inline uint32 GetGeneralQueueFamily() const { return generalQueueFamily; }
+        [[nodiscard]] inline uint32 GetGeneralQueueFamilyTimestampValidBits() const { return generalQueueFamilyTimestampValidBits; }
         [[nodiscard]] inline VkQueue GetGeneralQueue() const { return generalQueue; }
 
         [[nodiscard]] inline VkSemaphore GetSharedSignalSemaphore() const { return sharedTimelineSemaphore; }
         [[nodiscard]] inline uint64 GetNewSignalValue() const { lastReservedSignalValue++; return lastReservedSignalValue; }
+        [[nodiscard]] inline uint64 GetLastReservedSignalValue() const { return lastReservedSignalValue; }
+        [[nodiscard]] inline uint64 GetLastSubmittedSignalValue() const override { return lastSubmittedSignalValue; }
 
-        [[nodiscard]] inline VkPhysicalDeviceProperties GetPhysicalDeviceProperties() const;
-        [[nodiscard]] inline VkPhysicalDeviceFeatures GetPhysicalDeviceFeatures() const;
+        [[nodiscard]] VkPhysicalDeviceProperties GetPhysicalDeviceProperties() const;
+        [[nodiscard]] VkPhysicalDeviceFeatures GetPhysicalDeviceFeatures() const;
 
         [[nodiscard]] bool IsExtensionLoaded(const std::string &extensionName) const;
         [[nodiscard]] inline auto& GetFunctionTable() const { return functionTable; }
+        [[nodiscard]] const VulkanMipMapGenerator* GetMipMapGenerator() const;
+        [[nodiscard]] const VulkanPipelineLibraryCache* GetPipelineLibraryCache() const;
+        [[nodiscard]] const VulkanPipelineLayoutCache& GetPipelineLayoutCache() const;
+        [[nodiscard]] const VulkanRenderPassCache& GetRenderPassCache() const;
+        [[nodiscard]] const VulkanSamplerCache& GetSamplerCache() const;
 
         /* --- SETTER METHODS --- */
         void SetObjectName(VkHandle object, VkObjectType objectType, const std::string &name) const;
@@ -52,6 +71,9 @@ namespace Sierra
         /* --- DESTRUCTOR --- */
         ~VulkanDevice() override;
 
+    protected:
+        void QueryMemoryHeapBudgets(std::vector<MemoryHeapBudget> &heapBudgets) const override;
+
     private:
         const VulkanInstance &instance;
 
@@ -861,17 +883,31 @@ namespace Sierra
         VmaAllocator vmaAllocator = VK_NULL_HANDLE;
 
         uint32 generalQueueFamily = 0;
+        uint32 generalQueueFamilyTimestampValidBits = 0;
         VkQueue generalQueue = VK_NULL_HANDLE;
 
         mutable uint64 lastReservedSignalValue = 0;
+        mutable uint64 lastSubmittedSignalValue = 0;
         VkSemaphore sharedTimelineSemaphore = VK_NULL_HANDLE;
 
+        mutable uint32 memoryBudgetFrameIndex = 0;
+
+        mutable std::unique_ptr<VulkanMipMapGenerator> mipMapGenerator = nullptr;
+        mutable bool mipMapGeneratorQueried = false;
+
+        mutable std::unique_ptr<VulkanDefragmenter> defragmenter = nullptr;
+        std::unique_ptr<VulkanPipelineLibraryCache> pipelineLibraryCache = nullptr; // Only created if graphics pipeline libraries are supported
+        std::unique_ptr<VulkanPipelineLayoutCache> pipelineLayoutCache = nullptr;
+        std::unique_ptr<VulkanRenderPassCache> renderPassCache = nullptr;
+        std::unique_ptr<VulkanSamplerCache> samplerCache = nullptr;
+
         struct VulkanDeviceExtension
         {
             std::string name;
             void* data = nullptr;
             std::vector<VulkanDeviceExtension> dependencies = { };
             bool requiredOnlyIfSupported = false;
+            bool presentationOnly = false;
         };
         const std::vector<VulkanDeviceExtension> DEVICE_EXTENSIONS_TO_QUERY
         {
@@ -915,6 +951,19 @@ namespace Sierra
             {
                 .name = VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME
             },
+            {
+                .name = VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+                .requiredOnlyIfSupported = true
+            },
+            {
+                // Core in Vulkan 1.3
+                .name = VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME,
+                .data = new VkPhysicalDeviceExtendedDynamicStateFeaturesEXT {
+                    .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT,
+                    .extendedDynamicState = VK_TRUE
+                },
+                .requiredOnlyIfSupported = true
+            },
             {
                 // Core in Vulkan 1.2
                 .name = VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
@@ -924,7 +973,41 @@ namespace Sierra
                 }
             },
             {
-                .name = VK_KHR_SWAPCHAIN_EXTENSION_NAME
+                .name = VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME,
+                .data = new VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT {
+                    .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT,
+                    .graphicsPipelineLibrary = VK_TRUE
+                },
+                .dependencies = {
+                    {
+                        .name = VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME,
+                        .requiredOnlyIfSupported = true
+                    }
+                },
+                .requiredOnlyIfSupported = true
+            },
+            {
+                .name = VK_KHR_SWAPCHAIN_EXTENSION_NAME,
+                .presentationOnly = true
+            },
+            {
+                .name = VK_KHR_PRESENT_WAIT_EXTENSION_NAME,
+                .data = new VkPhysicalDevicePresentWaitFeaturesKHR {
+                    .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR,
+                    .presentWait = VK_TRUE
+                },
+                .dependencies = {
+                    {
+                        .name = VK_KHR_PRESENT_ID_EXTENSION_NAME,
+                        .data = new VkPhysicalDevicePresentIdFeaturesKHR {
+                            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+                            .presentId = VK_TRUE
+                        },
+                        .requiredOnlyIfSupported = true
+                    }
+                },
+                .requiredOnlyIfSupported = true,
+                .presentationOnly = true
             },
         };
         std::vector<Hash> loadedExtensions;
@@ -14,7 +14,7 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     VulkanGraphicsPipeline::VulkanGraphicsPipeline(const VulkanDevice &device, const GraphicsPipelineCreateInfo &createInfo)
-        : GraphicsPipeline(createInfo), VulkanResource(createInfo.name), device(device), layout(static_cast<VulkanPipelineLayout&>(*createInfo.layout))
+        : GraphicsPipeline(createInfo), VulkanResource(createInfo.name), device(device), layout(static_cast<VulkanPipelineLayout&>(*createInfo.layout)), hasExtendedDynamicState(device.IsExtendedDynamicStateSupported()), cullMode(CullModeToVkCullMode(createInfo.cullMode)), frontFace(FrontFaceModeToVkFrontFace(createInfo.frontFaceMode)), depthWriteEnable(createInfo.depthMode == DepthMode::WriteDepth)
     {
         SR_ERROR_IF(createInfo.layout->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot create graphics pipeline [{0}] with pipeline layout [{1}], as its graphics API differs from [GraphicsAPI::Vulkan]!", GetName(), createInfo.layout->GetName());
 
@@ -24,12 +24,18 @@ namespace Sierra
         SR_ERROR_IF(createInfo.templateRenderPass->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot create graphics pipeline [{0}] with render pass [{1}], as its graphics API differs from [GraphicsAPI::Vulkan]!", GetName(), createInfo.templateRenderPass->GetName());
         const VulkanRenderPass &vulkanRenderPass = static_cast<VulkanRenderPass&>(*createInfo.templateRenderPass);
 
+        // Set up specialization constants (IDs, which a stage does not declare, are ignored by it, so both stages share the same info)
+        std::vector<VkSpecializationMapEntry> specializationMapEntries;
+        std::vector<uint32> specializationData;
+        const VkSpecializationInfo specializationInfo = VulkanShader::ShaderConstantsToVkSpecializationInfo(createInfo.shaderConstants, specializationMapEntries, specializationData);
+
         // Set up shader stages
         std::vector<VkPipelineShaderStageCreateInfo> shaderStages(1 + createInfo.fragmentShader.has_value());
         shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
         shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
         shaderStages[0].module = vulkanVertexShader.GetVulkanShaderModule();
         shaderStages[0].pName = "main";
+        shaderStages[0].pSpecializationInfo = createInfo.shaderConstants.size() != 0 ? &specializationInfo : nullptr;
         if (createInfo.fragmentShader.has_value())
         {
             SR_ERROR_IF(createInfo.fragmentShader->get()->GetAPI() != GraphicsAPI::Vulkan, "[Vulkan]: Cannot create graphics pipeline [{0}] with fragment shader [{1}], as its graphics API differs from [GraphicsAPI::Vulkan]!", GetName(), createInfo.vertexShader->GetName());
@@ -38,14 +44,18 @@ namespace Sierra
             shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
             shaderStages[1].module = vulkanFragmentShader.GetVulkanShaderModule();
             shaderStages[1].pName = "main";
+            shaderStages[1].pSpecializationInfo = createInfo.shaderConstants.size() != 0 ? &specializationInfo : nullptr;
         }
 
-        // Set up vertex attributes
-        uint32 vertexDataSize = 0;
+        // Set up vertex attributes (offsets are relative to the stream each input is read from)
+        std::array<uint32, MAX_VERTEX_STREAM_COUNT> vertexStreamStrides = { };
         std::vector<VkVertexInputAttributeDescription> vertexInputAttributes(createInfo.vertexInputs.size());
         for (uint32 i = 0; i < createInfo.vertexInputs.size(); i++)
         {
-            vertexInputAttributes[i].binding = 0;
+            const uint32 streamIndex = createInfo.vertexInputStreams.size() != 0 ? *(createInfo.vertexInputStreams.begin() + i) : 0;
+            uint32 &vertexDataSize = vertexStreamStrides[streamIndex];
+
+            vertexInputAttributes[i].binding = streamIndex;
             vertexInputAttributes[i].location = i;
             vertexInputAttributes[i].offset = vertexDataSize;
             switch (*(createInfo.vertexInputs.begin() + i))
@@ -58,7 +68,7 @@ namespace Sierra
                 case VertexInput::UInt16:        { vertexInputAttributes[i].format = VK_FORMAT_R16_UINT;   vertexDataSize += 1 * 2; break; }
                 case VertexInput::Norm16:        { vertexInputAttributes[i].format = VK_FORMAT_R16_SNORM;  vertexDataSize += 1 * 2; break; }
                 case VertexInput::UNorm16:       { vertexInputAttributes[i].format = VK_FORMAT_R16_UNORM;  vertexDataSize += 1 * 2; break; }
-                case VertexInput::Float16:       { vertexInputAttributes[i].format = VK_FORMAT_R16_SFLOAT; vertexDataSize += 1 * 4; break; }
+                case VertexInput::Float16:       { vertexInputAttributes[i].format = VK_FORMAT_R16_SFLOAT; vertexDataSize += 1 * 2; break; }
                 case VertexInput::Int32:         { vertexInputAttributes[i].format = VK_FORMAT_R32_SINT;   vertexDataSize += 1 * 4; break; }
                 case VertexInput::UInt32:        { vertexInputAttributes[i].format = VK_FORMAT_R32_UINT;   vertexDataSize += 1 * 4; break; }
                 case VertexInput::Float32:       { vertexInputAttributes[i].format = VK_FORMAT_R32_SFLOAT; vertexDataSize += 1 * 4; break; }
@@ -104,17 +114,24 @@ namespace Sierra
             }
         }
 
-        // Set up vertex input binding
-        VkVertexInputBindingDescription vertexInputBinding = { };
-        vertexInputBinding.binding = 0;
-        vertexInputBinding.stride = vertexDataSize;
-        vertexInputBinding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        // Set up a vertex input binding for every used stream
+        std::vector<VkVertexInputBindingDescription> vertexInputBindings;
+        vertexInputBindings.reserve(MAX_VERTEX_STREAM_COUNT);
+        for (uint32 i = 0; i < MAX_VERTEX_STREAM_COUNT; i++)
+        {
+            if (vertexStreamStrides[i] == 0) continue;
+
+            VkVertexInputBindingDescription &vertexInputBinding = vertexInputBindings.emplace_back();
+            vertexInputBinding.binding = i;
+            vertexInputBinding.stride = vertexStreamStrides[i];
+            vertexInputBinding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        }
 
         // Set up how vertex data is sent
         VkPipelineVertexInputStateCreateInfo vertexInputStateCreateInfo = { };
         vertexInputStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-        vertexInputStateCreateInfo.vertexBindingDescriptionCount = createInfo.vertexInputs.size() > 0;
-        vertexInputStateCreateInfo.pVertexBindingDescriptions = &vertexInputBinding;
+        vertexInputStateCreateInfo.vertexBindingDescriptionCount = static_cast<uint32>(vertexInputBindings.size());
+        vertexInputStateCreateInfo.pVertexBindingDescriptions = vertexInputBindings.data();
         vertexInputStateCreateInfo.vertexAttributeDescriptionCount = static_cast<uint32>(vertexInputAttributes.size());
         vertexInputStateCreateInfo.pVertexAttributeDescriptions = vertexInputAttributes.data();
 
@@ -138,9 +155,9 @@ namespace Sierra
         rasterizationStateCreateInfo.depthClampEnable = VK_FALSE;
         rasterizationStateCreateInfo.rasterizerDiscardEnable = VK_FALSE;
         rasterizationStateCreateInfo.lineWidth = 1.0f;
-        rasterizationStateCreateInfo.cullMode = CullModeToVkCullMode(createInfo.cullMode);
+        rasterizationStateCreateInfo.cullMode = cullMode;
         rasterizationStateCreateInfo.polygonMode = ShadeModeToVkPolygonMode(createInfo.shadeMode);
-        rasterizationStateCreateInfo.frontFace = FrontFaceModeToVkFrontFace(createInfo.frontFaceMode);
+        rasterizationStateCreateInfo.frontFace = frontFace;
         rasterizationStateCreateInfo.depthBiasEnable = false;
 
         // Set up multisampling state
@@ -157,7 +174,7 @@ namespace Sierra
         VkPipelineDepthStencilStateCreateInfo depthStencilStateCreateInfo = { };
         depthStencilStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
         depthStencilStateCreateInfo.depthTestEnable = vulkanRenderPass.HasDepthAttachment();
-        depthStencilStateCreateInfo.depthWriteEnable = createInfo.depthMode == DepthMode::WriteDepth;
+        depthStencilStateCreateInfo.depthWriteEnable = depthWriteEnable;
         depthStencilStateCreateInfo.depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL;
         depthStencilStateCreateInfo.depthBoundsTestEnable = VK_FALSE;
         depthStencilStateCreateInfo.minDepthBounds = 0.0f;
@@ -184,12 +201,12 @@ namespace Sierra
         blendingStateCreateInfo.attachmentCount = static_cast<uint32>(colorAttachmentStates.size());
         blendingStateCreateInfo.pAttachments = colorAttachmentStates.data();
 
-        // Define dynamic states to use
-        constexpr std::array<VkDynamicState, 2> dynamicStates
+        // Define dynamic states to use (with extended dynamic state, static values above are ignored, and are instead set whenever the pipeline is begun, so materials, which only differ in them, can share a pipeline)
+        std::vector<VkDynamicState> dynamicStates = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+        if (hasExtendedDynamicState)
         {
-            VK_DYNAMIC_STATE_VIEWPORT,
-            VK_DYNAMIC_STATE_SCISSOR
-        };
+            dynamicStates.insert(dynamicStates.end(), { VK_DYNAMIC_STATE_CULL_MODE_EXT, VK_DYNAMIC_STATE_FRONT_FACE_EXT, VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT });
+        }
 
         // Set up dynamic states
         VkPipelineDynamicStateCreateInfo dynamicStateCreateInfo = { };
@@ -216,19 +233,125 @@ namespace Sierra
         graphicsPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
         graphicsPipelineCreateInfo.basePipelineIndex = -1;
 
-        // Create pipeline
-        const VkResult result = device.GetFunctionTable().vkCreateGraphicsPipelines(device.GetLogicalDevice(), VK_NULL_HANDLE, 1, &graphicsPipelineCreateInfo, nullptr, &pipeline);
-        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create graphics pipeline [{0}]! Error code: {1}.", GetName(), result);
+        // Without pipeline libraries, compile the whole pipeline at once
+        const VulkanPipelineLibraryCache* pipelineLibraryCache = device.GetPipelineLibraryCache();
+        if (pipelineLibraryCache == nullptr)
+        {
+            // Create pipeline
+            const VkResult result = device.GetFunctionTable().vkCreateGraphicsPipelines(device.GetLogicalDevice(), VK_NULL_HANDLE, 1, &graphicsPipelineCreateInfo, nullptr, &pipeline);
+            SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create graphics pipeline [{0}]! Error code: {1}.", GetName(), result);
+
+            // Set object name
+            device.SetObjectName(pipeline, VK_OBJECT_TYPE_PIPELINE, GetName());
+            return;
+        }
+
+        // Describe state, which is shared between shader libraries (layouts and render passes are shared by their caches, so their handles identify them, and shaders are identified by their code, so identical ones loaded twice still share libraries)
+        std::vector<uint64> shaderState = { reinterpret_cast<uint64>(layout.GetVulkanPipelineLayout()), reinterpret_cast<uint64>(vulkanRenderPass.GetVulkanRenderPass()), createInfo.subpassIndex, createInfo.shaderConstants.size() };
+        for (const ShaderConstant &shaderConstant : createInfo.shaderConstants)
+        {
+            shaderState.insert(shaderState.end(), { shaderConstant.constantID, static_cast<uint64>(shaderConstant.type), shaderConstant.value.uint32Value });
+        }
 
-        // Set object name
+        // Set up vertex input library
+        VulkanPipelineLibraryDescription vertexInputDescription = { };
+        vertexInputDescription.state.push_back(createInfo.vertexInputs.size());
+        for (const VertexInput vertexInput : createInfo.vertexInputs) vertexInputDescription.state.push_back(static_cast<uint64>(vertexInput));
+        vertexInputDescription.state.push_back(createInfo.vertexInputStreams.size());
+        for (const uint32 vertexInputStream : createInfo.vertexInputStreams) vertexInputDescription.state.push_back(vertexInputStream);
+        vertexInputDescription.state.push_back(hasExtendedDynamicState);
+
+        VkGraphicsPipelineCreateInfo vertexInputLibraryCreateInfo = { };
+        vertexInputLibraryCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        vertexInputLibraryCreateInfo.pVertexInputState = &vertexInputStateCreateInfo;
+        vertexInputLibraryCreateInfo.pInputAssemblyState = &inputAssemblyStateCreateInfo;
+        vertexInputLibraryCreateInfo.pDynamicState = &dynamicStateCreateInfo;
+
+        // Set up pre-rasterization library
+        VulkanPipelineLibraryDescription preRasterizationDescription = { .state = shaderState, .shaderCode = vulkanVertexShader.GetCode(), .layout = layout.GetHandles(), .renderPass = vulkanRenderPass.GetRenderPassHandle() };
+        preRasterizationDescription.state.insert(preRasterizationDescription.state.end(), { vulkanVertexShader.GetCodeHash(), static_cast<uint64>(createInfo.shadeMode), hasExtendedDynamicState });
+        if (!hasExtendedDynamicState)
+        {
+            preRasterizationDescription.state.insert(preRasterizationDescription.state.end(), { static_cast<uint64>(createInfo.cullMode), static_cast<uint64>(createInfo.frontFaceMode) });
+        }
+
+        VkGraphicsPipelineCreateInfo preRasterizationLibraryCreateInfo = { };
+        preRasterizationLibraryCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        preRasterizationLibraryCreateInfo.stageCount = 1;
+        preRasterizationLibraryCreateInfo.pStages = &shaderStages[0];
+        preRasterizationLibraryCreateInfo.pViewportState = &viewportStateCreateInfo;
+        preRasterizationLibraryCreateInfo.pRasterizationState = &rasterizationStateCreateInfo;
+        preRasterizationLibraryCreateInfo.pDynamicState = &dynamicStateCreateInfo;
+        preRasterizationLibraryCreateInfo.layout = layout.GetVulkanPipelineLayout();
+        preRasterizationLibraryCreateInfo.renderPass = vulkanRenderPass.GetVulkanRenderPass();
+        preRasterizationLibraryCreateInfo.subpass = createInfo.subpassIndex;
+
+        // Set up fragment shader library
+        VulkanPipelineLibraryDescription fragmentShaderDescription = { .state = shaderState, .shaderCode = createInfo.fragmentShader.has_value() ? static_cast<VulkanShader&>(*createInfo.fragmentShader->get()).GetCode() : nullptr, .layout = layout.GetHandles(), .renderPass = vulkanRenderPass.GetRenderPassHandle() };
+        fragmentShaderDescription.state.insert(fragmentShaderDescription.state.end(), { createInfo.fragmentShader.has_value() ? static_cast<VulkanShader&>(*createInfo.fragmentShader->get()).GetCodeHash() : 0, static_cast<uint64>(createInfo.sampling), hasExtendedDynamicState });
+        if (!hasExtendedDynamicState) fragmentShaderDescription.state.push_back(static_cast<uint64>(createInfo.depthMode));
+
+        VkGraphicsPipelineCreateInfo fragmentShaderLibraryCreateInfo = { };
+        fragmentShaderLibraryCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        fragmentShaderLibraryCreateInfo.stageCount = static_cast<uint32>(shaderStages.size()) - 1;
+        fragmentShaderLibraryCreateInfo.pStages = createInfo.fragmentShader.has_value() ? &shaderStages[1] : nullptr;
+        fragmentShaderLibraryCreateInfo.pMultisampleState = &multisampleStateCreateInfo;
+        fragmentShaderLibraryCreateInfo.pDepthStencilState = graphicsPipelineCreateInfo.pDepthStencilState;
+        fragmentShaderLibraryCreateInfo.pDynamicState = &dynamicStateCreateInfo;
+        fragmentShaderLibraryCreateInfo.layout = layout.GetVulkanPipelineLayout();
+        fragmentShaderLibraryCreateInfo.renderPass = vulkanRenderPass.GetVulkanRenderPass();
+        fragmentShaderLibraryCreateInfo.subpass = createInfo.subpassIndex;
+
+        // Set up fragment output library
+        VulkanPipelineLibraryDescription fragmentOutputDescription = { .renderPass = vulkanRenderPass.GetRenderPassHandle() };
+        fragmentOutputDescription.state = { reinterpret_cast<uint64>(vulkanRenderPass.GetVulkanRenderPass()), createInfo.subpassIndex, static_cast<uint64>(createInfo.blendMode), static_cast<uint64>(createInfo.sampling), hasExtendedDynamicState };
+
+        VkGraphicsPipelineCreateInfo fragmentOutputLibraryCreateInfo = { };
+        fragmentOutputLibraryCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        fragmentOutputLibraryCreateInfo.pMultisampleState = &multisampleStateCreateInfo;
+        fragmentOutputLibraryCreateInfo.pColorBlendState = &blendingStateCreateInfo;
+        fragmentOutputLibraryCreateInfo.pDynamicState = &dynamicStateCreateInfo;
+        fragmentOutputLibraryCreateInfo.renderPass = vulkanRenderPass.GetVulkanRenderPass();
+        fragmentOutputLibraryCreateInfo.subpass = createInfo.subpassIndex;
+
+        // Retrieve libraries (only ones, which no other pipeline has yet created, get compiled)
+        pipelineLibraries[0] = pipelineLibraryCache->GetLibrary(vertexInputDescription, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, vertexInputLibraryCreateInfo, "Vertex input library of graphics pipeline [" + GetName() + "]");
+        pipelineLibraries[1] = pipelineLibraryCache->GetLibrary(preRasterizationDescription, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, preRasterizationLibraryCreateInfo, "Pre-rasterization library of graphics pipeline [" + GetName() + "]");
+        pipelineLibraries[2] = pipelineLibraryCache->GetLibrary(fragmentShaderDescription, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, fragmentShaderLibraryCreateInfo, "Fragment shader library of graphics pipeline [" + GetName() + "]");
+        pipelineLibraries[3] = pipelineLibraryCache->GetLibrary(fragmentOutputDescription, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, fragmentOutputLibraryCreateInfo, "Fragment output library of graphics pipeline [" + GetName() + "]");
+        const std::array<VkPipeline, 4> libraryPipelines = { *pipelineLibraries[0], *pipelineLibraries[1], *pipelineLibraries[2], *pipelineLibraries[3] };
+
+        // Set up library linking info
+        VkPipelineLibraryCreateInfoKHR libraryCreateInfo = { };
+        libraryCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+        libraryCreateInfo.libraryCount = static_cast<uint32>(libraryPipelines.size());
+        libraryCreateInfo.pLibraries = libraryPipelines.data();
+
+        VkGraphicsPipelineCreateInfo linkedPipelineCreateInfo = { };
+        linkedPipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        linkedPipelineCreateInfo.pNext = &libraryCreateInfo;
+        linkedPipelineCreateInfo.layout = layout.GetVulkanPipelineLayout();
+
+        // Fast-link pipeline, so it can be used right away
+        const VkResult result = device.GetFunctionTable().vkCreateGraphicsPipelines(device.GetLogicalDevice(), VK_NULL_HANDLE, 1, &linkedPipelineCreateInfo, nullptr, &pipeline);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not link graphics pipeline [{0}]! Error code: {1}.", GetName(), result);
         device.SetObjectName(pipeline, VK_OBJECT_TYPE_PIPELINE, GetName());
+
+        // Re-link an optimized pipeline on the device's shared link thread, and swap it in once ready
+        optimizedLink = pipelineLibraryCache->LinkOptimizedPipeline(pipelineLibraries, layout.GetHandles(), GetName());
     }
 
     /* --- DESTRUCTOR --- */
 
     VulkanGraphicsPipeline::~VulkanGraphicsPipeline()
     {
+        // Command buffers may have bound either pipeline, so both are kept until destruction (an unfinished link is not waited on, but left for the link thread to dispose of)
         device.GetFunctionTable().vkDestroyPipeline(device.GetLogicalDevice(), pipeline, nullptr);
+        if (optimizedLink != nullptr)
+        {
+            const VkPipeline optimizedPipeline = device.GetPipelineLibraryCache()->CancelOptimizedLink(*optimizedLink);
+            if (optimizedPipeline != VK_NULL_HANDLE) device.GetFunctionTable().vkDestroyPipeline(device.GetLogicalDevice(), optimizedPipeline, nullptr);
+        }
     }
 
     /* --- CONVERSIONS --- */
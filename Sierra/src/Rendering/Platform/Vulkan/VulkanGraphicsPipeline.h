@@ -9,6 +9,7 @@
 
 #include "VulkanDevice.h"
 #include "VulkanPipelineLayout.h"
+#include "VulkanPipelineLibraryCache.h"
 
 namespace Sierra
 {
@@ -20,9 +21,15 @@ namespace Sierra
         VulkanGraphicsPipeline(const VulkanDevice &device, const GraphicsPipelineCreateInfo &createInfo);
 
         /* --- GETTER METHODS --- */
-        [[nodiscard]] inline VkPipeline GetVulkanPipeline() const { return pipeline; }
+        // Returns the optimized pipeline once its background link has finished, and the fast-linked (or monolithic) one until then
+        [[nodiscard]] inline VkPipeline GetVulkanPipeline() const { const VkPipeline linkedPipeline = optimizedLink != nullptr ? optimizedLink->pipeline.load(std::memory_order_acquire) : VK_NULL_HANDLE; return linkedPipeline != VK_NULL_HANDLE ? linkedPipeline : pipeline; }
         [[nodiscard]] inline const VulkanPipelineLayout& GetLayout() const { return layout; }
 
+        [[nodiscard]] inline bool HasExtendedDynamicState() const { return hasExtendedDynamicState; }
+        [[nodiscard]] inline VkCullModeFlags GetCullMode() const { return cullMode; }
+        [[nodiscard]] inline VkFrontFace GetFrontFace() const { return frontFace; }
+        [[nodiscard]] inline bool GetDepthWriteEnable() const { return depthWriteEnable; }
+
         /* --- DESTRUCTOR --- */
         ~VulkanGraphicsPipeline() override;
 
@@ -37,6 +44,14 @@ namespace Sierra
 
         VkPipeline pipeline = VK_NULL_HANDLE;
 
+        std::array<std::shared_ptr<const VkPipeline>, 4> pipelineLibraries = { }; // Kept, so variants, which share parts with this pipeline, can reuse its libraries
+        std::shared_ptr<VulkanOptimizedPipelineLink> optimizedLink = nullptr;
+
+        bool hasExtendedDynamicState = false;
+        VkCullModeFlags cullMode = VK_CULL_MODE_NONE;
+        VkFrontFace frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        bool depthWriteEnable = false;
+
     };
 
 }
@@ -16,7 +16,6 @@ namespace Sierra
         SR_ERROR_IF(!device.IsImageFormatSupported(createInfo.format, createInfo.usage), "[Vulkan]: Cannot create image [{0}] with unsupported format! Use Device::IsImageFormatSupported() to query format support.", GetName());
 
         // Set up image create info
-        VkImageCreateInfo imageCreateInfo = { };
         imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
         imageCreateInfo.flags = static_cast<uint32>(createInfo.type == ImageType::Cube) * VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
         imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
@@ -32,30 +31,64 @@ namespace Sierra
         imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
         imageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
+        // Non-attachment images may get moved around by the defragmenter, which copies their memory over
+        constexpr VkImageUsageFlags ATTACHMENT_USAGE_FLAGS = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+        if (!(usageFlags & ATTACHMENT_USAGE_FLAGS) && imageCreateInfo.tiling == VK_IMAGE_TILING_OPTIMAL) imageCreateInfo.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+
         // Set up image allocation info
+        allocationOwner.image = this;
         VmaAllocationCreateInfo allocationCreateInfo = { };
         allocationCreateInfo.usage = ImageMemoryLocationToVmaMemoryUsage(createInfo.memoryLocation);
         allocationCreateInfo.memoryTypeBits = std::numeric_limits<uint32>::max();
         allocationCreateInfo.priority = 0.5f;
+        allocationCreateInfo.pUserData = &allocationOwner;
+
+        // Transient attachments are backed by lazily allocated memory where available, so that tiled hardware need not commit any (dedicated, as memory is committed per allocation)
+        if (createInfo.usage & ImageUsage::TransientAttachment)
+        {
+            VmaAllocationCreateInfo lazyAllocationCreateInfo = allocationCreateInfo;
+            lazyAllocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED;
+            lazyAllocationCreateInfo.flags |= VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
+
+            uint32 memoryTypeIndex = 0;
+            if (vmaFindMemoryTypeIndexForImageInfo(device.GetMemoryAllocator(), &imageCreateInfo, &lazyAllocationCreateInfo, &memoryTypeIndex) == VK_SUCCESS) allocationCreateInfo = lazyAllocationCreateInfo;
+        }
 
         // Create and allocate image
-        VkResult result = vmaCreateImage(device.GetMemoryAllocator(), &imageCreateInfo, &allocationCreateInfo, &image, &allocation, nullptr);
+        VmaAllocationInfo allocationInfo = { };
+        const VkResult result = vmaCreateImage(device.GetMemoryAllocator(), &imageCreateInfo, &allocationCreateInfo, &image, &allocation, &allocationInfo);
         SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create image [{0}]! Error code: {1}.", GetName(), result);
 
+        // Account for allocated memory
+        memoryCategory = createInfo.memoryCategory;
+        allocatedMemorySize = allocationInfo.size;
+        device.TrackMemoryAllocation(memoryCategory, allocatedMemorySize);
+
         // Determine aspect flags
         if (createInfo.usage & ImageUsage::DepthAttachment) aspectFlags = VK_IMAGE_ASPECT_DEPTH_BIT;
         else aspectFlags = VK_IMAGE_ASPECT_COLOR_BIT;
 
         // Determine view type
-        VkImageViewType imageViewType = VK_IMAGE_VIEW_TYPE_2D;
         if (createInfo.type == ImageType::Cube) imageViewType = VK_IMAGE_VIEW_TYPE_CUBE;
+        else if (createInfo.layerCount > 1) imageViewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+
+        // Set object name and create views
+        device.SetObjectName(image, VK_OBJECT_TYPE_IMAGE, GetName());
+        CreateImageViews();
+    }
+
+    VulkanImage::VulkanImage(const VulkanDevice &device, const SwapchainImageCreateInfo &createInfo)
+        : Image({ .name = createInfo.name, .width = createInfo.width, .height = createInfo.height, .format = SwapchainVkFormatToImageFormat(createInfo.format), .usage = ImageUsage::SourceMemory | ImageUsage::ColorAttachment, .memoryLocation = ImageMemoryLocation::Device }), VulkanResource(createInfo.name),
+          device(device), image(createInfo.image), usageFlags(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT), aspectFlags(VK_IMAGE_ASPECT_COLOR_BIT), swapchainImage(true)
+    {
+        SR_ERROR_IF(createInfo.image == VK_NULL_HANDLE, "[Vulkan]: Null texture pointer passed upon swapchain image [{0}] creation!", GetName());
 
         // Set up image view create info
         VkImageViewCreateInfo imageViewCreateInfo = { };
         imageViewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         imageViewCreateInfo.image = image;
-        imageViewCreateInfo.viewType = imageViewType;
-        imageViewCreateInfo.format = imageCreateInfo.format;
+        imageViewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        imageViewCreateInfo.format = createInfo.format;
         imageViewCreateInfo.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
         imageViewCreateInfo.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
         imageViewCreateInfo.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
@@ -64,10 +97,10 @@ namespace Sierra
         imageViewCreateInfo.subresourceRange.baseMipLevel = 0;
         imageViewCreateInfo.subresourceRange.levelCount = 1;
         imageViewCreateInfo.subresourceRange.baseArrayLayer = 0;
-        imageViewCreateInfo.subresourceRange.layerCount = createInfo.layerCount;
+        imageViewCreateInfo.subresourceRange.layerCount = 1;
 
         // Create the image view
-        result = device.GetFunctionTable().vkCreateImageView(device.GetLogicalDevice(), &imageViewCreateInfo, nullptr, &imageView);
+        const VkResult result = device.GetFunctionTable().vkCreateImageView(device.GetLogicalDevice(), &imageViewCreateInfo, nullptr, &imageView);
         SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Failed to create image view for image [{0}]! Error code: {1}.", GetName(), result);
 
         // Set object names
@@ -75,47 +108,120 @@ namespace Sierra
         device.SetObjectName(imageView, VK_OBJECT_TYPE_IMAGE_VIEW, "Image view of image [" + GetName() + "]");
     }
 
-    VulkanImage::VulkanImage(const VulkanDevice &device, const SwapchainImageCreateInfo &createInfo)
-        : Image({ .name = createInfo.name, .width = createInfo.width, .height = createInfo.height, .format = SwapchainVkFormatToImageFormat(createInfo.format), .usage = ImageUsage::SourceMemory | ImageUsage::ColorAttachment, .memoryLocation = ImageMemoryLocation::Device }), VulkanResource(createInfo.name),
-          device(device), image(createInfo.image), usageFlags(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT), aspectFlags(VK_IMAGE_ASPECT_COLOR_BIT), swapchainImage(true)
+    /* --- GETTER METHODS --- */
+
+    VkImageView VulkanImage::GetVulkanImageView(const ImageSubresourceRange &subresourceRange, VkImageViewType viewType) const
     {
-        SR_ERROR_IF(createInfo.image == VK_NULL_HANDLE, "[Vulkan]: Null texture pointer passed upon swapchain image [{0}] creation!", GetName());
+        const uint32 mipLevelCount = subresourceRange.mipLevelCount != 0 ? subresourceRange.mipLevelCount : GetMipLevelCount() - std::min(subresourceRange.baseMipLevel, GetMipLevelCount());
+        const uint32 layerCount = subresourceRange.layerCount != 0 ? subresourceRange.layerCount : GetLayerCount() - std::min(subresourceRange.baseLayer, GetLayerCount());
+        SR_ERROR_IF(subresourceRange.baseMipLevel + mipLevelCount > GetMipLevelCount() || mipLevelCount == 0, "[Vulkan]: Cannot create view of mip levels [{0}-{1}] of image [{2}], as they exceed its mip level count - [{3}]!", subresourceRange.baseMipLevel, subresourceRange.baseMipLevel + mipLevelCount - 1, GetName(), GetMipLevelCount());
+        SR_ERROR_IF(subresourceRange.baseLayer + layerCount > GetLayerCount() || layerCount == 0, "[Vulkan]: Cannot create view of layers [{0}-{1}] of image [{2}], as they exceed its layer count - [{3}]!", subresourceRange.baseLayer, subresourceRange.baseLayer + layerCount - 1, GetName(), GetLayerCount());
+
+        // Derive view type (whole cubes are viewed as such, and single layers - as plain 2D images)
+        if (viewType == VK_IMAGE_VIEW_TYPE_MAX_ENUM)
+        {
+            if (imageViewType == VK_IMAGE_VIEW_TYPE_CUBE && layerCount == 6) viewType = VK_IMAGE_VIEW_TYPE_CUBE;
+            else viewType = layerCount == 1 ? VK_IMAGE_VIEW_TYPE_2D : VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+        }
+
+        // Whole image is already covered by the default view
+        if (subresourceRange.baseMipLevel == 0 && mipLevelCount == GetMipLevelCount() && subresourceRange.baseLayer == 0 && layerCount == GetLayerCount() && viewType == imageViewType) return imageView;
+
+        const std::array<uint64, 6> description = { subresourceRange.baseMipLevel, mipLevelCount, subresourceRange.baseLayer, layerCount, aspectFlags, static_cast<uint64>(viewType) };
+        Hash key = 0;
+        for (const uint64 value : description) HashCombine(key, value);
+
+        // Views may be requested by command buffers recorded on different threads
+        std::lock_guard lock(subresourceImageViewMutex);
+        for (auto [iterator, end] = subresourceImageViews.equal_range(key); iterator != end; iterator++)
+        {
+            if (iterator->second.description == description) return iterator->second.imageView;
+        }
 
         // Set up image view create info
         VkImageViewCreateInfo imageViewCreateInfo = { };
         imageViewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         imageViewCreateInfo.image = image;
-        imageViewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        imageViewCreateInfo.format = createInfo.format;
+        imageViewCreateInfo.viewType = viewType;
+        imageViewCreateInfo.format = imageCreateInfo.format;
         imageViewCreateInfo.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
         imageViewCreateInfo.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
         imageViewCreateInfo.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
         imageViewCreateInfo.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
         imageViewCreateInfo.subresourceRange.aspectMask = aspectFlags;
-        imageViewCreateInfo.subresourceRange.baseMipLevel = 0;
-        imageViewCreateInfo.subresourceRange.levelCount = 1;
-        imageViewCreateInfo.subresourceRange.baseArrayLayer = 0;
-        imageViewCreateInfo.subresourceRange.layerCount = 1;
+        imageViewCreateInfo.subresourceRange.baseMipLevel = subresourceRange.baseMipLevel;
+        imageViewCreateInfo.subresourceRange.levelCount = mipLevelCount;
+        imageViewCreateInfo.subresourceRange.baseArrayLayer = subresourceRange.baseLayer;
+        imageViewCreateInfo.subresourceRange.layerCount = layerCount;
 
         // Create the image view
-        const VkResult result = device.GetFunctionTable().vkCreateImageView(device.GetLogicalDevice(), &imageViewCreateInfo, nullptr, &imageView);
-        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Failed to create image view for image [{0}]! Error code: {1}.", GetName(), result);
+        VkImageView subresourceImageView = VK_NULL_HANDLE;
+        const VkResult result = device.GetFunctionTable().vkCreateImageView(device.GetLogicalDevice(), &imageViewCreateInfo, nullptr, &subresourceImageView);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Failed to create image view for mip levels [{0}-{1}] and layers [{2}-{3}] of image [{4}]! Error code: {5}.", subresourceRange.baseMipLevel, subresourceRange.baseMipLevel + mipLevelCount - 1, subresourceRange.baseLayer, subresourceRange.baseLayer + layerCount - 1, GetName(), result);
+        device.SetObjectName(subresourceImageView, VK_OBJECT_TYPE_IMAGE_VIEW, "Image view of mip levels [" + std::to_string(subresourceRange.baseMipLevel) + "-" + std::to_string(subresourceRange.baseMipLevel + mipLevelCount - 1) + "] and layers [" + std::to_string(subresourceRange.baseLayer) + "-" + std::to_string(subresourceRange.baseLayer + layerCount - 1) + "] of image [" + GetName() + "]");
 
-        // Set object names
-        device.SetObjectName(image, VK_OBJECT_TYPE_IMAGE, GetName());
-        device.SetObjectName(imageView, VK_OBJECT_TYPE_IMAGE_VIEW, "Image view of image [" + GetName() + "]");
+        subresourceImageViews.emplace(key, SubresourceImageView { .description = description, .imageView = subresourceImageView });
+        return subresourceImageView;
     }
 
     /* --- DESTRUCTOR --- */
 
     VulkanImage::~VulkanImage()
     {
-        device.GetFunctionTable().vkDestroyImageView(device.GetLogicalDevice(), imageView, nullptr);
-        if (!swapchainImage) vmaDestroyImage(device.GetMemoryAllocator(), image, allocation);
+        DestroyImageViews();
+        if (!swapchainImage)
+        {
+            // Memory, which is being moved, is freed by the defragmenter once it finishes the move
+            if (allocationOwner.pendingMove != nullptr)
+            {
+                allocationOwner.pendingMove->operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_DESTROY;
+                device.GetFunctionTable().vkDestroyImage(device.GetLogicalDevice(), image, nullptr);
+            }
+            else
+            {
+                vmaDestroyImage(device.GetMemoryAllocator(), image, allocation);
+            }
+            device.UntrackMemoryAllocation(memoryCategory, allocatedMemorySize);
+        }
     }
 
     /* --- PRIVATE METHODS --- */
 
+    void VulkanImage::CreateImageViews()
+    {
+        // Set up image view create info (default view spans every mip level and layer)
+        VkImageViewCreateInfo imageViewCreateInfo = { };
+        imageViewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        imageViewCreateInfo.image = image;
+        imageViewCreateInfo.viewType = imageViewType;
+        imageViewCreateInfo.format = imageCreateInfo.format;
+        imageViewCreateInfo.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
+        imageViewCreateInfo.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
+        imageViewCreateInfo.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
+        imageViewCreateInfo.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
+        imageViewCreateInfo.subresourceRange.aspectMask = aspectFlags;
+        imageViewCreateInfo.subresourceRange.baseMipLevel = 0;
+        imageViewCreateInfo.subresourceRange.levelCount = imageCreateInfo.mipLevels;
+        imageViewCreateInfo.subresourceRange.baseArrayLayer = 0;
+        imageViewCreateInfo.subresourceRange.layerCount = imageCreateInfo.arrayLayers;
+
+        // Create the image view
+        const VkResult result = device.GetFunctionTable().vkCreateImageView(device.GetLogicalDevice(), &imageViewCreateInfo, nullptr, &imageView);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Failed to create image view for image [{0}]! Error code: {1}.", GetName(), result);
+        device.SetObjectName(imageView, VK_OBJECT_TYPE_IMAGE_VIEW, "Image view of image [" + GetName() + "]");
+    }
+
+    void VulkanImage::DestroyImageViews()
+    {
+        device.GetFunctionTable().vkDestroyImageView(device.GetLogicalDevice(), imageView, nullptr);
+        imageView = VK_NULL_HANDLE;
+
+        // Subresource views are recreated on next use
+        std::lock_guard lock(subresourceImageViewMutex);
+        for (const auto &[key, subresourceImageView] : subresourceImageViews) device.GetFunctionTable().vkDestroyImageView(device.GetLogicalDevice(), subresourceImageView.imageView, nullptr);
+        subresourceImageViews.clear();
+    }
+
     ImageFormat VulkanImage::SwapchainVkFormatToImageFormat(VkFormat format)
     {
         switch (format)
@@ -137,6 +243,85 @@ namespace Sierra
 
     VkFormat VulkanImage::ImageFormatToVkFormat(const ImageFormat format)
     {
+        const bool sRGB = format.memoryType == ImageMemoryType::SRGB8;
+        switch (format.compression)
+        {
+            case ImageCompression::None:            break;
+            case ImageCompression::BC1:
+            {
+                if (format.channels == ImageChannels::RGB && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? VK_FORMAT_BC1_RGB_SRGB_BLOCK : VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? VK_FORMAT_BC1_RGBA_SRGB_BLOCK : VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+                break;
+            }
+            case ImageCompression::BC2:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? VK_FORMAT_BC2_SRGB_BLOCK : VK_FORMAT_BC2_UNORM_BLOCK;
+                break;
+            }
+            case ImageCompression::BC3:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+                break;
+            }
+            case ImageCompression::BC4:
+            {
+                if (format.channels == ImageChannels::R && format.memoryType == ImageMemoryType::UNorm8) return VK_FORMAT_BC4_UNORM_BLOCK;
+                if (format.channels == ImageChannels::R && format.memoryType == ImageMemoryType::Norm8) return VK_FORMAT_BC4_SNORM_BLOCK;
+                break;
+            }
+            case ImageCompression::BC5:
+            {
+                if (format.channels == ImageChannels::RG && format.memoryType == ImageMemoryType::UNorm8) return VK_FORMAT_BC5_UNORM_BLOCK;
+                if (format.channels == ImageChannels::RG && format.memoryType == ImageMemoryType::Norm8) return VK_FORMAT_BC5_SNORM_BLOCK;
+                break;
+            }
+            case ImageCompression::BC6H:
+            {
+                if (format.channels == ImageChannels::RGB && format.memoryType == ImageMemoryType::Float16) return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+                break;
+            }
+            case ImageCompression::BC7:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+                break;
+            }
+            case ImageCompression::ETC2:
+            {
+                if (format.channels == ImageChannels::RGB && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK : VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK : VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+                break;
+            }
+            case ImageCompression::EAC:
+            {
+                if (format.channels == ImageChannels::R && format.memoryType == ImageMemoryType::UNorm8) return VK_FORMAT_EAC_R11_UNORM_BLOCK;
+                if (format.channels == ImageChannels::R && format.memoryType == ImageMemoryType::Norm8) return VK_FORMAT_EAC_R11_SNORM_BLOCK;
+                if (format.channels == ImageChannels::RG && format.memoryType == ImageMemoryType::UNorm8) return VK_FORMAT_EAC_R11G11_UNORM_BLOCK;
+                if (format.channels == ImageChannels::RG && format.memoryType == ImageMemoryType::Norm8) return VK_FORMAT_EAC_R11G11_SNORM_BLOCK;
+                break;
+            }
+            case ImageCompression::ASTC4x4:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? VK_FORMAT_ASTC_4x4_SRGB_BLOCK : VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
+                break;
+            }
+            case ImageCompression::ASTC6x6:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? VK_FORMAT_ASTC_6x6_SRGB_BLOCK : VK_FORMAT_ASTC_6x6_UNORM_BLOCK;
+                break;
+            }
+            case ImageCompression::ASTC8x8:
+            {
+                if (format.channels == ImageChannels::RGBA && (format.memoryType == ImageMemoryType::UNorm8 || sRGB)) return sRGB ? VK_FORMAT_ASTC_8x8_SRGB_BLOCK : VK_FORMAT_ASTC_8x8_UNORM_BLOCK;
+                break;
+            }
+        }
+
+        if (format.compression != ImageCompression::None)
+        {
+            SR_ERROR("[Vulkan]: Cannot determine image format of invalid compression, channel and memory configuration!");
+            return VK_FORMAT_UNDEFINED;
+        }
+
         switch (format.channels)
         {
             case ImageChannels::R:
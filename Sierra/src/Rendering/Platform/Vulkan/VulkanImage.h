@@ -8,6 +8,7 @@
 #include "VulkanResource.h"
 
 #include "VulkanDevice.h"
+#include "VulkanDefragmenter.h"
 
 namespace Sierra
 {
@@ -21,8 +22,16 @@ namespace Sierra
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline VkImage GetVulkanImage() const { return image; }
         [[nodiscard]] inline VkImageView GetVulkanImageView() const { return imageView; }
+        // Returns a view of the given subresources, which is created on first use, and kept until the image is destroyed (view type is derived from the range, unless specified)
+        [[nodiscard]] VkImageView GetVulkanImageView(const ImageSubresourceRange &subresourceRange, VkImageViewType viewType = VK_IMAGE_VIEW_TYPE_MAX_ENUM) const;
         [[nodiscard]] inline VkImageAspectFlags GetVulkanAspectFlags() const { return aspectFlags; }
         [[nodiscard]] inline VkImageUsageFlags GetVulkanUsageFlags() const { return usageFlags; }
+        [[nodiscard]] inline VkImageLayout GetVulkanLayout() const { return layout; }
+        [[nodiscard]] inline bool IsSwapchainImage() const { return swapchainImage; }
+
+        /* --- SETTER METHODS --- */
+        // Records the layout the whole image is left in by the last submitted command buffer, or VK_IMAGE_LAYOUT_MAX_ENUM, if its subresources may now be in differing layouts
+        inline void SetVulkanLayout(const VkImageLayout newLayout) { layout = newLayout; }
 
         /* --- DESTRUCTOR --- */
         ~VulkanImage() override;
@@ -38,11 +47,31 @@ namespace Sierra
 
         VkImage image = VK_NULL_HANDLE;
         VkImageView imageView = VK_NULL_HANDLE;
+        struct SubresourceImageView
+        {
+            std::array<uint64, 6> description = { }; // Compared on lookup, as different ranges may share a hash
+            VkImageView imageView = VK_NULL_HANDLE;
+        };
+        mutable std::unordered_multimap<Hash, SubresourceImageView> subresourceImageViews;
+        mutable std::mutex subresourceImageViewMutex;
 
         VkImageUsageFlags usageFlags = 0;
         VkImageAspectFlags aspectFlags = 0;
+        VkImageViewType imageViewType = VK_IMAGE_VIEW_TYPE_2D;
+        VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        VkImageCreateInfo imageCreateInfo = { };
         VmaAllocation allocation = nullptr;
 
+        std::string memoryCategory;
+        uint64 allocatedMemorySize = 0;
+
+        void CreateImageViews();
+        void DestroyImageViews();
+
+        friend class VulkanDefragmenter;
+        VulkanAllocationOwner allocationOwner = { };
+
         friend class VulkanSwapchain;
         struct SwapchainImageCreateInfo
         {
@@ -11,6 +11,7 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     VulkanInstance::VulkanInstance(const VulkanInstanceCreateInfo &createInfo)
+        : headless(createInfo.headless)
     {
         // Set up application info
         VkApplicationInfo applicationInfo = { };
@@ -34,6 +35,8 @@ namespace Sierra
         extensionsToLoad.reserve(INSTANCE_EXTENSIONS_TO_QUERY.size());
         for (const auto &extension : INSTANCE_EXTENSIONS_TO_QUERY)
         {
+            // Headless instances never present, so surface extensions (which may require a display connection) are skipped
+            if (headless && extension.presentationOnly) continue;
             AddExtensionIfSupported(extension, extensionsToLoad, supportedExtensions);
         }
 
@@ -12,7 +12,7 @@ namespace Sierra
 
     struct VulkanInstanceCreateInfo
     {
-
+        bool headless = false;
     };
 
     class SIERRA_API VulkanAPIVersion final
@@ -43,6 +43,7 @@ namespace Sierra
         [[nodiscard]] inline auto& GetFunctionTable() const { return functionTable; }
         [[nodiscard]] bool IsExtensionLoaded(const std::string &extensionName) const;
         [[nodiscard]] VulkanAPIVersion GetAPIVersion() const;
+        [[nodiscard]] inline bool IsHeadless() const { return headless; }
 
         /* --- DESTRUCTOR --- */
         ~VulkanInstance();
@@ -52,6 +53,8 @@ namespace Sierra
         explicit VulkanInstance(const VulkanInstanceCreateInfo &createInfo);
 
         VkInstance instance = VK_NULL_HANDLE;
+        bool headless = false;
+
         struct
         {
             #if defined(VK_VERSION_1_0)
@@ -266,11 +269,15 @@ namespace Sierra
         {
             std::string name;
             bool requiredOnlyIfSupported = false;
+            bool presentationOnly = false;
         };
 
         const std::vector<InstanceExtension> INSTANCE_EXTENSIONS_TO_QUERY
         {
-            { .name = VK_KHR_SURFACE_EXTENSION_NAME },
+            {
+                .name = VK_KHR_SURFACE_EXTENSION_NAME,
+                .presentationOnly = true
+            },
             #if SR_ENABLE_LOGGING
             {
                 .name = VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
@@ -278,13 +285,25 @@ namespace Sierra
             },
             #endif
             #if SR_PLATFORM_WINDOWS
-                { .name = VK_KHR_WIN32_SURFACE_EXTENSION_NAME },
+                {
+                    .name = VK_KHR_WIN32_SURFACE_EXTENSION_NAME,
+                    .presentationOnly = true
+                },
             #elif SR_PLATFORM_LINUX
-                { .name = VK_KHR_XLIB_SURFACE_EXTENSION_NAME },
+                {
+                    .name = VK_KHR_XLIB_SURFACE_EXTENSION_NAME,
+                    .presentationOnly = true
+                },
             #elif SR_PLATFORM_ANDROID
-                { .name = VK_KHR_ANDROID_SURFACE_EXTENSION_NAME },
+                {
+                    .name = VK_KHR_ANDROID_SURFACE_EXTENSION_NAME,
+                    .presentationOnly = true
+                },
             #elif SR_PLATFORM_APPLE
-                { .name = VK_EXT_METAL_SURFACE_EXTENSION_NAME },
+                {
+                    .name = VK_EXT_METAL_SURFACE_EXTENSION_NAME,
+                    .presentationOnly = true
+                },
                 {
                     .name = VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME,
                     .requiredOnlyIfSupported = true
@@ -0,0 +1,235 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "VulkanMipMapGenerator.h"
+
+#include "../../../Utilities/File.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    VulkanMipMapGenerator::VulkanMipMapGenerator(const VulkanDevice &device)
+        : device(device)
+    {
+        const std::filesystem::path shaderFilePath = File::GetResourcesDirectoryPath() / "shaders/MipMapGenerator.comp.shader/shader.spv";
+        SR_ERROR_IF(!File::FileExists(shaderFilePath), "[Vulkan]: Could not load SPIR-V shader [{0}] of mip map generator! Verify its presence and try again.", shaderFilePath.string().c_str());
+        auto shaderData = File::ReadFile(shaderFilePath);
+
+        // Set up module create info
+        VkShaderModuleCreateInfo shaderModuleCreateInfo = { };
+        shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        shaderModuleCreateInfo.codeSize = shaderData.size() * sizeof(char);
+        shaderModuleCreateInfo.pCode = reinterpret_cast<uint32*>(shaderData.data());
+
+        // Create shader module
+        VkResult result = device.GetFunctionTable().vkCreateShaderModule(device.GetLogicalDevice(), &shaderModuleCreateInfo, nullptr, &shaderModule);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create shader module of mip map generator! Error code: {0}.", result);
+
+        // Set up bindings (source level, destination levels, and atomic counters)
+        const std::array<VkDescriptorSetLayoutBinding, 3> layoutBindings
+        {
+            VkDescriptorSetLayoutBinding { .binding = 0, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT },
+            VkDescriptorSetLayoutBinding { .binding = 1, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, .descriptorCount = MAX_GENERATED_MIP_LEVEL_COUNT, .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT },
+            VkDescriptorSetLayoutBinding { .binding = 2, .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = 1, .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT }
+        };
+
+        // Set up descriptor set layout create info
+        VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = { };
+        descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        descriptorSetLayoutCreateInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+        descriptorSetLayoutCreateInfo.bindingCount = static_cast<uint32>(layoutBindings.size());
+        descriptorSetLayoutCreateInfo.pBindings = layoutBindings.data();
+
+        // Create descriptor set layout
+        result = device.GetFunctionTable().vkCreateDescriptorSetLayout(device.GetLogicalDevice(), &descriptorSetLayoutCreateInfo, nullptr, &descriptorSetLayout);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create descriptor set layout of mip map generator! Error code: {0}.", result);
+
+        // Set up push constant range
+        VkPushConstantRange pushConstantRange = { };
+        pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushConstantRange.offset = 0;
+        pushConstantRange.size = sizeof(PushConstant);
+
+        // Set up pipeline layout create info
+        VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = { };
+        pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutCreateInfo.setLayoutCount = 1;
+        pipelineLayoutCreateInfo.pSetLayouts = &descriptorSetLayout;
+        pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
+        pipelineLayoutCreateInfo.pPushConstantRanges = &pushConstantRange;
+
+        // Create pipeline layout
+        result = device.GetFunctionTable().vkCreatePipelineLayout(device.GetLogicalDevice(), &pipelineLayoutCreateInfo, nullptr, &pipelineLayout);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create pipeline layout of mip map generator! Error code: {0}.", result);
+
+        // Set up only shader stage
+        VkPipelineShaderStageCreateInfo shaderStageCreateInfo = { };
+        shaderStageCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        shaderStageCreateInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        shaderStageCreateInfo.module = shaderModule;
+        shaderStageCreateInfo.pName = "main";
+
+        // Set up compute pipeline create info
+        VkComputePipelineCreateInfo pipelineCreateInfo = { };
+        pipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineCreateInfo.stage = shaderStageCreateInfo;
+        pipelineCreateInfo.layout = pipelineLayout;
+        pipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
+        pipelineCreateInfo.basePipelineIndex = -1;
+
+        // Create pipeline
+        result = device.GetFunctionTable().vkCreateComputePipelines(device.GetLogicalDevice(), VK_NULL_HANDLE, 1, &pipelineCreateInfo, nullptr, &pipeline);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create compute pipeline of mip map generator! Error code: {0}.", result);
+
+        // Set up counter buffer create info (one counter per layer, which the shader resets after use, so zeroing once suffices)
+        VkBufferCreateInfo bufferCreateInfo = { };
+        bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferCreateInfo.size = device.GetPhysicalDeviceProperties().limits.maxImageArrayLayers * sizeof(uint32);
+        bufferCreateInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        // Set up counter buffer allocation info
+        VmaAllocationCreateInfo allocationCreateInfo = { };
+        allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT;
+        allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+
+        // Create and allocate counter buffer
+        VmaAllocationInfo allocationInfo = { };
+        result = vmaCreateBuffer(device.GetMemoryAllocator(), &bufferCreateInfo, &allocationCreateInfo, &counterBuffer, &counterBufferAllocation, &allocationInfo);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create counter buffer of mip map generator! Error code: {0}.", result);
+
+        // Zero out counters
+        std::memset(allocationInfo.pMappedData, 0, bufferCreateInfo.size);
+        vmaFlushAllocation(device.GetMemoryAllocator(), counterBufferAllocation, 0, VK_WHOLE_SIZE);
+
+        // Set object names
+        device.SetObjectName(shaderModule, VK_OBJECT_TYPE_SHADER_MODULE, "Shader module of mip map generator");
+        device.SetObjectName(descriptorSetLayout, VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT, "Descriptor set layout of mip map generator");
+        device.SetObjectName(pipelineLayout, VK_OBJECT_TYPE_PIPELINE_LAYOUT, "Pipeline layout of mip map generator");
+        device.SetObjectName(pipeline, VK_OBJECT_TYPE_PIPELINE, "Compute pipeline of mip map generator");
+        device.SetObjectName(counterBuffer, VK_OBJECT_TYPE_BUFFER, "Counter buffer of mip map generator");
+    }
+
+    /* --- POLLING METHODS --- */
+
+    void VulkanMipMapGenerator::GenerateMipMaps(VkCommandBuffer commandBuffer, const VulkanImage &image) const
+    {
+        SR_ERROR_IF(!IsImageSupported(image), "[Vulkan]: Cannot generate mip maps for image [{0}] using mip map generator, as it is not supported!", image.GetName());
+        const uint32 generatedMipLevelCount = image.GetMipLevelCount() - 1;
+
+        // Set up base pipeline barrier
+        VkImageMemoryBarrier pipelineBarrier = { };
+        pipelineBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        pipelineBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        pipelineBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        pipelineBarrier.image = image.GetVulkanImage();
+        pipelineBarrier.subresourceRange.aspectMask = image.GetVulkanAspectFlags();
+        pipelineBarrier.subresourceRange.baseArrayLayer = 0;
+        pipelineBarrier.subresourceRange.layerCount = image.GetLayerCount();
+
+        // Transition all mip levels to a layout usable from shaders
+        pipelineBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        pipelineBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        pipelineBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        pipelineBarrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+        pipelineBarrier.subresourceRange.baseMipLevel = 0;
+        pipelineBarrier.subresourceRange.levelCount = image.GetMipLevelCount();
+
+        // Make sure counters, reset by a previous dispatch, are visible
+        VkBufferMemoryBarrier counterBufferBarrier = { };
+        counterBufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        counterBufferBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        counterBufferBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        counterBufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        counterBufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        counterBufferBarrier.buffer = counterBuffer;
+        counterBufferBarrier.offset = 0;
+        counterBufferBarrier.size = VK_WHOLE_SIZE;
+        device.GetFunctionTable().vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 1, &counterBufferBarrier, 1, &pipelineBarrier);
+
+        // Collect image infos (slots past the last mip level still need a valid view, so they alias it, but are never written to)
+        const VkDescriptorImageInfo sourceImageInfo = { .sampler = VK_NULL_HANDLE, .imageView = image.GetVulkanImageView({ .baseMipLevel = 0, .mipLevelCount = 1 }, VK_IMAGE_VIEW_TYPE_2D_ARRAY), .imageLayout = VK_IMAGE_LAYOUT_GENERAL };
+        std::array<VkDescriptorImageInfo, MAX_GENERATED_MIP_LEVEL_COUNT> destinationImageInfos = { };
+        for (uint32 i = 0; i < MAX_GENERATED_MIP_LEVEL_COUNT; i++)
+        {
+            destinationImageInfos[i] = { .sampler = VK_NULL_HANDLE, .imageView = image.GetVulkanImageView({ .baseMipLevel = std::min(i + 1, generatedMipLevelCount), .mipLevelCount = 1 }, VK_IMAGE_VIEW_TYPE_2D_ARRAY), .imageLayout = VK_IMAGE_LAYOUT_GENERAL };
+        }
+        const VkDescriptorBufferInfo counterBufferInfo = { .buffer = counterBuffer, .offset = 0, .range = VK_WHOLE_SIZE };
+
+        // Set up descriptor writes
+        std::array<VkWriteDescriptorSet, 3> descriptorWrites = { };
+        for (uint32 i = 0; i < descriptorWrites.size(); i++)
+        {
+            descriptorWrites[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrites[i].dstBinding = i;
+            descriptorWrites[i].dstArrayElement = 0;
+        }
+        descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        descriptorWrites[0].descriptorCount = 1;
+        descriptorWrites[0].pImageInfo = &sourceImageInfo;
+        descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        descriptorWrites[1].descriptorCount = MAX_GENERATED_MIP_LEVEL_COUNT;
+        descriptorWrites[1].pImageInfo = destinationImageInfos.data();
+        descriptorWrites[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        descriptorWrites[2].descriptorCount = 1;
+        descriptorWrites[2].pBufferInfo = &counterBufferInfo;
+
+        // Calculate dispatch size (every work group covers a square tile of the base level)
+        const uint32 xWorkGroupCount = (image.GetWidth() + WORK_GROUP_TILE_SIZE - 1) / WORK_GROUP_TILE_SIZE;
+        const uint32 yWorkGroupCount = (image.GetHeight() + WORK_GROUP_TILE_SIZE - 1) / WORK_GROUP_TILE_SIZE;
+        const PushConstant pushConstant = { .mipLevelCount = generatedMipLevelCount, .workGroupCount = xWorkGroupCount * yWorkGroupCount };
+
+        // Generate all mip levels at once
+        device.GetFunctionTable().vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        device.GetFunctionTable().vkCmdPushDescriptorSetKHR(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, static_cast<uint32>(descriptorWrites.size()), descriptorWrites.data());
+        device.GetFunctionTable().vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PushConstant), &pushConstant);
+        device.GetFunctionTable().vkCmdDispatch(commandBuffer, xWorkGroupCount, yWorkGroupCount, image.GetLayerCount());
+
+        // Transition all but the last mip level to the same layout blitting would have left them in
+        pipelineBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        pipelineBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        pipelineBarrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+        pipelineBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        pipelineBarrier.subresourceRange.baseMipLevel = 0;
+        pipelineBarrier.subresourceRange.levelCount = generatedMipLevelCount;
+        device.GetFunctionTable().vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &pipelineBarrier);
+
+        // Transition last mip level
+        pipelineBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        pipelineBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        pipelineBarrier.subresourceRange.baseMipLevel = generatedMipLevelCount;
+        pipelineBarrier.subresourceRange.levelCount = 1;
+        device.GetFunctionTable().vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &pipelineBarrier);
+    }
+
+    /* --- GETTER METHODS --- */
+
+    bool VulkanMipMapGenerator::IsImageSupported(const VulkanImage &image) const
+    {
+        if (!(image.GetVulkanUsageFlags() & VK_IMAGE_USAGE_STORAGE_BIT) || image.GetMipLevelCount() <= 1 || image.GetMipLevelCount() - 1 > MAX_GENERATED_MIP_LEVEL_COUNT) return false;
+
+        // Levels past the sixth are reduced from a single tile of it, so images, whose sixth level spans more than one tile, are left to blitting
+        if (image.GetMipLevelCount() - 1 > 6 && (std::max(image.GetWidth(), image.GetHeight()) >> 6) > WORK_GROUP_TILE_SIZE) return false;
+
+        // Images are accessed without a format qualifier, so format-less storage access is needed
+        const VkPhysicalDeviceFeatures physicalDeviceFeatures = device.GetPhysicalDeviceFeatures();
+        if (!physicalDeviceFeatures.shaderStorageImageReadWithoutFormat || !physicalDeviceFeatures.shaderStorageImageWriteWithoutFormat) return false;
+
+        return device.IsImageFormatSupported(image.GetFormat(), ImageUsage::Storage);
+    }
+
+    /* --- DESTRUCTOR --- */
+
+    VulkanMipMapGenerator::~VulkanMipMapGenerator()
+    {
+        vmaDestroyBuffer(device.GetMemoryAllocator(), counterBuffer, counterBufferAllocation);
+        device.GetFunctionTable().vkDestroyPipeline(device.GetLogicalDevice(), pipeline, nullptr);
+        device.GetFunctionTable().vkDestroyPipelineLayout(device.GetLogicalDevice(), pipelineLayout, nullptr);
+        device.GetFunctionTable().vkDestroyDescriptorSetLayout(device.GetLogicalDevice(), descriptorSetLayout, nullptr);
+        device.GetFunctionTable().vkDestroyShaderModule(device.GetLogicalDevice(), shaderModule, nullptr);
+    }
+
+}
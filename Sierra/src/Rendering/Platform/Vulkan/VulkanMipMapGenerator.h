@@ -0,0 +1,57 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "VulkanResource.h"
+
+#include "VulkanDevice.h"
+#include "VulkanImage.h"
+
+namespace Sierra
+{
+
+    class SIERRA_API VulkanMipMapGenerator final
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        explicit VulkanMipMapGenerator(const VulkanDevice &device);
+
+        /* --- POLLING METHODS --- */
+        void GenerateMipMaps(VkCommandBuffer commandBuffer, const VulkanImage &image) const; // Overwrites bound compute pipeline, push descriptors and push constants, which the caller must restore
+
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] bool IsImageSupported(const VulkanImage &image) const;
+
+        /* --- OPERATORS --- */
+        VulkanMipMapGenerator(const VulkanMipMapGenerator&) = delete;
+        VulkanMipMapGenerator& operator=(const VulkanMipMapGenerator&) = delete;
+
+        /* --- DESTRUCTOR --- */
+        ~VulkanMipMapGenerator();
+
+        /* --- CONSTANTS --- */
+        constexpr static uint32 MAX_GENERATED_MIP_LEVEL_COUNT = 12;
+        constexpr static uint32 WORK_GROUP_TILE_SIZE = 64;
+
+    private:
+        const VulkanDevice &device;
+
+        VkShaderModule shaderModule = VK_NULL_HANDLE;
+        VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
+        VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+        VkPipeline pipeline = VK_NULL_HANDLE;
+
+        VkBuffer counterBuffer = VK_NULL_HANDLE;
+        VmaAllocation counterBufferAllocation = nullptr;
+
+        struct PushConstant
+        {
+            uint32 mipLevelCount = 0;
+            uint32 workGroupCount = 0;
+        };
+
+    };
+
+}
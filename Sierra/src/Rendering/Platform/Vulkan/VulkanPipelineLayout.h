@@ -8,10 +8,13 @@
 #include "VulkanResource.h"
 
 #include "VulkanDevice.h"
+#include "VulkanShader.h"
 
 namespace Sierra
 {
 
+    struct VulkanPipelineLayoutHandles;
+
     class SIERRA_API VulkanPipelineLayout final : public PipelineLayout, public VulkanResource
     {
     public:
@@ -19,14 +22,13 @@ namespace Sierra
         VulkanPipelineLayout(const VulkanDevice &device, const PipelineLayoutCreateInfo &createInfo);
 
         /* --- GETTER METHODS --- */
-        [[nodiscard]] inline VkDescriptorSetLayout GetVulkanDescriptorSetLayout() const { return descriptorSetLayout; }
-        [[nodiscard]] inline VkPipelineLayout GetVulkanPipelineLayout() const { return pipelineLayout; }
-
-        [[nodiscard]] inline uint16 GetPushConstantSize() const { return pushConstantSize; }
-        [[nodiscard]] inline const std::vector<PipelineBinding>& GetBindings() const { return bindings; }
+        [[nodiscard]] VkDescriptorSetLayout GetVulkanDescriptorSetLayout() const;
+        [[nodiscard]] VkPipelineLayout GetVulkanPipelineLayout() const;
+        [[nodiscard]] inline const std::shared_ptr<const VulkanPipelineLayoutHandles>& GetHandles() const { return handles; }
+        [[nodiscard]] inline VkShaderStageFlags GetPushConstantStageFlags() const { return pushConstantStageFlags; }
 
         /* --- DESTRUCTOR --- */
-        ~VulkanPipelineLayout() override;
+        ~VulkanPipelineLayout() override = default;
 
         /* --- CONVERSIONS --- */
         [[nodiscard]] static VkDescriptorType PipelineBindingTypeToVkDescriptorType(PipelineBindingType bindingType);
@@ -34,11 +36,8 @@ namespace Sierra
     private:
         const VulkanDevice &device;
 
-        VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
-        VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
-
-        uint16 pushConstantSize = 0;
-        std::vector<PipelineBinding> bindings;
+        std::shared_ptr<const VulkanPipelineLayoutHandles> handles = nullptr;
+        VkShaderStageFlags pushConstantStageFlags = 0;
 
     };
 
@@ -0,0 +1,133 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "VulkanPipelineLayoutCache.h"
+
+#include "VulkanPipelineLayout.h"
+#include "VulkanShader.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    VulkanPipelineLayoutCache::VulkanPipelineLayoutCache(const VulkanDevice &device)
+        : device(device)
+    {
+
+    }
+
+    /* --- POLLING METHODS --- */
+
+    std::shared_ptr<const VulkanPipelineLayoutHandles> VulkanPipelineLayoutCache::GetLayout(const std::vector<PipelineBinding> &bindings, const std::vector<const VulkanSampler*> &immutableSamplers, const uint16 pushConstantSize, const ShaderStage pushConstantStages, const std::string &name) const
+    {
+        // Pipeline layouts may be created from multiple threads (e.g. by a shader watcher)
+        std::lock_guard lock(mutex);
+
+        // Reuse handles if a live layout of the same description still holds them
+        std::vector<uint64> description = GetLayoutDescription(bindings, immutableSamplers, pushConstantSize, pushConstantStages);
+        Hash key = 0;
+        for (const uint64 value : description) HashCombine(key, value);
+        for (auto [iterator, end] = layouts.equal_range(key); iterator != end; iterator++)
+        {
+            if (iterator->second.description != description) continue;
+            if (std::shared_ptr<const VulkanPipelineLayoutHandles> layout = iterator->second.layout.lock()) return layout;
+        }
+
+        VulkanPipelineLayoutHandles handles = { };
+
+        // Set up descriptor set layout bindings (indices, which no shader accesses, are left out)
+        std::vector<VkDescriptorSetLayoutBinding> descriptorSetLayoutBindings;
+        descriptorSetLayoutBindings.reserve(bindings.size());
+        std::vector<std::vector<VkSampler>> immutableSamplerHandles(bindings.size());
+        for (uint32 i = 0; i < bindings.size(); i++)
+        {
+            const PipelineBinding &binding = bindings[i];
+            if (binding.type == PipelineBindingType::Undefined) continue;
+
+            VkDescriptorSetLayoutBinding &descriptorSetLayoutBinding = descriptorSetLayoutBindings.emplace_back();
+            descriptorSetLayoutBinding.binding = i;
+            descriptorSetLayoutBinding.descriptorType = VulkanPipelineLayout::PipelineBindingTypeToVkDescriptorType(binding.type);
+            descriptorSetLayoutBinding.descriptorCount = binding.arraySize;
+            descriptorSetLayoutBinding.stageFlags = VulkanShader::ShaderStageToVkShaderStageFlags(binding.stages);
+            descriptorSetLayoutBinding.pImmutableSamplers = nullptr;
+
+            // Every array element of a binding with an immutable sampler uses it
+            if (i < immutableSamplers.size() && immutableSamplers[i] != nullptr)
+            {
+                immutableSamplerHandles[i].resize(binding.arraySize, immutableSamplers[i]->GetVulkanSampler());
+                descriptorSetLayoutBinding.pImmutableSamplers = immutableSamplerHandles[i].data();
+                handles.immutableSamplers.push_back(immutableSamplers[i]->GetSharedVulkanSampler());
+            }
+        }
+
+        // Create descriptor set layout
+        if (!descriptorSetLayoutBindings.empty())
+        {
+            // Set up layout create info
+            VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = { };
+            descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+            descriptorSetLayoutCreateInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+            descriptorSetLayoutCreateInfo.bindingCount = static_cast<uint32>(descriptorSetLayoutBindings.size());
+            descriptorSetLayoutCreateInfo.pBindings = descriptorSetLayoutBindings.data();
+
+            const VkResult result = device.GetFunctionTable().vkCreateDescriptorSetLayout(device.GetLogicalDevice(), &descriptorSetLayoutCreateInfo, nullptr, &handles.descriptorSetLayout);
+            SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create descriptor set layout of pipeline layout [{0}]! Error code: {1}.", name, result);
+        }
+
+        // Set up push constant range
+        VkPushConstantRange pushConstantRange = { };
+        pushConstantRange.stageFlags = VulkanShader::ShaderStageToVkShaderStageFlags(pushConstantStages);
+        pushConstantRange.offset = 0;
+        pushConstantRange.size = pushConstantSize;
+
+        // Set up layout create info
+        VkPipelineLayoutCreateInfo layoutCreateInfo = { };
+        layoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        layoutCreateInfo.setLayoutCount = handles.descriptorSetLayout != VK_NULL_HANDLE;
+        layoutCreateInfo.pSetLayouts = &handles.descriptorSetLayout;
+        layoutCreateInfo.pushConstantRangeCount = pushConstantSize > 0;
+        layoutCreateInfo.pPushConstantRanges = &pushConstantRange;
+
+        // Create pipeline layout
+        const VkResult result = device.GetFunctionTable().vkCreatePipelineLayout(device.GetLogicalDevice(), &layoutCreateInfo, nullptr, &handles.pipelineLayout);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create pipeline layout [{0}]! Error code: {1}.", name, result);
+        device.SetObjectName(handles.pipelineLayout, VK_OBJECT_TYPE_PIPELINE_LAYOUT, name);
+
+        // Drop entries of layouts, which have already been destroyed
+        for (auto it = layouts.begin(); it != layouts.end();)
+        {
+            if (it->second.layout.expired()) it = layouts.erase(it);
+            else it++;
+        }
+
+        const VulkanDevice &owningDevice = device;
+        std::shared_ptr<const VulkanPipelineLayoutHandles> layout(new VulkanPipelineLayoutHandles(handles), [&owningDevice](const VulkanPipelineLayoutHandles* layoutHandles)
+        {
+            owningDevice.GetFunctionTable().vkDestroyPipelineLayout(owningDevice.GetLogicalDevice(), layoutHandles->pipelineLayout, nullptr);
+            if (layoutHandles->descriptorSetLayout != VK_NULL_HANDLE) owningDevice.GetFunctionTable().vkDestroyDescriptorSetLayout(owningDevice.GetLogicalDevice(), layoutHandles->descriptorSetLayout, nullptr);
+            delete layoutHandles;
+        });
+        layouts.emplace(key, CachedLayout { .description = std::move(description), .layout = layout });
+
+        return layout;
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    std::vector<uint64> VulkanPipelineLayoutCache::GetLayoutDescription(const std::vector<PipelineBinding> &bindings, const std::vector<const VulkanSampler*> &immutableSamplers, const uint16 pushConstantSize, const ShaderStage pushConstantStages)
+    {
+        std::vector<uint64> description = { bindings.size() };
+        for (uint32 i = 0; i < bindings.size(); i++)
+        {
+            // Identical samplers share a Vulkan sampler, so immutable ones are identified by their handle (which stays unique, as layouts keep their samplers alive)
+            const VkSampler immutableSampler = i < immutableSamplers.size() && immutableSamplers[i] != nullptr ? immutableSamplers[i]->GetVulkanSampler() : VK_NULL_HANDLE;
+            description.insert(description.end(), { static_cast<uint64>(bindings[i].type), bindings[i].arraySize, static_cast<uint64>(bindings[i].stages), reinterpret_cast<uint64>(immutableSampler) });
+        }
+        description.push_back(pushConstantSize);
+        description.push_back(static_cast<uint64>(pushConstantStages));
+        return description;
+    }
+
+}
@@ -0,0 +1,55 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "../../PipelineLayout.h"
+
+#include "VulkanDevice.h"
+#include "VulkanSampler.h"
+
+namespace Sierra
+{
+
+    struct VulkanPipelineLayoutHandles
+    {
+        VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
+        VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+        std::vector<std::shared_ptr<const VkSampler>> immutableSamplers; // Kept alive for as long as the descriptor set layout, which references them
+    };
+
+    // Shares descriptor set and pipeline layouts between pipeline layouts of identical contents, so shaders reflecting to the same resources never create duplicate Vulkan objects
+    class SIERRA_API VulkanPipelineLayoutCache final
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        explicit VulkanPipelineLayoutCache(const VulkanDevice &device);
+
+        /* --- POLLING METHODS --- */
+        // Returns the handles created for a layout of the same contents, or creates new ones (named after the first layout to request them) - handles are destroyed once no layout references them (immutable samplers are indexed by binding, and null for bindings without one)
+        [[nodiscard]] std::shared_ptr<const VulkanPipelineLayoutHandles> GetLayout(const std::vector<PipelineBinding> &bindings, const std::vector<const VulkanSampler*> &immutableSamplers, uint16 pushConstantSize, ShaderStage pushConstantStages, const std::string &name) const;
+
+        /* --- OPERATORS --- */
+        VulkanPipelineLayoutCache(const VulkanPipelineLayoutCache&) = delete;
+        VulkanPipelineLayoutCache& operator=(const VulkanPipelineLayoutCache&) = delete;
+
+        /* --- DESTRUCTOR --- */
+        ~VulkanPipelineLayoutCache() = default;
+
+    private:
+        const VulkanDevice &device;
+
+        struct CachedLayout
+        {
+            std::vector<uint64> description; // Compared on lookup, as different layouts may share a hash
+            std::weak_ptr<const VulkanPipelineLayoutHandles> layout;
+        };
+        mutable std::unordered_multimap<Hash, CachedLayout> layouts;
+        mutable std::mutex mutex;
+
+        [[nodiscard]] static std::vector<uint64> GetLayoutDescription(const std::vector<PipelineBinding> &bindings, const std::vector<const VulkanSampler*> &immutableSamplers, uint16 pushConstantSize, ShaderStage pushConstantStages);
+
+    };
+
+}
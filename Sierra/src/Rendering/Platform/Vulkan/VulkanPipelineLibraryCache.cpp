@@ -0,0 +1,162 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "VulkanPipelineLibraryCache.h"
+
+#include "VulkanPipelineLayoutCache.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    VulkanPipelineLibraryCache::VulkanPipelineLibraryCache(const VulkanDevice &device)
+        : device(device)
+    {
+        linkThread = std::thread(&VulkanPipelineLibraryCache::RunLinks, this);
+    }
+
+    /* --- POLLING METHODS --- */
+
+    std::shared_ptr<const VkPipeline> VulkanPipelineLibraryCache::GetLibrary(const VulkanPipelineLibraryDescription &description, const VkGraphicsPipelineLibraryFlagsEXT libraryType, VkGraphicsPipelineCreateInfo createInfo, const std::string &name) const
+    {
+        // Pipelines may be created from multiple threads (e.g. when rebuilt by a shader watcher)
+        std::lock_guard lock(mutex);
+
+        // Reuse library if a live pipeline still holds one of an identical description (shader code of live libraries is kept alive by them)
+        Hash key = 0;
+        HashCombine(key, libraryType);
+        for (const uint64 value : description.state) HashCombine(key, value);
+        for (auto [iterator, end] = libraries.equal_range(key); iterator != end; iterator++)
+        {
+            const CachedLibrary &cachedLibrary = iterator->second;
+            if (cachedLibrary.libraryType != libraryType || cachedLibrary.state != description.state) continue;
+
+            std::shared_ptr<const VkPipeline> library = cachedLibrary.library.lock();
+            if (library == nullptr) continue;
+
+            const std::shared_ptr<const std::vector<uint32>> shaderCode = cachedLibrary.shaderCode.lock();
+            if (shaderCode != description.shaderCode && (shaderCode == nullptr || description.shaderCode == nullptr || *shaderCode != *description.shaderCode)) continue;
+
+            return library;
+        }
+
+        // Set up library create info
+        VkGraphicsPipelineLibraryCreateInfoEXT libraryCreateInfo = { };
+        libraryCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+        libraryCreateInfo.flags = libraryType;
+
+        // Libraries retain link time optimization info, so pipelines can later be re-linked into an optimized one
+        createInfo.pNext = &libraryCreateInfo;
+        createInfo.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+        // Create library
+        VkPipeline libraryPipeline = VK_NULL_HANDLE;
+        const VkResult result = device.GetFunctionTable().vkCreateGraphicsPipelines(device.GetLogicalDevice(), VK_NULL_HANDLE, 1, &createInfo, nullptr, &libraryPipeline);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create pipeline library [{0}]! Error code: {1}.", name, result);
+        device.SetObjectName(libraryPipeline, VK_OBJECT_TYPE_PIPELINE, name);
+
+        // Drop entries of libraries, which have already been destroyed
+        for (auto it = libraries.begin(); it != libraries.end();)
+        {
+            if (it->second.library.expired()) it = libraries.erase(it);
+            else it++;
+        }
+
+        // Library holds on to its shader code, layout and render pass, so handles in its description cannot be reused by other objects while it is alive
+        const VulkanDevice &owningDevice = device;
+        std::shared_ptr<const VkPipeline> library(new VkPipeline(libraryPipeline), [&owningDevice, shaderCode = description.shaderCode, layout = description.layout, renderPass = description.renderPass](const VkPipeline* pipeline)
+        {
+            owningDevice.GetFunctionTable().vkDestroyPipeline(owningDevice.GetLogicalDevice(), *pipeline, nullptr);
+            delete pipeline;
+        });
+        libraries.emplace(key, CachedLibrary { .libraryType = libraryType, .state = description.state, .shaderCode = description.shaderCode, .library = library });
+
+        return library;
+    }
+
+    std::shared_ptr<VulkanOptimizedPipelineLink> VulkanPipelineLibraryCache::LinkOptimizedPipeline(const std::array<std::shared_ptr<const VkPipeline>, 4> &libraries, const std::shared_ptr<const VulkanPipelineLayoutHandles> &layout, const std::string &name) const
+    {
+        std::shared_ptr<VulkanOptimizedPipelineLink> link = std::make_shared<VulkanOptimizedPipelineLink>();
+        link->libraries = libraries;
+        link->layout = layout;
+        link->name = name;
+
+        {
+            std::lock_guard lock(linkMutex);
+            queuedLinks.push_back(link);
+        }
+        linkCondition.notify_one();
+
+        return link;
+    }
+
+    VkPipeline VulkanPipelineLibraryCache::CancelOptimizedLink(VulkanOptimizedPipelineLink &link) const
+    {
+        // Result is handed over under the lock, so it is either returned here, or destroyed by the worker thread once its link finishes
+        std::lock_guard lock(linkMutex);
+        link.cancelled = true;
+        return link.pipeline.exchange(VK_NULL_HANDLE);
+    }
+
+    /* --- DESTRUCTOR --- */
+
+    VulkanPipelineLibraryCache::~VulkanPipelineLibraryCache()
+    {
+        {
+            std::lock_guard lock(linkMutex);
+            stopping = true;
+        }
+        linkCondition.notify_one();
+        linkThread.join();
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    void VulkanPipelineLibraryCache::RunLinks()
+    {
+        while (true)
+        {
+            // Wait for the next link, skipping ones, which have been cancelled before they began
+            std::shared_ptr<VulkanOptimizedPipelineLink> link = nullptr;
+            {
+                std::unique_lock lock(linkMutex);
+                linkCondition.wait(lock, [this] { return stopping || !queuedLinks.empty(); });
+                if (stopping) return;
+
+                link = std::move(queuedLinks.front());
+                queuedLinks.pop_front();
+                if (link->cancelled) continue;
+            }
+
+            // Set up library linking info
+            std::array<VkPipeline, 4> libraryPipelines = { };
+            for (size i = 0; i < libraryPipelines.size(); i++) libraryPipelines[i] = *link->libraries[i];
+
+            VkPipelineLibraryCreateInfoKHR libraryCreateInfo = { };
+            libraryCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+            libraryCreateInfo.libraryCount = static_cast<uint32>(libraryPipelines.size());
+            libraryCreateInfo.pLibraries = libraryPipelines.data();
+
+            VkGraphicsPipelineCreateInfo pipelineCreateInfo = { };
+            pipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+            pipelineCreateInfo.pNext = &libraryCreateInfo;
+            pipelineCreateInfo.flags = VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT;
+            pipelineCreateInfo.layout = link->layout->pipelineLayout;
+
+            // Link optimized pipeline
+            VkPipeline pipeline = VK_NULL_HANDLE;
+            const VkResult result = device.GetFunctionTable().vkCreateGraphicsPipelines(device.GetLogicalDevice(), VK_NULL_HANDLE, 1, &pipelineCreateInfo, nullptr, &pipeline);
+            SR_WARNING_IF(result != VK_SUCCESS, "[Vulkan]: Could not link optimized graphics pipeline [{0}], so the fast-linked one will be used instead! Error code: {1}.", link->name, result);
+            if (result != VK_SUCCESS) continue;
+            device.SetObjectName(pipeline, VK_OBJECT_TYPE_PIPELINE, link->name);
+
+            // Publish pipeline, unless its owner has been destroyed in the meantime, in which case it has never been bound, and can be destroyed right away
+            std::lock_guard lock(linkMutex);
+            if (link->cancelled) device.GetFunctionTable().vkDestroyPipeline(device.GetLogicalDevice(), pipeline, nullptr);
+            else link->pipeline.store(pipeline, std::memory_order_release);
+        }
+    }
+
+}
@@ -0,0 +1,80 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "VulkanResource.h"
+
+#include "VulkanDevice.h"
+
+namespace Sierra
+{
+
+    struct VulkanPipelineLayoutHandles;
+
+    struct VulkanPipelineLibraryDescription
+    {
+        std::vector<uint64> state; // Every value the library is created out of (layouts and render passes are identified by their handles, which stay unique, as libraries keep them alive)
+        std::shared_ptr<const std::vector<uint32>> shaderCode = nullptr; // Compared by contents, so identical shaders loaded twice still share libraries
+        std::shared_ptr<const void> layout = nullptr;
+        std::shared_ptr<const void> renderPass = nullptr;
+    };
+
+    struct VulkanOptimizedPipelineLink
+    {
+        std::array<std::shared_ptr<const VkPipeline>, 4> libraries; // Kept, so the libraries outlive the link
+        std::shared_ptr<const VulkanPipelineLayoutHandles> layout;
+        std::string name;
+
+        std::atomic<VkPipeline> pipeline = VK_NULL_HANDLE; // Set once the link has finished
+        bool cancelled = false;
+    };
+
+    // Shares graphics pipeline libraries (VK_EXT_graphics_pipeline_library) between pipelines, so every part of a pipeline is only compiled once, and new variants merely link existing parts
+    class SIERRA_API VulkanPipelineLibraryCache final
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        explicit VulkanPipelineLibraryCache(const VulkanDevice &device);
+
+        /* --- POLLING METHODS --- */
+        // Returns the library created out of an identical description, or creates one out of the create info (library flags are set here) - libraries are destroyed once no pipeline references them
+        [[nodiscard]] std::shared_ptr<const VkPipeline> GetLibrary(const VulkanPipelineLibraryDescription &description, VkGraphicsPipelineLibraryFlagsEXT libraryType, VkGraphicsPipelineCreateInfo createInfo, const std::string &name) const;
+
+        // Queues a link time optimized pipeline to be linked out of the given libraries on the cache's worker thread (all pipelines share the one thread, so none of them block on their links)
+        [[nodiscard]] std::shared_ptr<VulkanOptimizedPipelineLink> LinkOptimizedPipeline(const std::array<std::shared_ptr<const VkPipeline>, 4> &libraries, const std::shared_ptr<const VulkanPipelineLayoutHandles> &layout, const std::string &name) const;
+        // Returns the linked pipeline, if the link has finished - otherwise, the worker thread skips it, or disposes of its result, without the caller having to wait
+        [[nodiscard]] VkPipeline CancelOptimizedLink(VulkanOptimizedPipelineLink &link) const;
+
+        /* --- OPERATORS --- */
+        VulkanPipelineLibraryCache(const VulkanPipelineLibraryCache&) = delete;
+        VulkanPipelineLibraryCache& operator=(const VulkanPipelineLibraryCache&) = delete;
+
+        /* --- DESTRUCTOR --- */
+        ~VulkanPipelineLibraryCache();
+
+    private:
+        const VulkanDevice &device;
+
+        struct CachedLibrary
+        {
+            VkGraphicsPipelineLibraryFlagsEXT libraryType = 0;
+            std::vector<uint64> state; // Compared on lookup, as different descriptions may share a hash
+            std::weak_ptr<const std::vector<uint32>> shaderCode;
+            std::weak_ptr<const VkPipeline> library;
+        };
+        mutable std::unordered_multimap<Hash, CachedLibrary> libraries;
+        mutable std::mutex mutex;
+
+        mutable std::deque<std::shared_ptr<VulkanOptimizedPipelineLink>> queuedLinks;
+        mutable std::mutex linkMutex;
+        mutable std::condition_variable linkCondition;
+        bool stopping = false;
+        std::thread linkThread;
+
+        void RunLinks();
+
+    };
+
+}
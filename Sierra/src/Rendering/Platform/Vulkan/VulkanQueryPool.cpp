@@ -0,0 +1,80 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "VulkanQueryPool.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    VulkanQueryPool::VulkanQueryPool(const VulkanDevice &device, const QueryPoolCreateInfo &createInfo)
+        : QueryPool(createInfo), VulkanResource(createInfo.name), device(device), timestampPeriod(device.GetPhysicalDeviceProperties().limits.timestampPeriod)
+    {
+        SR_ERROR_IF(!device.IsQueryTypeSupported(createInfo.type), "[Vulkan]: Cannot create query pool [{0}] of unsupported type! Make sure to use Device::IsQueryTypeSupported() to query support.", GetName());
+
+        // Bits above the queue family's timestamp width are undefined, so they must be masked off when reading results
+        const uint32 timestampValidBits = device.GetGeneralQueueFamilyTimestampValidBits();
+        if (timestampValidBits < 64) timestampValidMask = (1ULL << timestampValidBits) - 1;
+
+        // Set up query pool create info (statistics are written in the order of their flag bits, which matches the layout of QueryPipelineStatistics)
+        VkQueryPoolCreateInfo queryPoolCreateInfo = { };
+        queryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolCreateInfo.queryType = QueryTypeToVkQueryType(createInfo.type);
+        queryPoolCreateInfo.queryCount = createInfo.queryCount;
+        queryPoolCreateInfo.pipelineStatistics = createInfo.type == QueryType::PipelineStatistics ? PIPELINE_STATISTIC_FLAGS : 0;
+
+        // Create query pool
+        const VkResult result = device.GetFunctionTable().vkCreateQueryPool(device.GetLogicalDevice(), &queryPoolCreateInfo, nullptr, &queryPool);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create query pool [{0}]! Error code: {1}.", GetName(), result);
+
+        // Assign name
+        device.SetObjectName(queryPool, VK_OBJECT_TYPE_QUERY_POOL, GetName());
+    }
+
+    /* --- GETTER METHODS --- */
+
+    bool VulkanQueryPool::GetResults(const uint32 firstQuery, uint32 queryCount, std::vector<uint64> &results) const
+    {
+        queryCount = queryCount != 0 ? queryCount : GetQueryCount() - firstQuery;
+        SR_ERROR_IF(firstQuery + queryCount > GetQueryCount(), "[Vulkan]: Cannot get results of queries [{0}-{1}] of query pool [{2}], as they exceed its query count - [{3}]!", firstQuery, firstQuery + queryCount - 1, GetName(), GetQueryCount());
+
+        // Read results, without waiting for them
+        const uint32 valuesPerQuery = GetType() == QueryType::PipelineStatistics ? PIPELINE_STATISTIC_COUNT : 1;
+        results.resize(static_cast<uint64>(queryCount) * valuesPerQuery);
+        const VkResult result = device.GetFunctionTable().vkGetQueryPoolResults(device.GetLogicalDevice(), queryPool, firstQuery, queryCount, results.size() * sizeof(uint64), results.data(), valuesPerQuery * sizeof(uint64), VK_QUERY_RESULT_64_BIT);
+        if (result == VK_NOT_READY) return false;
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not get results of query pool [{0}]! Error code: {1}.", GetName(), result);
+
+        // Discard undefined high bits and convert timestamps from ticks to nanoseconds
+        if (GetType() == QueryType::Timestamp)
+        {
+            for (uint64 &value : results) value = static_cast<uint64>(static_cast<float64>(value & timestampValidMask) * timestampPeriod);
+        }
+
+        return true;
+    }
+
+    /* --- DESTRUCTOR --- */
+
+    VulkanQueryPool::~VulkanQueryPool()
+    {
+        device.GetFunctionTable().vkDestroyQueryPool(device.GetLogicalDevice(), queryPool, nullptr);
+    }
+
+    /* --- CONVERSIONS --- */
+
+    VkQueryType VulkanQueryPool::QueryTypeToVkQueryType(const QueryType queryType)
+    {
+        switch (queryType)
+        {
+            case QueryType::Occlusion:                  return VK_QUERY_TYPE_OCCLUSION;
+            case QueryType::PipelineStatistics:         return VK_QUERY_TYPE_PIPELINE_STATISTICS;
+            case QueryType::Timestamp:                  return VK_QUERY_TYPE_TIMESTAMP;
+        }
+
+        return VK_QUERY_TYPE_OCCLUSION;
+    }
+
+}
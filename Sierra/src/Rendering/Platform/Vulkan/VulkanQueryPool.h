@@ -0,0 +1,43 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "../../QueryPool.h"
+#include "VulkanResource.h"
+
+#include "VulkanDevice.h"
+
+namespace Sierra
+{
+
+    class SIERRA_API VulkanQueryPool final : public QueryPool, public VulkanResource
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        VulkanQueryPool(const VulkanDevice &device, const QueryPoolCreateInfo &createInfo);
+
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] bool GetResults(uint32 firstQuery, uint32 queryCount, std::vector<uint64> &results) const override;
+        [[nodiscard]] inline VkQueryPool GetVulkanQueryPool() const { return queryPool; }
+
+        /* --- DESTRUCTOR --- */
+        ~VulkanQueryPool() override;
+
+        /* --- CONVERSIONS --- */
+        [[nodiscard]] static VkQueryType QueryTypeToVkQueryType(QueryType queryType);
+
+        /* --- CONSTANTS --- */
+        constexpr static VkQueryPipelineStatisticFlags PIPELINE_STATISTIC_FLAGS = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT | VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT | VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT | VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT | VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT | VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT | VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+
+    private:
+        const VulkanDevice &device;
+
+        VkQueryPool queryPool = VK_NULL_HANDLE;
+        float64 timestampPeriod = 1.0;
+        uint64 timestampValidMask = ~0ULL;
+
+    };
+
+}
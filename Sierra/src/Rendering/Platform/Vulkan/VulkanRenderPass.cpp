@@ -75,6 +75,7 @@ namespace Sierra
                 resolveAttachmentDescription.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
                 resolveAttachmentDescription.finalLayout = VK_IMAGE_LAYOUT_GENERAL;
                 attachmentDescription.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL; // Resolving an image requires it
+                if (vulkanTemplateImage.GetUsage() & ImageUsage::TransientAttachment) attachmentDescription.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE; // Only the resolved result outlives the pass, so multisampled data never has to leave tile memory
 
                 // Set up framebuffer resolve attachment
                 VkFramebufferAttachmentImageInfo &framebufferResolveAttachmentInfo = framebufferImageAttachments.emplace_back();
@@ -225,38 +226,19 @@ namespace Sierra
         renderPassCreateInfo.dependencyCount = static_cast<uint32>(subpassDependencies.size());
         renderPassCreateInfo.pDependencies = subpassDependencies.data();
 
-        // Create render pass
-        VkResult result = device.GetFunctionTable().vkCreateRenderPass(device.GetLogicalDevice(), &renderPassCreateInfo, nullptr, &renderPass);
-        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create render pass [{0}]! Error code: {1}.", GetName(), result);
+        // Get render pass (render passes of identical attachments and subpasses are shared, so pipelines created for either of them are, too)
+        renderPass = device.GetRenderPassCache().GetRenderPass(renderPassCreateInfo, GetName());
 
-        // Set up framebuffer attachment create info
-        VkFramebufferAttachmentsCreateInfo framebufferAttachmentsCreateInfo = { };
-        framebufferAttachmentsCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO;
-        framebufferAttachmentsCreateInfo.attachmentImageInfoCount = static_cast<uint32>(framebufferImageAttachments.size());
-        framebufferAttachmentsCreateInfo.pAttachmentImageInfos = framebufferImageAttachments.data();
-
-        // Set up framebuffer create info
-        VkFramebufferCreateInfo framebufferCreateInfo = { };
-        framebufferCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-        framebufferCreateInfo.pNext = &framebufferAttachmentsCreateInfo;
-        framebufferCreateInfo.flags = VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT;
-        framebufferCreateInfo.renderPass = renderPass;
-        framebufferCreateInfo.attachmentCount = framebufferAttachmentsCreateInfo.attachmentImageInfoCount;
-        framebufferCreateInfo.width = framebufferAttachmentsCreateInfo.pAttachmentImageInfos[0].width;
-        framebufferCreateInfo.height = framebufferAttachmentsCreateInfo.pAttachmentImageInfos[0].height;
-        framebufferCreateInfo.layers = 1;
-
-        // Create framebuffer
-        result = device.GetFunctionTable().vkCreateFramebuffer(device.GetLogicalDevice(), &framebufferCreateInfo, nullptr, &framebuffer);
-        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create framebuffer of render pass [{0}]! Error code: {1}.", GetName(), result);
+        // Get framebuffer
+        framebuffer = GetFramebuffer();
     }
 
     /* --- POLLING METHODS --- */
 
     void VulkanRenderPass::Resize(const uint32 width, const uint32 height)
     {
-        // Destroy old framebuffer
-        device.GetFunctionTable().vkDestroyFramebuffer(device.GetLogicalDevice(), framebuffer, nullptr);
+        // Old framebuffer may still be referenced by submitted command buffers, so it is kept alive until they have executed, instead of waiting for them
+        device.QueueHandleForDestruction([retiredFramebuffer = std::move(framebuffer)] { });
 
         // Change attachments' size
         for (auto &framebufferImageAttachment : framebufferImageAttachments)
@@ -265,38 +247,31 @@ namespace Sierra
             framebufferImageAttachment.height = height;
         }
 
+        // Get framebuffer of new size
+        framebuffer = GetFramebuffer();
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    std::shared_ptr<const VkFramebuffer> VulkanRenderPass::GetFramebuffer() const
+    {
         // Set up framebuffer attachment create info
         VkFramebufferAttachmentsCreateInfo framebufferAttachmentsCreateInfo = { };
         framebufferAttachmentsCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO;
         framebufferAttachmentsCreateInfo.attachmentImageInfoCount = static_cast<uint32>(framebufferImageAttachments.size());
         framebufferAttachmentsCreateInfo.pAttachmentImageInfos = framebufferImageAttachments.data();
 
-        // Set up framebuffer create info
+        // Set up framebuffer create info (render pass is assigned by the cache)
         VkFramebufferCreateInfo framebufferCreateInfo = { };
         framebufferCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
         framebufferCreateInfo.pNext = &framebufferAttachmentsCreateInfo;
         framebufferCreateInfo.flags = VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT;
-        framebufferCreateInfo.renderPass = renderPass;
         framebufferCreateInfo.attachmentCount = framebufferAttachmentsCreateInfo.attachmentImageInfoCount;
         framebufferCreateInfo.width = framebufferAttachmentsCreateInfo.pAttachmentImageInfos[0].width;
         framebufferCreateInfo.height = framebufferAttachmentsCreateInfo.pAttachmentImageInfos[0].height;
         framebufferCreateInfo.layers = 1;
 
-        // Recreate framebuffer
-        const VkResult result = device.GetFunctionTable().vkCreateFramebuffer(device.GetLogicalDevice(), &framebufferCreateInfo, nullptr, &framebuffer);
-        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not resize framebuffer of render pass [{0}]! Error code: {1}.", GetName(), result);
-
-        // Set object names
-        device.SetObjectName(renderPass, VK_OBJECT_TYPE_RENDER_PASS, GetName());
-        device.SetObjectName(framebuffer, VK_OBJECT_TYPE_FRAMEBUFFER, "Framebuffer of render pass [" + GetName() + "]");
-    }
-
-    /* --- DESTRUCTOR --- */
-
-    VulkanRenderPass::~VulkanRenderPass()
-    {
-        device.GetFunctionTable().vkDestroyFramebuffer(device.GetLogicalDevice(), framebuffer, nullptr);
-        device.GetFunctionTable().vkDestroyRenderPass(device.GetLogicalDevice(), renderPass, nullptr);
+        return device.GetRenderPassCache().GetFramebuffer(renderPass, framebufferCreateInfo, "Framebuffer of render pass [" + GetName() + "]");
     }
 
     /* --- CONVERSIONS --- */
@@ -307,6 +282,7 @@ namespace Sierra
         {
             case RenderPassAttachmentLoadOperation::Clear:        return VK_ATTACHMENT_LOAD_OP_CLEAR;
             case RenderPassAttachmentLoadOperation::Load:         return VK_ATTACHMENT_LOAD_OP_LOAD;
+            case RenderPassAttachmentLoadOperation::DontCare:     return VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         }
 
         return VK_ATTACHMENT_LOAD_OP_DONT_CARE;
@@ -8,6 +8,7 @@
 #include "VulkanResource.h"
 
 #include "VulkanDevice.h"
+#include "VulkanRenderPassCache.h"
 
 namespace Sierra
 {
@@ -26,12 +27,13 @@ namespace Sierra
         [[nodiscard]] inline uint32 GetResolveAttachmentCount() const override { return resolveAttachmentCount; }
         [[nodiscard]] inline bool HasDepthAttachment() const override { return hasDepthAttachment; };
 
-        [[nodiscard]] inline VkFramebuffer GetVulkanFramebuffer() const { return framebuffer; }
-        [[nodiscard]] inline VkRenderPass GetVulkanRenderPass() const { return renderPass; }
+        [[nodiscard]] inline VkFramebuffer GetVulkanFramebuffer() const { return *framebuffer; }
+        [[nodiscard]] inline VkRenderPass GetVulkanRenderPass() const { return *renderPass; }
+        [[nodiscard]] inline const std::shared_ptr<const VkRenderPass>& GetRenderPassHandle() const { return renderPass; }
         [[nodiscard]] inline VkFormat GetFormatOfAttachment(const uint32 attachmentIndex) const { return framebufferAttachmentImageFormats[attachmentIndex]; }
 
         /* --- DESTRUCTOR --- */
-        ~VulkanRenderPass() override;
+        ~VulkanRenderPass() override = default;
 
         /* --- CONVERSIONS --- */
         static VkAttachmentLoadOp AttachmentLoadOperationToVkAttachmentLoadOp(RenderPassAttachmentLoadOperation loadOperation);
@@ -43,12 +45,14 @@ namespace Sierra
         std::vector<VkFormat> framebufferAttachmentImageFormats;
         std::vector<VkFramebufferAttachmentImageInfo> framebufferImageAttachments;
 
-        VkFramebuffer framebuffer = VK_NULL_HANDLE;
-        VkRenderPass renderPass = VK_NULL_HANDLE;
+        std::shared_ptr<const VkFramebuffer> framebuffer = nullptr;
+        std::shared_ptr<const VkRenderPass> renderPass = nullptr;
 
         bool hasDepthAttachment = false;
         uint32 resolveAttachmentCount = 0;
 
+        [[nodiscard]] std::shared_ptr<const VkFramebuffer> GetFramebuffer() const;
+
     };
 
 }
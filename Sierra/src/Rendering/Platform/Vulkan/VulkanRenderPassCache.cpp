@@ -0,0 +1,175 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "VulkanRenderPassCache.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    VulkanRenderPassCache::VulkanRenderPassCache(const VulkanDevice &device)
+        : device(device)
+    {
+
+    }
+
+    /* --- POLLING METHODS --- */
+
+    std::shared_ptr<const VkRenderPass> VulkanRenderPassCache::GetRenderPass(const VkRenderPassCreateInfo &createInfo, const std::string &name) const
+    {
+        // Render passes may be created from multiple threads (e.g. by a shader watcher)
+        std::lock_guard lock(mutex);
+
+        // Reuse render pass if a live one was created out of the same description
+        std::vector<uint64> description = GetRenderPassDescription(createInfo);
+        const Hash key = GetDescriptionHash(description);
+        for (auto [iterator, end] = renderPasses.equal_range(key); iterator != end; iterator++)
+        {
+            if (iterator->second.description != description) continue;
+            if (std::shared_ptr<const VkRenderPass> renderPass = iterator->second.renderPass.lock()) return renderPass;
+        }
+
+        // Create render pass
+        VkRenderPass vulkanRenderPass = VK_NULL_HANDLE;
+        const VkResult result = device.GetFunctionTable().vkCreateRenderPass(device.GetLogicalDevice(), &createInfo, nullptr, &vulkanRenderPass);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create render pass [{0}]! Error code: {1}.", name, result);
+        device.SetObjectName(vulkanRenderPass, VK_OBJECT_TYPE_RENDER_PASS, name);
+
+        // Drop entries of render passes, which have already been destroyed
+        for (auto it = renderPasses.begin(); it != renderPasses.end();)
+        {
+            if (it->second.renderPass.expired()) it = renderPasses.erase(it);
+            else it++;
+        }
+
+        const VulkanDevice &owningDevice = device;
+        std::shared_ptr<const VkRenderPass> renderPass(new VkRenderPass(vulkanRenderPass), [&owningDevice](const VkRenderPass* cachedRenderPass)
+        {
+            owningDevice.GetFunctionTable().vkDestroyRenderPass(owningDevice.GetLogicalDevice(), *cachedRenderPass, nullptr);
+            delete cachedRenderPass;
+        });
+        renderPasses.emplace(key, CachedRenderPass { .description = std::move(description), .renderPass = renderPass });
+
+        return renderPass;
+    }
+
+    std::shared_ptr<const VkFramebuffer> VulkanRenderPassCache::GetFramebuffer(const std::shared_ptr<const VkRenderPass> &renderPass, VkFramebufferCreateInfo createInfo, const std::string &name) const
+    {
+        std::lock_guard lock(mutex);
+
+        // Reuse framebuffer if a live one has matching attachments (render pass handles are unique while framebuffers, which hold on to them, are alive)
+        std::vector<uint64> description = GetFramebufferDescription(*renderPass, createInfo);
+        const Hash key = GetDescriptionHash(description);
+        for (auto [iterator, end] = framebuffers.equal_range(key); iterator != end; iterator++)
+        {
+            if (iterator->second.description != description) continue;
+            if (std::shared_ptr<const VkFramebuffer> framebuffer = iterator->second.framebuffer.lock()) return framebuffer;
+        }
+
+        // Create framebuffer
+        createInfo.renderPass = *renderPass;
+        VkFramebuffer vulkanFramebuffer = VK_NULL_HANDLE;
+        const VkResult result = device.GetFunctionTable().vkCreateFramebuffer(device.GetLogicalDevice(), &createInfo, nullptr, &vulkanFramebuffer);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create framebuffer [{0}]! Error code: {1}.", name, result);
+        device.SetObjectName(vulkanFramebuffer, VK_OBJECT_TYPE_FRAMEBUFFER, name);
+
+        // Drop entries of framebuffers, which have already been destroyed
+        for (auto it = framebuffers.begin(); it != framebuffers.end();)
+        {
+            if (it->second.framebuffer.expired()) it = framebuffers.erase(it);
+            else it++;
+        }
+
+        // Framebuffer holds on to its render pass, as it must not outlive it
+        const VulkanDevice &owningDevice = device;
+        std::shared_ptr<const VkFramebuffer> framebuffer(new VkFramebuffer(vulkanFramebuffer), [&owningDevice, renderPass](const VkFramebuffer* cachedFramebuffer)
+        {
+            owningDevice.GetFunctionTable().vkDestroyFramebuffer(owningDevice.GetLogicalDevice(), *cachedFramebuffer, nullptr);
+            delete cachedFramebuffer;
+        });
+        framebuffers.emplace(key, CachedFramebuffer { .description = std::move(description), .framebuffer = framebuffer });
+
+        return framebuffer;
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    std::vector<uint64> VulkanRenderPassCache::GetRenderPassDescription(const VkRenderPassCreateInfo &createInfo)
+    {
+        std::vector<uint64> description;
+        const auto DescribeAttachmentReferences = [&description](const VkAttachmentReference* references, const uint32 referenceCount)
+        {
+            description.push_back(referenceCount);
+            for (uint32 i = 0; i < referenceCount; i++)
+            {
+                description.push_back(references[i].attachment);
+                description.push_back(references[i].layout);
+            }
+        };
+
+        description.push_back(createInfo.flags);
+        description.push_back(createInfo.attachmentCount);
+        for (uint32 i = 0; i < createInfo.attachmentCount; i++)
+        {
+            const VkAttachmentDescription &attachment = createInfo.pAttachments[i];
+            description.insert(description.end(), { attachment.flags, static_cast<uint64>(attachment.format), static_cast<uint64>(attachment.samples), static_cast<uint64>(attachment.loadOp), static_cast<uint64>(attachment.storeOp), static_cast<uint64>(attachment.stencilLoadOp), static_cast<uint64>(attachment.stencilStoreOp), static_cast<uint64>(attachment.initialLayout), static_cast<uint64>(attachment.finalLayout) });
+        }
+
+        description.push_back(createInfo.subpassCount);
+        for (uint32 i = 0; i < createInfo.subpassCount; i++)
+        {
+            const VkSubpassDescription &subpass = createInfo.pSubpasses[i];
+            description.push_back(subpass.flags);
+            description.push_back(subpass.pipelineBindPoint);
+            DescribeAttachmentReferences(subpass.pInputAttachments, subpass.inputAttachmentCount);
+            DescribeAttachmentReferences(subpass.pColorAttachments, subpass.colorAttachmentCount);
+            DescribeAttachmentReferences(subpass.pResolveAttachments, subpass.pResolveAttachments != nullptr ? subpass.colorAttachmentCount : 0);
+            DescribeAttachmentReferences(subpass.pDepthStencilAttachment, subpass.pDepthStencilAttachment != nullptr);
+
+            description.push_back(subpass.preserveAttachmentCount);
+            description.insert(description.end(), subpass.pPreserveAttachments, subpass.pPreserveAttachments + subpass.preserveAttachmentCount);
+        }
+
+        description.push_back(createInfo.dependencyCount);
+        for (uint32 i = 0; i < createInfo.dependencyCount; i++)
+        {
+            const VkSubpassDependency &dependency = createInfo.pDependencies[i];
+            description.insert(description.end(), { dependency.srcSubpass, dependency.dstSubpass, dependency.srcStageMask, dependency.dstStageMask, dependency.srcAccessMask, dependency.dstAccessMask, dependency.dependencyFlags });
+        }
+
+        return description;
+    }
+
+    std::vector<uint64> VulkanRenderPassCache::GetFramebufferDescription(const VkRenderPass renderPass, const VkFramebufferCreateInfo &createInfo)
+    {
+        std::vector<uint64> description = { reinterpret_cast<uint64>(renderPass), createInfo.flags, createInfo.width, createInfo.height, createInfo.layers, createInfo.attachmentCount };
+
+        // Attachments of imageless framebuffers are described within the chained info, while those of regular ones are their image views
+        const VkFramebufferAttachmentsCreateInfo* attachmentsCreateInfo = static_cast<const VkFramebufferAttachmentsCreateInfo*>(createInfo.pNext);
+        if (createInfo.flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT)
+        {
+            for (uint32 i = 0; i < attachmentsCreateInfo->attachmentImageInfoCount; i++)
+            {
+                const VkFramebufferAttachmentImageInfo &attachment = attachmentsCreateInfo->pAttachmentImageInfos[i];
+                description.insert(description.end(), { attachment.flags, attachment.usage, attachment.width, attachment.height, attachment.layerCount, attachment.viewFormatCount });
+                for (uint32 j = 0; j < attachment.viewFormatCount; j++) description.push_back(attachment.pViewFormats[j]);
+            }
+        }
+        else
+        {
+            for (uint32 i = 0; i < createInfo.attachmentCount; i++) description.push_back(reinterpret_cast<uint64>(createInfo.pAttachments[i]));
+        }
+
+        return description;
+    }
+
+    Hash VulkanRenderPassCache::GetDescriptionHash(const std::vector<uint64> &description)
+    {
+        Hash hash = 0;
+        for (const uint64 value : description) HashCombine(hash, value);
+        return hash;
+    }
+
+}
@@ -0,0 +1,58 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "VulkanDevice.h"
+
+namespace Sierra
+{
+
+    // Shares render passes (and their imageless framebuffers) between render passes of identical attachment formats, sample counts, load/store operations and subpasses, so they are only created once, and pipelines built for either are interchangeable
+    class SIERRA_API VulkanRenderPassCache final
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        explicit VulkanRenderPassCache(const VulkanDevice &device);
+
+        /* --- POLLING METHODS --- */
+        // Returns the render pass created out of an identical create info, or creates a new one (named after the first render pass to request it) - render passes are destroyed once nothing references them
+        [[nodiscard]] std::shared_ptr<const VkRenderPass> GetRenderPass(const VkRenderPassCreateInfo &createInfo, const std::string &name) const;
+
+        // Returns an imageless framebuffer of matching attachment infos (framebuffer's render pass is set here, and kept alive by it)
+        [[nodiscard]] std::shared_ptr<const VkFramebuffer> GetFramebuffer(const std::shared_ptr<const VkRenderPass> &renderPass, VkFramebufferCreateInfo createInfo, const std::string &name) const;
+
+        /* --- OPERATORS --- */
+        VulkanRenderPassCache(const VulkanRenderPassCache&) = delete;
+        VulkanRenderPassCache& operator=(const VulkanRenderPassCache&) = delete;
+
+        /* --- DESTRUCTOR --- */
+        ~VulkanRenderPassCache() = default;
+
+    private:
+        const VulkanDevice &device;
+
+        struct CachedRenderPass
+        {
+            std::vector<uint64> description; // Compared on lookup, as different create infos may share a hash
+            std::weak_ptr<const VkRenderPass> renderPass;
+        };
+        mutable std::unordered_multimap<Hash, CachedRenderPass> renderPasses;
+
+        struct CachedFramebuffer
+        {
+            std::vector<uint64> description;
+            std::weak_ptr<const VkFramebuffer> framebuffer;
+        };
+        mutable std::unordered_multimap<Hash, CachedFramebuffer> framebuffers;
+
+        mutable std::mutex mutex;
+
+        [[nodiscard]] static std::vector<uint64> GetRenderPassDescription(const VkRenderPassCreateInfo &createInfo);
+        [[nodiscard]] static std::vector<uint64> GetFramebufferDescription(VkRenderPass renderPass, const VkFramebufferCreateInfo &createInfo);
+        [[nodiscard]] static Hash GetDescriptionHash(const std::vector<uint64> &description);
+
+    };
+
+}
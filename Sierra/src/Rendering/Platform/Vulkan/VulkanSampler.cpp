@@ -4,6 +4,8 @@
 
 #include "VulkanSampler.h"
 
+#include "VulkanSamplerCache.h"
+
 namespace Sierra
 {
 
@@ -33,19 +35,8 @@ namespace Sierra
         samplerCreateInfo.borderColor = SamplerBorderColorToVkBorderColor(createInfo.borderColor);
         samplerCreateInfo.unnormalizedCoordinates = VK_FALSE;
 
-        // Create sampler
-        const VkResult result = device.GetFunctionTable().vkCreateSampler(device.GetLogicalDevice(), &samplerCreateInfo, nullptr, &sampler);
-        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create sampler [{0}]! Error code: {1}.", GetName(), result);
-
-        // Assign name
-        device.SetObjectName(sampler, VK_OBJECT_TYPE_SAMPLER, GetName());
-    }
-
-    /* --- DESTRUCTOR --- */
-
-    VulkanSampler::~VulkanSampler()
-    {
-        device.GetFunctionTable().vkDestroySampler(device.GetLogicalDevice(), sampler, nullptr);
+        // Get sampler (samplers of identical state share a single Vulkan sampler)
+        sampler = device.GetSamplerCache().GetSampler(samplerCreateInfo, GetName());
     }
 
     /* --- CONVERSIONS --- */
@@ -19,10 +19,11 @@ namespace Sierra
         VulkanSampler(const VulkanDevice &device, const SamplerCreateInfo &createInfo);
 
         /* --- GETTER METHODS --- */
-        [[nodiscard]] inline VkSampler GetVulkanSampler() const { return sampler; }
+        [[nodiscard]] inline VkSampler GetVulkanSampler() const { return *sampler; }
+        [[nodiscard]] inline const std::shared_ptr<const VkSampler>& GetSharedVulkanSampler() const { return sampler; }
 
         /* --- DESTRUCTOR --- */
-        ~VulkanSampler() override;
+        ~VulkanSampler() override = default;
 
         /* --- CONVERSIONS --- */
         [[nodiscard]] static VkFilter SamplerSampleModeToVkFilter(SamplerFilter sampleMode);
@@ -34,7 +35,7 @@ namespace Sierra
 
     private:
         const VulkanDevice &device;
-        VkSampler sampler = VK_NULL_HANDLE;
+        std::shared_ptr<const VkSampler> sampler = nullptr;
 
     };
 
@@ -0,0 +1,92 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "VulkanSamplerCache.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    VulkanSamplerCache::VulkanSamplerCache(const VulkanDevice &device)
+        : device(device)
+    {
+
+    }
+
+    /* --- POLLING METHODS --- */
+
+    std::shared_ptr<const VkSampler> VulkanSamplerCache::GetSampler(const VkSamplerCreateInfo &createInfo, const std::string &name) const
+    {
+        // Samplers may be created from multiple threads (e.g. by a shader watcher)
+        std::lock_guard lock(mutex);
+
+        // Reuse sampler if a live one was created out of the same state
+        std::vector<uint64> description = GetSamplerDescription(createInfo);
+        Hash key = 0;
+        for (const uint64 value : description) HashCombine(key, value);
+        for (auto [iterator, end] = samplers.equal_range(key); iterator != end; iterator++)
+        {
+            if (iterator->second.description != description) continue;
+            if (std::shared_ptr<const VkSampler> sampler = iterator->second.sampler.lock()) return sampler;
+        }
+
+        // Create sampler
+        VkSampler vulkanSampler = VK_NULL_HANDLE;
+        const VkResult result = device.GetFunctionTable().vkCreateSampler(device.GetLogicalDevice(), &createInfo, nullptr, &vulkanSampler);
+        SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create sampler [{0}]! Error code: {1}.", name, result);
+        device.SetObjectName(vulkanSampler, VK_OBJECT_TYPE_SAMPLER, name);
+
+        // Drop entries of samplers, which have already been destroyed
+        for (auto it = samplers.begin(); it != samplers.end();)
+        {
+            if (it->second.sampler.expired()) it = samplers.erase(it);
+            else it++;
+        }
+
+        const VulkanDevice &owningDevice = device;
+        std::shared_ptr<const VkSampler> sampler(new VkSampler(vulkanSampler), [&owningDevice](const VkSampler* cachedSampler)
+        {
+            owningDevice.GetFunctionTable().vkDestroySampler(owningDevice.GetLogicalDevice(), *cachedSampler, nullptr);
+            delete cachedSampler;
+        });
+        samplers.emplace(key, CachedSampler { .description = std::move(description), .sampler = sampler });
+
+        return sampler;
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    std::vector<uint64> VulkanSamplerCache::GetSamplerDescription(const VkSamplerCreateInfo &createInfo)
+    {
+        // Floating-point state is compared by its bits, so that it takes part in the description without any rounding
+        const auto GetFloat32Bits = [](const float32 value) -> uint64
+        {
+            uint32 bits = 0;
+            std::memcpy(&bits, &value, sizeof(float32));
+            return bits;
+        };
+
+        return
+        {
+            static_cast<uint64>(createInfo.flags),
+            static_cast<uint64>(createInfo.magFilter),
+            static_cast<uint64>(createInfo.minFilter),
+            static_cast<uint64>(createInfo.mipmapMode),
+            static_cast<uint64>(createInfo.addressModeU),
+            static_cast<uint64>(createInfo.addressModeV),
+            static_cast<uint64>(createInfo.addressModeW),
+            GetFloat32Bits(createInfo.mipLodBias),
+            static_cast<uint64>(createInfo.anisotropyEnable),
+            GetFloat32Bits(createInfo.maxAnisotropy),
+            static_cast<uint64>(createInfo.compareEnable),
+            static_cast<uint64>(createInfo.compareOp),
+            GetFloat32Bits(createInfo.minLod),
+            GetFloat32Bits(createInfo.maxLod),
+            static_cast<uint64>(createInfo.borderColor),
+            static_cast<uint64>(createInfo.unnormalizedCoordinates)
+        };
+    }
+
+}
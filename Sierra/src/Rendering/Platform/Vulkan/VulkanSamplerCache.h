@@ -0,0 +1,45 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "VulkanDevice.h"
+
+namespace Sierra
+{
+
+    // Shares Vulkan samplers between samplers of identical state, as only a limited number of them (maxSamplerAllocationCount) may exist at once
+    class SIERRA_API VulkanSamplerCache final
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        explicit VulkanSamplerCache(const VulkanDevice &device);
+
+        /* --- POLLING METHODS --- */
+        // Returns the sampler created out of an identical create info, or creates a new one (named after the first sampler to request it) - samplers are destroyed once nothing references them
+        [[nodiscard]] std::shared_ptr<const VkSampler> GetSampler(const VkSamplerCreateInfo &createInfo, const std::string &name) const;
+
+        /* --- OPERATORS --- */
+        VulkanSamplerCache(const VulkanSamplerCache&) = delete;
+        VulkanSamplerCache& operator=(const VulkanSamplerCache&) = delete;
+
+        /* --- DESTRUCTOR --- */
+        ~VulkanSamplerCache() = default;
+
+    private:
+        const VulkanDevice &device;
+
+        struct CachedSampler
+        {
+            std::vector<uint64> description; // Compared on lookup, as different sampler states may share a hash
+            std::weak_ptr<const VkSampler> sampler;
+        };
+        mutable std::unordered_multimap<Hash, CachedSampler> samplers;
+        mutable std::mutex mutex;
+
+        [[nodiscard]] static std::vector<uint64> GetSamplerDescription(const VkSamplerCreateInfo &createInfo);
+
+    };
+
+}
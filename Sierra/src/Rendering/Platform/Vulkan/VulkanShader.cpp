@@ -12,15 +12,20 @@ namespace Sierra
     VulkanShader::VulkanShader(const VulkanDevice &device, const ShaderCreateInfo &createInfo)
         : Shader(createInfo), VulkanResource(createInfo.name), device(device)
     {
-        const std::filesystem::path shaderFilePath = createInfo.shaderBundlePath / "shader.spv";
-        SR_ERROR_IF(!File::FileExists(shaderFilePath), "[Vulkan]: Could not load SPIR-V shader from shader bundle [{0}]! Verify its presence and try again.", createInfo.shaderBundlePath.string().c_str());
-        auto shaderData = File::ReadFile(shaderFilePath);
+        // Embedded and archived code is used in place, while bundled code is mapped, so the driver reads it straight from the file's pages (a copy is only kept around if pipeline libraries need to compare it)
+        std::optional<MappedFile> mappedShaderFile = std::nullopt;
+        const ShaderMemory shaderMemory = createInfo.spirvMemory.data != nullptr ? createInfo.spirvMemory : LoadBundleFile(createInfo, "shader.spv", mappedShaderFile);
+        SR_ERROR_IF(shaderMemory.data == nullptr, "[Vulkan]: Could not load SPIR-V shader from shader bundle [{0}]! Verify its presence and try again.", createInfo.shaderBundlePath.string().c_str());
+
+        codeHash = std::hash<std::string_view>{}(std::string_view(static_cast<const char*>(shaderMemory.data), shaderMemory.memorySize));
+        if (device.GetPipelineLibraryCache() != nullptr) code = std::make_shared<const std::vector<uint32>>(static_cast<const uint32*>(shaderMemory.data), static_cast<const uint32*>(shaderMemory.data) + shaderMemory.memorySize / sizeof(uint32));
+        Reflect(static_cast<const uint32*>(shaderMemory.data), shaderMemory.memorySize / sizeof(uint32));
 
         // Set up module create info
         VkShaderModuleCreateInfo shaderModuleCreateInfo = { };
         shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        shaderModuleCreateInfo.codeSize = shaderData.size() * sizeof(char);
-        shaderModuleCreateInfo.pCode = reinterpret_cast<uint32*>(shaderData.data());
+        shaderModuleCreateInfo.codeSize = shaderMemory.memorySize;
+        shaderModuleCreateInfo.pCode = static_cast<const uint32*>(shaderMemory.data);
 
         // Create shader module
         const VkResult result = device.GetFunctionTable().vkCreateShaderModule(device.GetLogicalDevice(), &shaderModuleCreateInfo, nullptr, &shaderModule);
@@ -39,7 +44,35 @@ namespace Sierra
 
     /* --- CONVERSIONS --- */
 
-        VkShaderStageFlags VulkanShader::ShaderTypeToVkShaderStageFlags(const ShaderType shaderType)
+    VkSpecializationInfo VulkanShader::ShaderConstantsToVkSpecializationInfo(const std::initializer_list<ShaderConstant> &shaderConstants, std::vector<VkSpecializationMapEntry> &mapEntries, std::vector<uint32> &data)
+    {
+        mapEntries.resize(shaderConstants.size());
+        data.resize(shaderConstants.size());
+        for (uint32 i = 0; i < shaderConstants.size(); i++)
+        {
+            const ShaderConstant &shaderConstant = *(shaderConstants.begin() + i);
+            mapEntries[i].constantID = shaderConstant.constantID;
+            mapEntries[i].offset = i * sizeof(uint32);
+            mapEntries[i].size = sizeof(uint32);
+
+            switch (shaderConstant.type)
+            {
+                case ShaderConstantType::Bool:          { data[i] = shaderConstant.value.boolValue ? VK_TRUE : VK_FALSE; break; }
+                case ShaderConstantType::Int32:         { std::memcpy(&data[i], &shaderConstant.value.int32Value, sizeof(uint32)); break; }
+                case ShaderConstantType::UInt32:        { data[i] = shaderConstant.value.uint32Value; break; }
+                case ShaderConstantType::Float32:       { std::memcpy(&data[i], &shaderConstant.value.float32Value, sizeof(uint32)); break; }
+            }
+        }
+
+        VkSpecializationInfo specializationInfo = { };
+        specializationInfo.mapEntryCount = static_cast<uint32>(mapEntries.size());
+        specializationInfo.pMapEntries = mapEntries.data();
+        specializationInfo.dataSize = data.size() * sizeof(uint32);
+        specializationInfo.pData = data.data();
+        return specializationInfo;
+    }
+
+    VkShaderStageFlags VulkanShader::ShaderTypeToVkShaderStageFlags(const ShaderType shaderType)
     {
         switch (shaderType)
         {
@@ -52,4 +85,13 @@ namespace Sierra
         return VK_SHADER_STAGE_ALL;
     }
 
+    VkShaderStageFlags VulkanShader::ShaderStageToVkShaderStageFlags(const ShaderStage shaderStage)
+    {
+        VkShaderStageFlags shaderStageFlags = 0;
+        if (shaderStage & ShaderStage::Vertex)          shaderStageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
+        if (shaderStage & ShaderStage::Fragment)        shaderStageFlags |= VK_SHADER_STAGE_FRAGMENT_BIT;
+        if (shaderStage & ShaderStage::Compute)         shaderStageFlags |= VK_SHADER_STAGE_COMPUTE_BIT;
+        return shaderStageFlags;
+    }
+
 }
\ No newline at end of file
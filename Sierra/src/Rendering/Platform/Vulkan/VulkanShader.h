@@ -20,16 +20,23 @@ namespace Sierra
 
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline VkShaderModule GetVulkanShaderModule() const { return shaderModule; }
+        [[nodiscard]] inline Hash GetCodeHash() const { return codeHash; }
+        [[nodiscard]] inline const std::shared_ptr<const std::vector<uint32>>& GetCode() const { return code; }
 
         /* --- DESTRUCTOR --- */
         ~VulkanShader() override;
 
         /* --- CONVERSIONS --- */
+        // Every constant occupies 4 bytes of the data vector (booleans are written as VkBool32), and the returned info points into both vectors, so they must outlive it
+        [[nodiscard]] static VkSpecializationInfo ShaderConstantsToVkSpecializationInfo(const std::initializer_list<ShaderConstant> &shaderConstants, std::vector<VkSpecializationMapEntry> &mapEntries, std::vector<uint32> &data);
         [[nodiscard]] static VkShaderStageFlags ShaderTypeToVkShaderStageFlags(ShaderType shaderType);
+        [[nodiscard]] static VkShaderStageFlags ShaderStageToVkShaderStageFlags(ShaderStage shaderStage);
 
     private:
         const VulkanDevice &device;
         VkShaderModule shaderModule = VK_NULL_HANDLE;
+        Hash codeHash = 0;
+        std::shared_ptr<const std::vector<uint32>> code = nullptr; // Only copied if pipeline libraries are used, so they can tell apart different code of equal hashes
 
     };
 
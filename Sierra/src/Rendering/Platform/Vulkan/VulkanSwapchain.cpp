@@ -28,28 +28,43 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     VulkanSwapchain::VulkanSwapchain(const VulkanInstance &instance, const VulkanDevice &device, const SwapchainCreateInfo &createInfo)
-        : Swapchain(createInfo), VulkanResource(createInfo.name), instance(instance), device(device), window(createInfo.window), surface(NativeSurface::Create(instance, createInfo.window)), preferredPresentationMode(createInfo.preferredPresentationMode), preferredImageMemoryType(createInfo.preferredImageMemoryType)
+        : Swapchain(createInfo), VulkanResource(createInfo.name), instance(instance), device(device), window(createInfo.window), surface(NativeSurface::Create(instance, createInfo.window)), preferredPresentationMode(createInfo.preferredPresentationMode), preferredImageMemoryType(createInfo.preferredImageMemoryType), resizeDebounceDuration(static_cast<float64>(createInfo.resizeDebounceMilliseconds))
     {
         SR_ERROR_IF(!device.IsExtensionLoaded(VK_KHR_SWAPCHAIN_EXTENSION_NAME), "[Vulkan]: Cannot create swapchain [{0}], as the provided device [{1}] does not support the {2} extension!", GetName(), device.GetName(), VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+        SR_ERROR_IF(createInfo.maxQueuedFrameCount == 0, "[Vulkan]: Cannot create swapchain [{0}] with a max queued frame count of [0]!", GetName());
+
+        concurrentFrameCount = createInfo.maxQueuedFrameCount;
+        presentWaitSupported = device.IsExtensionLoaded(VK_KHR_PRESENT_WAIT_EXTENSION_NAME) && device.IsExtensionLoaded(VK_KHR_PRESENT_ID_EXTENSION_NAME);
 
         CreateSwapchain();
         CreateSynchronization();
+        lastFramebufferSize = window->GetFramebufferSize();
     }
 
     /* --- POLLING METHODS --- */
 
     void VulkanSwapchain::AcquireNextImage()
     {
-        // Acquire next image
-        VkResult result = device.GetFunctionTable().vkAcquireNextImageKHR(device.GetLogicalDevice(), swapchain, std::numeric_limits<uint64>::max(), isImageAcquiredSemaphores[currentFrame], VK_NULL_HANDLE, &currentImage);
+        // Limit how many frames can be queued ahead of presentation
+        device.WaitForSignalValue(framePresentSignalValues[currentFrame]);
+        DestroyRetiredSwapchains();
 
-        // Resize swapchain if needed
-        if (result == VK_ERROR_OUT_OF_DATE_KHR)
+        // Recreate a suboptimal swapchain only once the window has stopped being resized
+        if (recreationPending && TimePoint::Now() - lastFramebufferResizeTime >= resizeDebounceDuration)
         {
             Recreate();
-            AcquireNextImage();
         }
 
+        // Acquire next image, recreating swapchain if it can no longer be presented to
+        VkResult result = device.GetFunctionTable().vkAcquireNextImageKHR(device.GetLogicalDevice(), swapchain, std::numeric_limits<uint64>::max(), isImageAcquiredSemaphores[currentFrame], VK_NULL_HANDLE, &currentImage);
+        while (result == VK_ERROR_OUT_OF_DATE_KHR)
+        {
+            Recreate();
+            result = device.GetFunctionTable().vkAcquireNextImageKHR(device.GetLogicalDevice(), swapchain, std::numeric_limits<uint64>::max(), isImageAcquiredSemaphores[currentFrame], VK_NULL_HANDLE, &currentImage);
+        }
+        SR_ERROR_IF(result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR, "[Vulkan]: Could not acquire next image of swapchain [{0}]! Error code: {1}.", GetName(), result);
+        if (result == VK_SUBOPTIMAL_KHR) OnSwapchainSuboptimal();
+
         // Set up submit info
         const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
         VkSubmitInfo submitInfo = { };
@@ -89,7 +104,7 @@ namespace Sierra
         submitInfo.commandBufferCount = 0;
         submitInfo.pCommandBuffers = nullptr;
         submitInfo.signalSemaphoreCount = 1;
-        submitInfo.pSignalSemaphores = &isImagePresentedSemaphores[currentFrame];
+        submitInfo.pSignalSemaphores = &isImagePresentedSemaphores[currentImage];
         submitInfo.pNext = &semaphoreSubmitInfo;
 
         // Wait for timeline semaphore to signal, and signal the binary one as well, as VkPresentInfoKHR forbids passing timeline one to it
@@ -100,34 +115,54 @@ namespace Sierra
         VkPresentInfoKHR presentInfo = { };
         presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
         presentInfo.waitSemaphoreCount = 1;
-        presentInfo.pWaitSemaphores = &isImagePresentedSemaphores[currentFrame];
+        presentInfo.pWaitSemaphores = &isImagePresentedSemaphores[currentImage];
         presentInfo.swapchainCount = 1;
         presentInfo.pSwapchains = &swapchain;
         presentInfo.pImageIndices = &currentImage;
         presentInfo.pResults = nullptr;
 
+        // Tag present with an ID, so it can later be waited on
+        const uint64 presentID = lastPresentID + 1;
+        VkPresentIdKHR presentIDInfo = { };
+        presentIDInfo.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+        presentIDInfo.swapchainCount = 1;
+        presentIDInfo.pPresentIds = &presentID;
+        if (presentWaitSupported) presentInfo.pNext = &presentIDInfo;
+
         // Submit presentation queue and resize the swapchain if needed
         result = device.GetFunctionTable().vkQueuePresentKHR(presentationQueue, &presentInfo);
-        if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
-        {
-            Recreate();
-        }
+        lastPresentID = presentID;
+        lastPresentSignalValue = waitValue;
+        framePresentSignalValues[currentFrame] = waitValue;
+
+        if (result == VK_ERROR_OUT_OF_DATE_KHR) Recreate();
+        else if (result == VK_SUBOPTIMAL_KHR) OnSwapchainSuboptimal();
 
         // Increment currentFrame
         currentFrame = (currentFrame + 1) % concurrentFrameCount;
     }
 
+    bool VulkanSwapchain::WaitForPreviousPresent(const uint64 timeoutInNanoseconds) const
+    {
+        // Without present waits (or if the last present went to a since retired swapchain), the best that can be done is to wait for the frame to finish rendering
+        if (!presentWaitSupported || lastPresentID == 0) return device.WaitForSignalValue(lastPresentSignalValue, timeoutInNanoseconds);
+
+        const VkResult result = device.GetFunctionTable().vkWaitForPresentKHR(device.GetLogicalDevice(), swapchain, lastPresentID, timeoutInNanoseconds);
+        SR_ERROR_IF(result != VK_SUCCESS && result != VK_TIMEOUT && result != VK_SUBOPTIMAL_KHR && result != VK_ERROR_OUT_OF_DATE_KHR, "[Vulkan]: Could not wait for present [{0}] of swapchain [{1}]! Error code: {2}.", lastPresentID, GetName(), result);
+        return result != VK_TIMEOUT;
+    }
+
     /* --- DESTRUCTOR --- */
 
     VulkanSwapchain::~VulkanSwapchain()
     {
+        if (!retiredSwapchains.empty()) device.WaitForSignalValue(retiredSwapchains.back().signalValue);
+        DestroyRetiredSwapchains();
+
         device.GetFunctionTable().vkDestroySwapchainKHR(device.GetLogicalDevice(), swapchain, nullptr);
 
-        for (uint32 i = 0; i < concurrentFrameCount; i++)
-        {
-            device.GetFunctionTable().vkDestroySemaphore(device.GetLogicalDevice(), isImageAcquiredSemaphores[i], nullptr);
-            device.GetFunctionTable().vkDestroySemaphore(device.GetLogicalDevice(), isImagePresentedSemaphores[i], nullptr);
-        }
+        for (const VkSemaphore semaphore : isImageAcquiredSemaphores) device.GetFunctionTable().vkDestroySemaphore(device.GetLogicalDevice(), semaphore, nullptr);
+        for (const VkSemaphore semaphore : isImagePresentedSemaphores) device.GetFunctionTable().vkDestroySemaphore(device.GetLogicalDevice(), semaphore, nullptr);
 
         instance.GetFunctionTable().vkDestroySurfaceKHR(instance.GetVulkanInstance(), surface, nullptr);
     }
@@ -204,34 +239,18 @@ namespace Sierra
         instance.GetFunctionTable().vkGetPhysicalDeviceSurfacePresentModesKHR(device.GetPhysicalDevice(), surface, &supportedPresentModeCount, nullptr);
 
         std::vector<VkPresentModeKHR> supportedPresentModes(supportedPresentModeCount);
-        instance.GetFunctionTable().vkGetPhysicalDeviceSurfacePresentModesKHR(device.GetPhysicalDevice(), surface, &supportedFormatCount, supportedPresentModes.data());
+        instance.GetFunctionTable().vkGetPhysicalDeviceSurfacePresentModesKHR(device.GetPhysicalDevice(), surface, &supportedPresentModeCount, supportedPresentModes.data());
 
         // Select a present mode according to preferred one in create info
-        VkPresentModeKHR selectedPresentMode = VK_PRESENT_MODE_FIFO_KHR; // FIFO is guaranteed to be supported
-        for (const auto presentMode : supportedPresentModes)
-        {
-            if (preferredPresentationMode == SwapchainPresentationMode::Immediate && presentMode == VK_PRESENT_MODE_IMMEDIATE_KHR)   // Possible tearing, no GPU idling, minimal latency, and high energy consumption
-            {
-                selectedPresentMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
-                break;
-            }
-            #if !SR_PLATFORM_MOBILE
-                if (preferredPresentationMode == SwapchainPresentationMode::VSync && presentMode == VK_PRESENT_MODE_MAILBOX_KHR)     // VSync with no tearing, no GPU idling, low latency, and high energy consumption
-            #else
-                if (preferredPresentationMode == SwapchainPresentationMode::VSync && presentMode == VK_PRESENT_MODE_FIFO_KHR)        // VSync with no tearing, low GPU idling, moderate latency, minimal energy consuption
-            #endif
-            {
-                selectedPresentMode = VK_PRESENT_MODE_MAILBOX_KHR;
-                break;
-            }
-        }
+        presentMode = SelectPresentMode(supportedPresentModes);
 
         // Get surface capabilities
         VkSurfaceCapabilitiesKHR surfaceCapabilities = { };
         instance.GetFunctionTable().vkGetPhysicalDeviceSurfaceCapabilitiesKHR(device.GetPhysicalDevice(), surface, &surfaceCapabilities);
 
-        // Use at least 3 images per frame (for triple-buffering) if supported, otherwise the max allowed
-        const uint32 preferredConcurrentFrameCount = std::clamp(3U, surfaceCapabilities.minImageCount, std::max(surfaceCapabilities.minImageCount, surfaceCapabilities.maxImageCount));
+        // Have an image for each queued frame (and, in mailbox, an extra one, which can be replaced while another is on screen), within what the surface allows (a max of 0 means unlimited)
+        const uint32 preferredImageCount = presentMode == VK_PRESENT_MODE_MAILBOX_KHR ? std::max(concurrentFrameCount + 1, 3U) : std::max(concurrentFrameCount, 2U);
+        const uint32 imageCount = std::clamp(preferredImageCount, surfaceCapabilities.minImageCount, surfaceCapabilities.maxImageCount != 0 ? surfaceCapabilities.maxImageCount : std::numeric_limits<uint32>::max());
 
         // Set up swapchain creation info
         VkSwapchainCreateInfoKHR swapchainCreateInfo = { };
@@ -239,13 +258,13 @@ namespace Sierra
         swapchainCreateInfo.surface = surface;
         swapchainCreateInfo.imageFormat = selectedFormat.format;
         swapchainCreateInfo.imageColorSpace = selectedFormat.colorSpace;
-        swapchainCreateInfo.minImageCount = preferredConcurrentFrameCount;
+        swapchainCreateInfo.minImageCount = imageCount;
         swapchainCreateInfo.imageExtent.width = std::clamp(window->GetFramebufferSize().x, surfaceCapabilities.minImageExtent.width, surfaceCapabilities.maxImageExtent.width);
         swapchainCreateInfo.imageExtent.height = std::clamp(window->GetFramebufferSize().y, surfaceCapabilities.minImageExtent.height, surfaceCapabilities.maxImageExtent.height);
         swapchainCreateInfo.imageArrayLayers = 1;
         swapchainCreateInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
         swapchainCreateInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
-        swapchainCreateInfo.presentMode = selectedPresentMode;
+        swapchainCreateInfo.presentMode = presentMode;
         swapchainCreateInfo.clipped = VK_TRUE;
         swapchainCreateInfo.preTransform = surfaceCapabilities.currentTransform;
         swapchainCreateInfo.oldSwapchain = swapchain;
@@ -269,24 +288,25 @@ namespace Sierra
         // Set object name
         device.SetObjectName(swapchain, VK_OBJECT_TYPE_SWAPCHAIN_KHR, GetName());
 
-        // If an old swapchain was reused, destroy that
+        // If an old swapchain was handed off, keep it (and its images) alive until every command buffer submitted so far, which may still be using them, has finished
         if (swapchainCreateInfo.oldSwapchain != VK_NULL_HANDLE)
         {
-            device.GetFunctionTable().vkDestroySwapchainKHR(device.GetLogicalDevice(), swapchainCreateInfo.oldSwapchain, nullptr);
-            swapchainCreateInfo.oldSwapchain = VK_NULL_HANDLE;
+            retiredSwapchains.push_back({ .swapchain = swapchainCreateInfo.oldSwapchain, .images = std::move(swapchainImages), .isImagePresentedSemaphores = std::move(isImagePresentedSemaphores), .signalValue = device.GetLastSubmittedSignalValue() });
+            swapchainImages.clear();
+            isImagePresentedSemaphores.clear();
         }
 
-        // Get actual concurrent image count
-        concurrentFrameCount = 0;
-        device.GetFunctionTable().vkGetSwapchainImagesKHR(device.GetLogicalDevice(), swapchain, &concurrentFrameCount, nullptr);
+        // Get actual image count
+        uint32 swapchainImageCount = 0;
+        device.GetFunctionTable().vkGetSwapchainImagesKHR(device.GetLogicalDevice(), swapchain, &swapchainImageCount, nullptr);
 
         // Get swapchain images
-        std::vector<VkImage> vulkanSwapchainImages(concurrentFrameCount);
-        device.GetFunctionTable().vkGetSwapchainImagesKHR(device.GetLogicalDevice(), swapchain, &concurrentFrameCount, vulkanSwapchainImages.data());
+        std::vector<VkImage> vulkanSwapchainImages(swapchainImageCount);
+        device.GetFunctionTable().vkGetSwapchainImagesKHR(device.GetLogicalDevice(), swapchain, &swapchainImageCount, vulkanSwapchainImages.data());
 
         // Create image implementations
-        swapchainImages.resize(concurrentFrameCount);
-        for (uint32 i = 0; i < concurrentFrameCount; i++)
+        swapchainImages.resize(swapchainImageCount);
+        for (uint32 i = 0; i < swapchainImageCount; i++)
         {
             swapchainImages[i] = std::unique_ptr<VulkanImage>(new VulkanImage(device, VulkanImage::SwapchainImageCreateInfo {
                 .name = "Image " + std::to_string(i) + " of swapchain [" + GetName() + "]",
@@ -296,6 +316,18 @@ namespace Sierra
                 .format = swapchainCreateInfo.imageFormat
             }));
         }
+
+        // Create a presentation semaphore for every image, as one cannot be reused until the image it was presented with gets acquired again
+        VkSemaphoreCreateInfo semaphoreCreateInfo = { };
+        semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+        isImagePresentedSemaphores.resize(swapchainImageCount);
+        for (uint32 i = 0; i < swapchainImageCount; i++)
+        {
+            result = device.GetFunctionTable().vkCreateSemaphore(device.GetLogicalDevice(), &semaphoreCreateInfo, nullptr, &isImagePresentedSemaphores[i]);
+            SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create semaphore [{0}], indicating whether corresponding swapchain image of swapchain [{1}] is free for presenting!", i, GetName());
+            device.SetObjectName(isImagePresentedSemaphores[i], VK_OBJECT_TYPE_SEMAPHORE, "Image rendered semaphore [" + std::to_string(i) + "] of swapchain [" + GetName() + "]");
+        }
     }
 
     void VulkanSwapchain::CreateSynchronization()
@@ -311,7 +343,7 @@ namespace Sierra
 
         // Create sync objects
         isImageAcquiredSemaphores.resize(concurrentFrameCount);
-        isImagePresentedSemaphores.resize(concurrentFrameCount);
+        framePresentSignalValues.resize(concurrentFrameCount, 0);
 
         VkResult result;
         for (uint32 i = 0; i < concurrentFrameCount; i++)
@@ -319,10 +351,6 @@ namespace Sierra
             result = device.GetFunctionTable().vkCreateSemaphore(device.GetLogicalDevice(), &semaphoreCreateInfo, nullptr, &isImageAcquiredSemaphores[i]);
             SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create semaphore [{0}], indicating whether corresponding swapchain image of swapchain [{1}] is free for use!", i, GetName());
             device.SetObjectName(isImageAcquiredSemaphores[i], VK_OBJECT_TYPE_SEMAPHORE, "Image free semaphore [" + std::to_string(i) + "] of swapchain [" + GetName() + "]");
-
-            result = device.GetFunctionTable().vkCreateSemaphore(device.GetLogicalDevice(), &semaphoreCreateInfo, nullptr, &isImagePresentedSemaphores[i]);
-            SR_ERROR_IF(result != VK_SUCCESS, "[Vulkan]: Could not create semaphore [{0}], indicating whether corresponding swapchain image of swapchain [{1}] is free for presenting!", i, GetName());
-            device.SetObjectName(isImagePresentedSemaphores[i], VK_OBJECT_TYPE_SEMAPHORE, "Image rendered semaphore [" + std::to_string(i) + "] of swapchain [" + GetName() + "]");
         }
     }
 
@@ -333,13 +361,64 @@ namespace Sierra
             window->Update();
         }
 
-        device.GetFunctionTable().vkDeviceWaitIdle(device.GetLogicalDevice());
+        // Old swapchain is handed off to the new one and destroyed later, so there is no need to wait for the device to become idle
         const Vector2UInt lastSize = { swapchainImages[0]->GetWidth(), swapchainImages[0]->GetHeight() };
-
         CreateSwapchain();
-        const Vector2UInt newSize = { swapchainImages[0]->GetWidth(), swapchainImages[0]->GetHeight() };
+        recreationPending = false;
+
+        // Present IDs are per swapchain, so ones of the old swapchain must not be waited on with the new one
+        lastPresentID = 0;
+        lastFramebufferSize = window->GetFramebufferSize();
 
+        // Dependent resources (render passes, depth buffers, etc.) can be resized from here, and old ones queued for destruction via Device::QueueResourceForDestruction(), instead of waiting on the GPU
+        const Vector2UInt newSize = { swapchainImages[0]->GetWidth(), swapchainImages[0]->GetHeight() };
         if (lastSize != newSize) GetSwapchainResizeDispatcher().DispatchEvent(Vector2UInt(newSize));
     }
 
+    void VulkanSwapchain::OnSwapchainSuboptimal()
+    {
+        // Swapchain can still be presented to, so delay its recreation while the window keeps changing size
+        const Vector2UInt framebufferSize = window->GetFramebufferSize();
+        if (framebufferSize != lastFramebufferSize)
+        {
+            lastFramebufferSize = framebufferSize;
+            lastFramebufferResizeTime = TimePoint::Now();
+        }
+        recreationPending = true;
+    }
+
+    void VulkanSwapchain::DestroyRetiredSwapchains()
+    {
+        // Swapchains are retired in order of increasing signal values, so all finished ones are at the front
+        const uint64 completedSignalValue = device.GetCompletedSignalValue();
+        while (!retiredSwapchains.empty() && retiredSwapchains.front().signalValue <= completedSignalValue)
+        {
+            retiredSwapchains.front().images.clear();
+            for (const VkSemaphore semaphore : retiredSwapchains.front().isImagePresentedSemaphores) device.GetFunctionTable().vkDestroySemaphore(device.GetLogicalDevice(), semaphore, nullptr);
+            device.GetFunctionTable().vkDestroySwapchainKHR(device.GetLogicalDevice(), retiredSwapchains.front().swapchain, nullptr);
+            retiredSwapchains.pop_front();
+        }
+    }
+
+    VkPresentModeKHR VulkanSwapchain::SelectPresentMode(const std::vector<VkPresentModeKHR> &supportedPresentModes) const
+    {
+        // Try each mode in order of preference, falling back to FIFO, which is guaranteed to be supported
+        std::vector<VkPresentModeKHR> presentModesToTry;
+        switch (preferredPresentationMode)
+        {
+            case SwapchainPresentationMode::Immediate:      { presentModesToTry = { VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_MAILBOX_KHR }; break; }
+            case SwapchainPresentationMode::Mailbox:        { presentModesToTry = { VK_PRESENT_MODE_MAILBOX_KHR };                                break; }
+            case SwapchainPresentationMode::RelaxedVSync:   { presentModesToTry = { VK_PRESENT_MODE_FIFO_RELAXED_KHR };                           break; }
+            case SwapchainPresentationMode::VSync:
+            default:                                        break;
+        }
+
+        for (const VkPresentModeKHR presentModeToTry : presentModesToTry)
+        {
+            if (std::find(supportedPresentModes.begin(), supportedPresentModes.end(), presentModeToTry) != supportedPresentModes.end()) return presentModeToTry;
+        }
+
+        return VK_PRESENT_MODE_FIFO_KHR;
+    }
+
 }
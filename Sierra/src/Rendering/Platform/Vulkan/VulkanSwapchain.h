@@ -22,13 +22,14 @@ namespace Sierra
         /* --- POLLING METHODS --- */
         void AcquireNextImage() override;
         void Present(std::unique_ptr<CommandBuffer> &commandBuffer) override;
+        bool WaitForPreviousPresent(uint64 timeoutInNanoseconds = std::numeric_limits<uint64>::max()) const override;
 
         /* --- GETTER METHODS --- */
         [[nodiscard]] inline uint32 GetCurrentFrame() const override { return currentFrame; }
         [[nodiscard]] inline uint32 GetConcurrentFrameCount() const override { return concurrentFrameCount; }
 
         [[nodiscard]] inline const std::unique_ptr<Image>& GetCurrentImage() const override { return swapchainImages[currentImage]; }
-        [[nodiscard]] inline const std::unique_ptr<Image>& GetImage(const uint32 frameIndex) const override { SR_ERROR_IF(frameIndex >= concurrentFrameCount, "[Vulkan]: Cannot return image with an index [{0}] of swapchain [{1}], as index is out of bounds! Use Swapchain::GetConcurrentFrameCount() to query image count.", frameIndex, GetName()); return swapchainImages[frameIndex]; }
+        [[nodiscard]] inline const std::unique_ptr<Image>& GetImage(const uint32 frameIndex) const override { SR_ERROR_IF(frameIndex >= swapchainImages.size(), "[Vulkan]: Cannot return image with an index [{0}] of swapchain [{1}], as index is out of bounds!", frameIndex, GetName()); return swapchainImages[frameIndex]; }
 
         /* --- DESTRUCTOR --- */
         ~VulkanSwapchain() override;
@@ -43,20 +44,44 @@ namespace Sierra
 
         SwapchainPresentationMode preferredPresentationMode = SwapchainPresentationMode::Immediate;
         SwapchainImageMemoryType preferredImageMemoryType = SwapchainImageMemoryType::UNorm8;
+        VkPresentModeKHR presentMode = VK_PRESENT_MODE_FIFO_KHR;
 
         VkSwapchainKHR swapchain = VK_NULL_HANDLE;
         std::vector<std::unique_ptr<Image>> swapchainImages;
 
         std::vector<VkSemaphore> isImageAcquiredSemaphores;
-        std::vector<VkSemaphore> isImagePresentedSemaphores;
+        std::vector<VkSemaphore> isImagePresentedSemaphores; // One per swapchain image
+        std::vector<uint64> framePresentSignalValues;
 
-        uint32 concurrentFrameCount = 0;
+        bool presentWaitSupported = false;
+        uint64 lastPresentID = 0;
+        uint64 lastPresentSignalValue = 0;
+
+        uint32 concurrentFrameCount = 0; // Maximum number of queued frames (swapchain may own more images)
         uint32 currentFrame = 0; // On the CPU
         uint32 currentImage = 0; // On the GPU
 
+        TimeStep resizeDebounceDuration;
+        bool recreationPending = false;
+        Vector2UInt lastFramebufferSize = { 0, 0 };
+        TimePoint lastFramebufferResizeTime = TimePoint::Now();
+
+        struct RetiredSwapchain
+        {
+            VkSwapchainKHR swapchain = VK_NULL_HANDLE;
+            std::vector<std::unique_ptr<Image>> images;
+            std::vector<VkSemaphore> isImagePresentedSemaphores;
+            uint64 signalValue = 0;
+        };
+        std::deque<RetiredSwapchain> retiredSwapchains;
+
         void CreateSwapchain();
         void CreateSynchronization();
         void Recreate();
+        void OnSwapchainSuboptimal();
+        void DestroyRetiredSwapchains();
+
+        [[nodiscard]] VkPresentModeKHR SelectPresentMode(const std::vector<VkPresentModeKHR> &supportedPresentModes) const;
 
     };
 
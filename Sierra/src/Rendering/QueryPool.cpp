@@ -0,0 +1,35 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "QueryPool.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    QueryPool::QueryPool(const QueryPoolCreateInfo &createInfo)
+        : type(createInfo.type), queryCount(createInfo.queryCount)
+    {
+        SR_ERROR_IF(createInfo.queryCount == 0, "Query count of query pool [{0}] must not be [0]!", createInfo.name);
+    }
+
+    /* --- GETTER METHODS --- */
+
+    bool QueryPool::GetPipelineStatisticsResults(const uint32 firstQuery, const uint32 queryCount, std::vector<QueryPipelineStatistics> &results) const
+    {
+        SR_ERROR_IF(type != QueryType::PipelineStatistics, "Cannot get pipeline statistics results from query pool [{0}], as it was not created with [QueryType::PipelineStatistics]!", GetName());
+
+        std::vector<uint64> values;
+        if (!GetResults(firstQuery, queryCount, values)) return false;
+
+        // Size results from the values read, as a query count of [0] stands for all queries past the first one
+        results.resize(values.size() / PIPELINE_STATISTIC_COUNT);
+        if (results.empty()) return true;
+
+        std::memcpy(results.data(), values.data(), results.size() * sizeof(QueryPipelineStatistics));
+        return true;
+    }
+
+}
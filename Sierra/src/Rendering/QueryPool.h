@@ -0,0 +1,67 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "RenderingResource.h"
+
+namespace Sierra
+{
+
+    enum class QueryType : uint8
+    {
+        Occlusion,
+        PipelineStatistics,
+        Timestamp
+    };
+
+    struct QueryPipelineStatistics
+    {
+        uint64 inputAssemblyVertexCount = 0;
+        uint64 inputAssemblyPrimitiveCount = 0;
+        uint64 vertexShaderInvocationCount = 0;
+        uint64 clippingInvocationCount = 0;
+        uint64 clippingPrimitiveCount = 0;
+        uint64 fragmentShaderInvocationCount = 0;
+        uint64 computeShaderInvocationCount = 0;
+    };
+
+    struct QueryPoolCreateInfo
+    {
+        const std::string &name = "Query Pool";
+        QueryType type = QueryType::Occlusion;
+        uint32 queryCount = 1;
+    };
+
+    class SIERRA_API QueryPool : public virtual RenderingResource
+    {
+    public:
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] inline QueryType GetType() const { return type; }
+        [[nodiscard]] inline uint32 GetQueryCount() const { return queryCount; }
+
+        // Copies the results of the given queries without waiting, returning false if any of them is not yet available - occlusion queries yield a non-zero value if any sample passed, and timestamps are in nanoseconds
+        [[nodiscard]] virtual bool GetResults(uint32 firstQuery, uint32 queryCount, std::vector<uint64> &results) const = 0;
+        [[nodiscard]] bool GetPipelineStatisticsResults(uint32 firstQuery, uint32 queryCount, std::vector<QueryPipelineStatistics> &results) const;
+
+        /* --- OPERATORS --- */
+        QueryPool(const QueryPool&) = delete;
+        QueryPool &operator=(const QueryPool&) = delete;
+
+        /* --- DESTRUCTOR --- */
+        virtual ~QueryPool() = default;
+
+        /* --- CONSTANTS --- */
+        constexpr static uint32 PIPELINE_STATISTIC_COUNT = sizeof(QueryPipelineStatistics) / sizeof(uint64);
+
+    protected:
+        explicit QueryPool(const QueryPoolCreateInfo &createInfo);
+
+    private:
+        QueryType type = QueryType::Occlusion;
+        uint32 queryCount = 0;
+
+    };
+
+}
@@ -21,6 +21,8 @@ namespace Sierra
                 for (const auto renderTargetIndex : (createInfo.subpassDescriptions.begin() + i)->renderTargets)
                 {
                     const RenderPassAttachment &attachment = *(createInfo.attachments.begin() + renderTargetIndex);
+                    SR_ERROR_IF(attachment.templateImage->GetUsage() & ImageUsage::TransientAttachment && attachment.loadOperation == RenderPassAttachmentLoadOperation::Load, "Could not create render pass [{0}], as attachment [{1}] uses a transient image, whose contents cannot be loaded! Use either RenderPassAttachmentLoadOperation::Clear or RenderPassAttachmentLoadOperation::DontCare instead.", createInfo.name, renderTargetIndex);
+                    SR_ERROR_IF(attachment.templateImage->GetUsage() & ImageUsage::TransientAttachment && !attachment.resolveImage.has_value() && attachment.storeOperation == RenderPassAttachmentStoreOperation::Store, "Could not create render pass [{0}], as attachment [{1}] uses a transient image, whose contents cannot be stored! Use RenderPassAttachmentStoreOperation::Discard, or resolve it to a non-transient image.", createInfo.name, renderTargetIndex);
                     SR_ERROR_IF(attachment.templateImage->GetWidth() != expectedWidth || attachment.templateImage->GetHeight() != expectedHeight, "Could not create render pass [{0}], because not all attachments share the same dimensions, and they must!", createInfo.name);
 
                     const SubpassDescription &subpassDescription = *(createInfo.subpassDescriptions.begin() + i);
@@ -11,16 +11,17 @@
 namespace Sierra
 {
 
-    enum class RenderPassAttachmentLoadOperation : bool
+    enum class RenderPassAttachmentLoadOperation : uint8
     {
         Clear,
-        Load
+        Load,
+        DontCare // Previous contents are undefined, which is cheaper than clearing, when every pixel gets overwritten anyway
     };
 
     enum class RenderPassAttachmentStoreOperation : bool
     {
         Store,
-        Discard
+        Discard // Contents are left undefined after the pass (a.k.a. "don't care"), so they need not be written back to memory
     };
 
     enum class RenderPassAttachmentType : bool
@@ -17,6 +17,7 @@ namespace Sierra
     /* --- CONSTRUCTORS --- */
 
     RenderingContext::RenderingContext(const RenderingContextCreateInfo &createInfo)
+        : headless(createInfo.headless)
     {
 
     }
@@ -63,4 +64,11 @@ namespace Sierra
         }
     }
 
+    /* --- POLLING METHODS --- */
+
+    std::unique_ptr<Swapchain> RenderingContext::CreateOffscreenSwapchain(const OffscreenSwapchainCreateInfo &createInfo) const
+    {
+        return std::make_unique<OffscreenSwapchain>(*this, createInfo);
+    }
+
 }
\ No newline at end of file
@@ -10,8 +10,10 @@
 #include "Buffer.h"
 #include "Image.h"
 #include "Sampler.h"
+#include "QueryPool.h"
 #include "RenderPass.h"
 #include "Swapchain.h"
+#include "OffscreenSwapchain.h"
 #include "Shader.h"
 #include "PipelineLayout.h"
 #include "GraphicsPipeline.h"
@@ -25,6 +27,7 @@ namespace Sierra
     {
         const std::string &name = "Rendering Context";
         GraphicsAPI graphicsAPI = GraphicsAPI::Auto;
+        bool headless = false;
     };
 
     class SIERRA_API RenderingContext : public virtual RenderingResource
@@ -41,9 +44,12 @@ namespace Sierra
         [[nodiscard]] virtual std::unique_ptr<GraphicsPipeline> CreateGraphicsPipeline(const GraphicsPipelineCreateInfo &createInfo) const = 0;
         [[nodiscard]] virtual std::unique_ptr<ComputePipeline> CreateComputePipeline(const ComputePipelineCreateInfo &createInfo) const = 0;
         [[nodiscard]] virtual std::unique_ptr<CommandBuffer> CreateCommandBuffer(const CommandBufferCreateInfo &createInfo) const = 0;
+        [[nodiscard]] virtual std::unique_ptr<QueryPool> CreateQueryPool(const QueryPoolCreateInfo &createInfo) const = 0;
+        [[nodiscard]] std::unique_ptr<Swapchain> CreateOffscreenSwapchain(const OffscreenSwapchainCreateInfo &createInfo) const;
 
         /* --- GETTER METHODS --- */
         [[nodiscard]] virtual const Device& GetDevice() const = 0;
+        [[nodiscard]] inline bool IsHeadless() const { return headless; }
 
         /* --- OPERATORS --- */
         RenderingContext(const RenderingContext&) = delete;
@@ -56,6 +62,8 @@ namespace Sierra
         explicit RenderingContext(const RenderingContextCreateInfo &createInfo);
 
     private:
+        bool headless = false;
+
         friend class Application;
         static std::unique_ptr<RenderingContext> Create(const RenderingContextCreateInfo &createInfo);
 
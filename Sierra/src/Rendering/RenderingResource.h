@@ -41,6 +41,9 @@ namespace Sierra
         #endif
         [[nodiscard]] inline virtual GraphicsAPI GetAPI() const = 0;
 
+        /* --- DESTRUCTOR --- */
+        virtual ~RenderingResource() = default;
+
     protected:
         #if SR_ENABLE_LOGGING
             std::string name;
@@ -4,15 +4,346 @@
 
 #include "Shader.h"
 
+#include "PipelineLayout.h"
+
 namespace Sierra
 {
 
     /* --- CONSTRUCTORS --- */
 
     Shader::Shader(const ShaderCreateInfo &createInfo)
+        : shaderType(createInfo.shaderType)
     {
         SR_ERROR_IF(createInfo.shaderType == ShaderType::Undefined, "Shader type of shader [{0}] must not be ShaderType::Undefined!", createInfo.name);
-        SR_ERROR_IF(!File::DirectoryExists(createInfo.shaderBundlePath), "Could not load shaders from bundle [{0}], as it does not exist!", createInfo.shaderBundlePath.string().c_str());
+        SR_ERROR_IF(createInfo.shaderBundlePath.empty() && createInfo.spirvMemory.data == nullptr && createInfo.metalLibraryMemory.data == nullptr, "Cannot create shader [{0}], as neither a shader bundle path, nor shader memory has been specified!", createInfo.name);
+        SR_ERROR_IF(createInfo.shaderArchive == nullptr && !createInfo.shaderBundlePath.empty() && !File::DirectoryExists(createInfo.shaderBundlePath), "Could not load shaders from bundle [{0}], as it does not exist!", createInfo.shaderBundlePath.string().c_str());
+        SR_ERROR_IF(createInfo.spirvMemory.data != nullptr && (reinterpret_cast<uintptr_t>(createInfo.spirvMemory.data) % sizeof(uint32) != 0 || createInfo.spirvMemory.memorySize % sizeof(uint32) != 0), "Cannot create shader [{0}], as its SPIR-V memory must be aligned to, and have a size, which is a multiple of [4] bytes!", createInfo.name);
+    }
+
+    /* --- GETTER METHODS --- */
+
+    ShaderStage Shader::GetShaderStage() const
+    {
+        switch (shaderType)
+        {
+            case ShaderType::Vertex:        return ShaderStage::Vertex;
+            case ShaderType::Fragment:      return ShaderStage::Fragment;
+            case ShaderType::Compute:       return ShaderStage::Compute;
+            default:                        break;
+        }
+
+        return ShaderStage::None;
+    }
+
+    /* --- PROTECTED METHODS --- */
+
+    ShaderMemory Shader::LoadBundleFile(const ShaderCreateInfo &createInfo, const std::string_view fileName, std::optional<MappedFile> &mappedFile)
+    {
+        if (createInfo.shaderBundlePath.empty()) return { };
+        if (createInfo.shaderArchive != nullptr) return createInfo.shaderArchive->GetFileMemory(createInfo.shaderBundlePath.generic_string(), fileName);
+
+        const std::filesystem::path filePath = createInfo.shaderBundlePath / fileName;
+        if (!File::FileExists(filePath)) return { };
+
+        mappedFile.emplace(filePath);
+        return { .data = mappedFile->GetData(), .memorySize = mappedFile->GetMemorySize() };
+    }
+
+    void Shader::Reflect(const uint32* spirvData, const uint64 wordCount)
+    {
+        // Opcodes and enumerants, as defined by the SPIR-V specification
+        constexpr uint32 SPIRV_MAGIC_NUMBER = 0x07230203;
+        constexpr uint32 SPIRV_HEADER_WORD_COUNT = 5;
+        constexpr uint32 SPIRV_MAX_ID_BOUND = 4194303; // Universal limit on the result ID bound
+
+        constexpr uint16 OP_TYPE_INT = 21;
+        constexpr uint16 OP_TYPE_FLOAT = 22;
+        constexpr uint16 OP_TYPE_VECTOR = 23;
+        constexpr uint16 OP_TYPE_MATRIX = 24;
+        constexpr uint16 OP_TYPE_IMAGE = 25;
+        constexpr uint16 OP_TYPE_SAMPLED_IMAGE = 27;
+        constexpr uint16 OP_TYPE_ARRAY = 28;
+        constexpr uint16 OP_TYPE_RUNTIME_ARRAY = 29;
+        constexpr uint16 OP_TYPE_STRUCT = 30;
+        constexpr uint16 OP_TYPE_POINTER = 32;
+        constexpr uint16 OP_CONSTANT = 43;
+        constexpr uint16 OP_SPEC_CONSTANT = 50;
+        constexpr uint16 OP_VARIABLE = 59;
+        constexpr uint16 OP_DECORATE = 71;
+        constexpr uint16 OP_MEMBER_DECORATE = 72;
+
+        constexpr uint32 DECORATION_BUFFER_BLOCK = 3;
+        constexpr uint32 DECORATION_ARRAY_STRIDE = 6;
+        constexpr uint32 DECORATION_MATRIX_STRIDE = 7;
+        constexpr uint32 DECORATION_BINDING = 33;
+        constexpr uint32 DECORATION_DESCRIPTOR_SET = 34;
+        constexpr uint32 DECORATION_OFFSET = 35;
+
+        constexpr uint32 STORAGE_CLASS_UNIFORM_CONSTANT = 0;
+        constexpr uint32 STORAGE_CLASS_UNIFORM = 2;
+        constexpr uint32 STORAGE_CLASS_PUSH_CONSTANT = 9;
+        constexpr uint32 STORAGE_CLASS_STORAGE_BUFFER = 12;
+
+        constexpr uint32 IMAGE_DIMENSION_SUBPASS_DATA = 6;
+
+        // SPIR-V may be stale, truncated or come from anywhere, so it is validated as it is read, regardless of whether logging is enabled
+        if (wordCount < SPIRV_HEADER_WORD_COUNT || spirvData[0] != SPIRV_MAGIC_NUMBER || spirvData[3] > SPIRV_MAX_ID_BOUND)
+        {
+            SR_ERROR("Cannot reflect shader [{0}], as its SPIR-V is not valid!", GetName());
+            return;
+        }
+
+        // Every ID is described by at most one type-declaring instruction, so they are indexed by result ID (bound is stored within the header)
+        struct SPIRVID
+        {
+            uint16 opcode = 0;
+            const uint32* operands = nullptr;
+            uint16 operandCount = 0;
+
+            std::optional<uint32> binding = std::nullopt;
+            uint32 descriptorSet = 0;
+            uint32 arrayStride = 0;
+            bool bufferBlock = false;
+            std::vector<uint32> memberOffsets;
+            std::vector<uint32> memberMatrixStrides;
+        };
+        std::vector<SPIRVID> ids(spirvData[3]);
+        std::vector<uint32> variables;
+
+        // Types may only reference ones declared before them, which also rules out cycles when their sizes are later computed
+        const auto IsDeclared = [&ids](const uint32 id) -> bool { return id < ids.size() && ids[id].opcode != 0; };
+        const auto IsConstant = [&ids](const uint32 id) -> bool { return id < ids.size() && (ids[id].opcode == OP_CONSTANT || ids[id].opcode == OP_SPEC_CONSTANT); };
+
+        // Collect declarations and decorations
+        for (uint64 i = SPIRV_HEADER_WORD_COUNT; i < wordCount;)
+        {
+            const uint16 opcode = spirvData[i] & 0xFFFF;
+            const uint16 instructionWordCount = spirvData[i] >> 16;
+            if (instructionWordCount == 0 || i + instructionWordCount > wordCount)
+            {
+                SR_ERROR("Cannot reflect shader [{0}], as its SPIR-V is not valid!", GetName());
+                return;
+            }
+            const uint32* operands = spirvData + i + 1;
+            const uint16 operandCount = instructionWordCount - 1;
+
+            bool valid = true;
+            switch (opcode)
+            {
+                case OP_DECORATE:
+                {
+                    valid = operandCount >= 2 && operands[0] < ids.size();
+                    if (!valid) break;
+
+                    SPIRVID &target = ids[operands[0]];
+                    switch (operands[1])
+                    {
+                        case DECORATION_BINDING:            { valid = operandCount >= 3; if (valid) target.binding = operands[2]; break; }
+                        case DECORATION_DESCRIPTOR_SET:     { valid = operandCount >= 3; if (valid) target.descriptorSet = operands[2]; break; }
+                        case DECORATION_ARRAY_STRIDE:       { valid = operandCount >= 3; if (valid) target.arrayStride = operands[2]; break; }
+                        case DECORATION_BUFFER_BLOCK:       { target.bufferBlock = true; break; }
+                        default:                            break;
+                    }
+                    break;
+                }
+                case OP_MEMBER_DECORATE:
+                {
+                    // A struct takes up a word per member, so member indices cannot exceed the word count
+                    valid = operandCount >= 3 && operands[0] < ids.size() && operands[1] < wordCount;
+                    if (!valid) break;
+
+                    SPIRVID &target = ids[operands[0]];
+                    const uint32 member = operands[1];
+                    if (operands[2] == DECORATION_OFFSET)
+                    {
+                        valid = operandCount >= 4;
+                        if (!valid) break;
+
+                        if (target.memberOffsets.size() <= member) target.memberOffsets.resize(member + 1, 0);
+                        target.memberOffsets[member] = operands[3];
+                    }
+                    else if (operands[2] == DECORATION_MATRIX_STRIDE)
+                    {
+                        valid = operandCount >= 4;
+                        if (!valid) break;
+
+                        if (target.memberMatrixStrides.size() <= member) target.memberMatrixStrides.resize(member + 1, 0);
+                        target.memberMatrixStrides[member] = operands[3];
+                    }
+                    break;
+                }
+                case OP_TYPE_INT:
+                case OP_TYPE_FLOAT:
+                case OP_TYPE_VECTOR:
+                case OP_TYPE_MATRIX:
+                case OP_TYPE_IMAGE:
+                case OP_TYPE_SAMPLED_IMAGE:
+                case OP_TYPE_ARRAY:
+                case OP_TYPE_RUNTIME_ARRAY:
+                case OP_TYPE_STRUCT:
+                case OP_TYPE_POINTER:
+                {
+                    valid = operandCount >= 1 && operands[0] < ids.size() && ids[operands[0]].opcode == 0;
+                    if (!valid) break;
+
+                    SPIRVID &id = ids[operands[0]];
+                    id.opcode = opcode;
+                    id.operands = operands + 1;
+                    id.operandCount = operandCount - 1;
+
+                    // Make sure every operand, which is later read, is present, and referenced types are declared (pointed-to types may be forward declared, so they are checked when resolved)
+                    switch (opcode)
+                    {
+                        case OP_TYPE_INT:
+                        case OP_TYPE_FLOAT:                 { valid = id.operandCount >= 1; break; }
+                        case OP_TYPE_VECTOR:
+                        case OP_TYPE_MATRIX:                { valid = id.operandCount >= 2 && IsDeclared(id.operands[0]); break; }
+                        case OP_TYPE_IMAGE:                 { valid = id.operandCount >= 7; break; }
+                        case OP_TYPE_SAMPLED_IMAGE:
+                        case OP_TYPE_RUNTIME_ARRAY:         { valid = id.operandCount >= 1 && IsDeclared(id.operands[0]); break; }
+                        case OP_TYPE_POINTER:               { valid = id.operandCount >= 2; break; }
+                        case OP_TYPE_STRUCT:
+                        {
+                            for (uint32 member = 0; member < id.operandCount && valid; member++) valid = IsDeclared(id.operands[member]);
+                            break;
+                        }
+                        case OP_TYPE_ARRAY:
+                        {
+                            valid = id.operandCount >= 2 && IsDeclared(id.operands[0]);
+                            if (valid && !IsConstant(id.operands[1]))
+                            {
+                                // Lengths, derived from specialization constant operations, cannot be evaluated without specializing the shader
+                                SR_ERROR("Cannot reflect shader [{0}], as it declares an array, whose length is neither a constant, nor a specialization constant!", GetName());
+                                return;
+                            }
+                            break;
+                        }
+                        default:                            break;
+                    }
+                    break;
+                }
+                case OP_CONSTANT:
+                case OP_SPEC_CONSTANT: // Arrays, sized by a specialization constant, are reflected with its default value, so specializing it to a larger one is not supported
+                case OP_VARIABLE:
+                {
+                    valid = operandCount >= 3 && operands[1] < ids.size() && ids[operands[1]].opcode == 0;
+                    if (!valid) break;
+
+                    // Variables are always declared through a pointer
+                    valid = opcode != OP_VARIABLE || (IsDeclared(operands[0]) && ids[operands[0]].opcode == OP_TYPE_POINTER);
+                    if (!valid) break;
+
+                    SPIRVID &id = ids[operands[1]];
+                    id.opcode = opcode;
+                    id.operands = operands;
+                    id.operandCount = operandCount;
+                    if (opcode == OP_VARIABLE) variables.push_back(operands[1]);
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+
+            if (!valid)
+            {
+                SR_ERROR("Cannot reflect shader [{0}], as its SPIR-V is not valid!", GetName());
+                return;
+            }
+
+            i += instructionWordCount;
+        }
+
+        // Computes the byte size of a type within an explicitly laid out block (matrix stride, if any, comes from the member, which holds the matrix)
+        const std::function<uint32(uint32, uint32)> GetTypeMemorySize = [&ids, &GetTypeMemorySize](const uint32 typeID, const uint32 matrixStride) -> uint32
+        {
+            const SPIRVID &type = ids[typeID];
+            switch (type.opcode)
+            {
+                case OP_TYPE_INT:
+                case OP_TYPE_FLOAT:         return type.operands[0] / 8;
+                case OP_TYPE_VECTOR:        return GetTypeMemorySize(type.operands[0], 0) * type.operands[1];
+                case OP_TYPE_MATRIX:        return (matrixStride != 0 ? matrixStride : GetTypeMemorySize(type.operands[0], 0)) * type.operands[1];
+                case OP_TYPE_ARRAY:         return type.arrayStride * ids[type.operands[1]].operands[2];
+                case OP_TYPE_STRUCT:
+                {
+                    uint32 memorySize = 0;
+                    for (uint32 i = 0; i < type.operandCount; i++)
+                    {
+                        const uint32 memberOffset = i < type.memberOffsets.size() ? type.memberOffsets[i] : 0;
+                        const uint32 memberMatrixStride = i < type.memberMatrixStrides.size() ? type.memberMatrixStrides[i] : 0;
+                        memorySize = std::max(memorySize, memberOffset + GetTypeMemorySize(type.operands[i], memberMatrixStride));
+                    }
+                    return memorySize;
+                }
+                default:                    break;
+            }
+
+            return 0;
+        };
+
+        // Resolve resources
+        for (const uint32 variableID : variables)
+        {
+            const SPIRVID &variable = ids[variableID];
+            const uint32 storageClass = variable.operands[2];
+
+            // Resolve pointed-to type (variables are always declared through a pointer)
+            uint32 typeID = ids[variable.operands[0]].operands[1];
+            if (!IsDeclared(typeID))
+            {
+                SR_ERROR("Cannot reflect shader [{0}], as its SPIR-V is not valid!", GetName());
+                bindings.clear();
+                pushConstantSize = 0;
+                return;
+            }
+
+            if (storageClass == STORAGE_CLASS_PUSH_CONSTANT)
+            {
+                const uint32 memorySize = GetTypeMemorySize(typeID, 0);
+                pushConstantSize = static_cast<uint16>(std::max<uint32>(pushConstantSize, (memorySize + 3) & ~3U));
+                continue;
+            }
+            if (storageClass != STORAGE_CLASS_UNIFORM_CONSTANT && storageClass != STORAGE_CLASS_UNIFORM && storageClass != STORAGE_CLASS_STORAGE_BUFFER) continue;
+            if (!variable.binding.has_value()) continue;
+
+            SR_ERROR_IF(variable.descriptorSet != 0, "Cannot reflect shader [{0}], as binding [{1}] is within descriptor set [{2}], while only set [0] is supported!", GetName(), variable.binding.value(), variable.descriptorSet);
+
+            // Unwrap arrays
+            uint32 arraySize = 1;
+            if (ids[typeID].opcode == OP_TYPE_ARRAY)
+            {
+                arraySize = ids[ids[typeID].operands[1]].operands[2];
+                typeID = ids[typeID].operands[0];
+            }
+            SR_ERROR_IF(ids[typeID].opcode == OP_TYPE_RUNTIME_ARRAY, "Cannot reflect shader [{0}], as binding [{1}] is a runtime-sized array, which is not supported!", GetName(), variable.binding.value());
+
+            // Determine binding type
+            const SPIRVID &type = ids[typeID];
+            PipelineBindingType bindingType = PipelineBindingType::Undefined;
+            switch (storageClass)
+            {
+                case STORAGE_CLASS_UNIFORM:             { bindingType = type.bufferBlock ? PipelineBindingType::StorageBuffer : PipelineBindingType::UniformBuffer; break; }
+                case STORAGE_CLASS_STORAGE_BUFFER:      { bindingType = PipelineBindingType::StorageBuffer; break; }
+                case STORAGE_CLASS_UNIFORM_CONSTANT:
+                {
+                    if (type.opcode == OP_TYPE_SAMPLED_IMAGE) bindingType = PipelineBindingType::Texture;
+                    else if (type.opcode == OP_TYPE_IMAGE && type.operands[1] == IMAGE_DIMENSION_SUBPASS_DATA) bindingType = PipelineBindingType::InputAttachment;
+                    else if (type.opcode == OP_TYPE_IMAGE && type.operands[5] == 2) bindingType = PipelineBindingType::Image;
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+            SR_ERROR_IF(bindingType == PipelineBindingType::Undefined, "Cannot reflect shader [{0}], as binding [{1}] is of a resource type, which is not supported! Note that separate samplers and sampled images are not supported, and combined image samplers should be used instead.", GetName(), variable.binding.value());
+
+            bindings.push_back({ .binding = variable.binding.value(), .type = bindingType, .arraySize = arraySize });
+        }
+
+        std::sort(bindings.begin(), bindings.end(), [](const ShaderBinding &lhs, const ShaderBinding &rhs) { return lhs.binding < rhs.binding; });
     }
 
 }
@@ -6,7 +6,7 @@
 
 #include "RenderingResource.h"
 
-#include "../Utilities/File.h"
+#include "ShaderArchive.h"
 
 namespace Sierra
 {
@@ -19,16 +19,70 @@ namespace Sierra
         Compute
     };
 
+    enum class ShaderConstantType : uint8
+    {
+        Bool,
+        Int32,
+        UInt32,
+        Float32
+    };
+
+    union ShaderConstantValue
+    {
+        bool boolValue;
+        int32 int32Value;
+        uint32 uint32Value;
+        float32 float32Value;
+    };
+
+    enum class ShaderStage : uint8
+    {
+        None        = 0x0000,
+        Vertex      = 0x0001,
+        Fragment    = 0x0002,
+        Compute     = 0x0004,
+        All         = Vertex | Fragment | Compute
+    };
+    SR_DEFINE_ENUM_FLAG_OPERATORS(ShaderStage);
+
+    enum class PipelineBindingType : uint8;
+
+    // Resource, which a shader's SPIR-V was found to access (descriptor set 0 only, as pipeline layouts hold a single set)
+    struct ShaderBinding
+    {
+        uint32 binding = 0;
+        PipelineBindingType type;
+        uint32 arraySize = 1;
+    };
+
+    // Overrides a specialization constant (Vulkan) or function constant (Metal) when creating a pipeline, letting the driver fold it into the generated code
+    struct ShaderConstant
+    {
+        uint32 constantID = 0; // Must match the constant_id layout qualifier within the shader
+        ShaderConstantType type = ShaderConstantType::UInt32;
+        ShaderConstantValue value = { .uint32Value = 0 };
+    };
+
     struct ShaderCreateInfo
     {
         const std::string &name = "Shader";
-        const std::filesystem::path &shaderBundlePath;
+        const std::filesystem::path &shaderBundlePath = { }; // Only loaded from if no memory for the used API is specified (when a shader archive is used, this is the bundle's name within it)
         ShaderType shaderType = ShaderType::Undefined;
+        ShaderMemory spirvMemory = { }; // Must be aligned to 4 bytes - used by Vulkan, and for reflection on all APIs
+        ShaderMemory metalLibraryMemory = { }; // Must be compiled for the platform the application is running on
+        const ShaderArchive* shaderArchive = nullptr;
     };
 
     class SIERRA_API Shader : public virtual RenderingResource
     {
     public:
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] inline ShaderType GetShaderType() const { return shaderType; }
+        [[nodiscard]] ShaderStage GetShaderStage() const;
+
+        [[nodiscard]] inline const std::vector<ShaderBinding>& GetBindings() const { return bindings; }
+        [[nodiscard]] inline uint16 GetPushConstantSize() const { return pushConstantSize; }
+
         /* --- OPERATORS --- */
         Shader(const Shader&) = delete;
         Shader& operator=(const Shader&) = delete;
@@ -38,6 +92,15 @@ namespace Sierra
 
     protected:
         explicit Shader(const ShaderCreateInfo &createInfo);
+        void Reflect(const uint32* spirvData, uint64 wordCount);
+
+        // Returns a file of the shader's bundle, taken from its archive, if one is used, or mapped into the given file otherwise (memory is empty if file is missing)
+        [[nodiscard]] static ShaderMemory LoadBundleFile(const ShaderCreateInfo &createInfo, std::string_view fileName, std::optional<MappedFile> &mappedFile);
+
+    private:
+        ShaderType shaderType = ShaderType::Undefined;
+        std::vector<ShaderBinding> bindings;
+        uint16 pushConstantSize = 0;
 
     };
 
@@ -0,0 +1,111 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "ShaderArchive.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    ShaderArchive::ShaderArchive(const ShaderArchiveCreateInfo &createInfo)
+        : mappedFile(createInfo.filePath)
+    {
+        const char* const data = static_cast<const char*>(mappedFile.GetData());
+        const uint64 memorySize = mappedFile.GetMemorySize();
+
+        // Archives may be stale or corrupt, so their table of contents is validated regardless of whether logging is enabled (invalid ones hold no files)
+        if (memorySize < sizeof(Header))
+        {
+            SR_ERROR("Cannot load shader archive [{0}], as it is too small to hold a header!", createInfo.filePath.string().c_str());
+            return;
+        }
+
+        const Header &header = *reinterpret_cast<const Header*>(data);
+        if (header.magicNumber != MAGIC_NUMBER)
+        {
+            SR_ERROR("Cannot load shader archive [{0}], as it is not a shader archive!", createInfo.filePath.string().c_str());
+            return;
+        }
+        if (header.version != VERSION)
+        {
+            SR_ERROR("Cannot load shader archive [{0}], as its version [{1}] differs from the supported version [{2}]! Re-pack it with ShaderCompiler.py.", createInfo.filePath.string().c_str(), header.version, VERSION);
+            return;
+        }
+        if (sizeof(Header) + static_cast<uint64>(header.fileCount) * sizeof(Entry) + header.nameTableMemorySize > memorySize)
+        {
+            SR_ERROR("Cannot load shader archive [{0}], as its table of contents is truncated!", createInfo.filePath.string().c_str());
+            return;
+        }
+
+        // Table of contents directly follows the header, and names follow it (mapping is page-aligned, so entries can be read in place)
+        entries = reinterpret_cast<const Entry*>(data + sizeof(Header));
+        nameTable = data + sizeof(Header) + static_cast<uint64>(header.fileCount) * sizeof(Entry);
+
+        for (uint32 i = 0; i < header.fileCount; i++)
+        {
+            const Entry &entry = entries[i];
+            if (entry.nameOffset > header.nameTableMemorySize || entry.nameLength > header.nameTableMemorySize - entry.nameOffset)
+            {
+                SR_ERROR("Cannot load shader archive [{0}], as the name of its file [{1}] lies outside of its name table!", createInfo.filePath.string().c_str(), i);
+                return;
+            }
+            if (entry.dataOffset > memorySize || entry.dataMemorySize > memorySize - entry.dataOffset || entry.dataOffset % FILE_ALIGNMENT != 0)
+            {
+                SR_ERROR("Cannot load shader archive [{0}], as file [{1}] lies outside of it, or is misaligned!", createInfo.filePath.string().c_str(), std::string_view(nameTable + entry.nameOffset, entry.nameLength));
+                return;
+            }
+            if (i > 0 && entries[i - 1].nameHash > entry.nameHash)
+            {
+                SR_ERROR("Cannot load shader archive [{0}], as its table of contents is not sorted!", createInfo.filePath.string().c_str());
+                return;
+            }
+        }
+
+        fileCount = header.fileCount;
+    }
+
+    /* --- GETTER METHODS --- */
+
+    ShaderMemory ShaderArchive::GetFileMemory(const std::string_view bundleName, const std::string_view fileName) const
+    {
+        const uint64 nameHash = GetFileHash(bundleName, fileName);
+
+        // Entries are sorted by hash, and colliding ones are told apart by their full names
+        const Entry* const entriesEnd = entries + fileCount;
+        for (const Entry* entry = std::lower_bound(entries, entriesEnd, nameHash, [](const Entry &lhs, const uint64 hash) { return lhs.nameHash < hash; }); entry != entriesEnd && entry->nameHash == nameHash; entry++)
+        {
+            const std::string_view name(nameTable + entry->nameOffset, entry->nameLength);
+            if (name.size() != bundleName.size() + 1 + fileName.size() || !name.starts_with(bundleName) || name[bundleName.size()] != '/' || !name.ends_with(fileName)) continue;
+
+            return { .data = static_cast<const char*>(mappedFile.GetData()) + entry->dataOffset, .memorySize = entry->dataMemorySize };
+        }
+
+        return { };
+    }
+
+    /* --- CONVERSIONS --- */
+
+    uint64 ShaderArchive::GetFileHash(const std::string_view bundleName, const std::string_view fileName)
+    {
+        constexpr uint64 FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+        constexpr uint64 FNV_PRIME = 0x100000001B3;
+
+        uint64 hash = FNV_OFFSET_BASIS;
+        const auto HashCharacters = [&hash](const std::string_view characters)
+        {
+            for (const char character : characters)
+            {
+                hash ^= static_cast<uint8>(character);
+                hash *= FNV_PRIME;
+            }
+        };
+
+        HashCharacters(bundleName);
+        HashCharacters("/");
+        HashCharacters(fileName);
+        return hash;
+    }
+
+}
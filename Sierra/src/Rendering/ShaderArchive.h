@@ -0,0 +1,80 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "../Utilities/File.h"
+
+namespace Sierra
+{
+
+    // Code of a shader, embedded within the application, which must remain valid until shader creation returns
+    struct ShaderMemory
+    {
+        const void* data = nullptr;
+        uint64 memorySize = 0;
+    };
+
+    struct ShaderArchiveCreateInfo
+    {
+        const std::filesystem::path &filePath;
+    };
+
+    // Single memory-mapped file, holding the contents of many shader bundles (as emitted by ShaderCompiler.py --pack), so shaders load without any per-bundle file system access
+    class SIERRA_API ShaderArchive final
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        explicit ShaderArchive(const ShaderArchiveCreateInfo &createInfo);
+
+        /* --- GETTER METHODS --- */
+        // Returns contents of a file within a bundle (e.g. "ImGuiRenderTask.vert.shader", "shader.spv"), or empty memory if the archive does not hold it - memory stays valid for as long as the archive
+        [[nodiscard]] ShaderMemory GetFileMemory(std::string_view bundleName, std::string_view fileName) const;
+        [[nodiscard]] inline uint32 GetFileCount() const { return fileCount; }
+
+        /* --- OPERATORS --- */
+        ShaderArchive(const ShaderArchive&) = delete;
+        ShaderArchive& operator=(const ShaderArchive&) = delete;
+
+        /* --- DESTRUCTOR --- */
+        ~ShaderArchive() = default;
+
+        /* --- CONSTANTS --- */
+        constexpr static uint32 MAGIC_NUMBER = 0x41535253; // "SRSA"
+        constexpr static uint32 VERSION = 1;
+        constexpr static uint64 FILE_ALIGNMENT = 16;
+
+        /* --- CONVERSIONS --- */
+        // 64-bit FNV-1a of "<bundleName>/<fileName>", which ShaderCompiler.py uses to sort the table of contents
+        [[nodiscard]] static uint64 GetFileHash(std::string_view bundleName, std::string_view fileName);
+
+    private:
+        MappedFile mappedFile;
+
+        struct Header
+        {
+            uint32 magicNumber = 0;
+            uint32 version = 0;
+            uint32 fileCount = 0;
+            uint32 nameTableMemorySize = 0;
+        };
+        static_assert(sizeof(Header) == 16);
+
+        struct Entry
+        {
+            uint64 nameHash = 0;
+            uint32 nameOffset = 0;
+            uint32 nameLength = 0;
+            uint64 dataOffset = 0;
+            uint64 dataMemorySize = 0;
+        };
+        static_assert(sizeof(Entry) == 32);
+
+        uint32 fileCount = 0; // Left at zero for invalid archives, so they act as empty ones
+        const Entry* entries = nullptr;
+        const char* nameTable = nullptr;
+
+    };
+
+}
@@ -31,10 +31,12 @@ namespace Sierra
         };
     #pragma endregion
 
-    enum class SwapchainPresentationMode : bool
+    enum class SwapchainPresentationMode : uint8
     {
-        Immediate,
-        VSync
+        Immediate,          // Possible tearing, no GPU idling, minimal latency, and high energy consumption (falls back to Mailbox, then VSync)
+        Mailbox,            // No tearing, no GPU idling, low latency (newest frame replaces queued ones), and high energy consumption (falls back to VSync)
+        VSync,              // No tearing, GPU idling, moderate latency, and minimal energy consumption (always supported)
+        RelaxedVSync        // Same as VSync, but late frames are presented immediately, with possible tearing (falls back to VSync)
     };
 
     enum class SwapchainImageMemoryType : uint8
@@ -50,6 +52,8 @@ namespace Sierra
         std::unique_ptr<Window> &window;
         SwapchainPresentationMode preferredPresentationMode = SwapchainPresentationMode::VSync;
         SwapchainImageMemoryType preferredImageMemoryType = SwapchainImageMemoryType::UNorm8;
+        uint32 maxQueuedFrameCount = 3; // How many frames the CPU may get ahead of presentation (lower values trade throughput for input latency)
+        uint32 resizeDebounceMilliseconds = 100; // For how long the window size has to stay unchanged before a swapchain, which can still be presented to, is recreated
     };
 
     class SIERRA_API Swapchain : public virtual RenderingResource
@@ -63,6 +67,9 @@ namespace Sierra
         virtual void AcquireNextImage() = 0;
         virtual void Present(std::unique_ptr<CommandBuffer> &commandBuffer) = 0;
 
+        // Blocks until the last presented frame has reached the display (or, if that cannot be tracked, until it has been rendered), so input can be sampled as late as possible; returns false on timeout
+        virtual bool WaitForPreviousPresent(uint64 timeoutInNanoseconds = std::numeric_limits<uint64>::max()) const = 0;
+
         /* --- GETTER METHODS --- */
         [[nodiscard]] virtual uint32 GetCurrentFrame() const = 0;
         [[nodiscard]] virtual uint32 GetConcurrentFrameCount() const = 0;
@@ -84,6 +91,7 @@ namespace Sierra
         virtual ~Swapchain() = default;
 
     protected:
+        Swapchain() = default;
         explicit Swapchain(const SwapchainCreateInfo &createInfo);
         [[nodiscard]] inline EventDispatcher<SwapchainResizeEvent>& GetSwapchainResizeDispatcher() { return swapchainResizeDispatcher; };
 
@@ -16,6 +16,12 @@
     #include "Platform/Apple/NSFilePaths.h"
 #endif
 
+#if !SR_PLATFORM_WINDOWS
+    #include <sys/mman.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
 namespace Sierra
 {
     
@@ -149,4 +155,67 @@ namespace Sierra
         return temporaryDirectoryPath;
     }
 
+    /* --- CONSTRUCTORS --- */
+
+    MappedFile::MappedFile(const std::filesystem::path &filePath)
+    {
+        SR_ERROR_IF(!File::FileExists(filePath), "Could not map file [{0}], as it does not exist!", filePath.string().c_str());
+
+        memorySize = std::filesystem::file_size(filePath);
+        if (memorySize == 0) return;
+
+        // Handles can be closed right after mapping, as the view keeps the file referenced until unmapped
+        #if SR_PLATFORM_WINDOWS
+            const HANDLE fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            SR_ERROR_IF(fileHandle == INVALID_HANDLE_VALUE, "Could not open file [{0}] for mapping!", filePath.string().c_str());
+
+            const HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(fileHandle);
+            SR_ERROR_IF(mappingHandle == nullptr, "Could not create mapping of file [{0}]!", filePath.string().c_str());
+
+            data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mappingHandle);
+            SR_ERROR_IF(data == nullptr, "Could not map file [{0}]!", filePath.string().c_str());
+        #else
+            const int fileDescriptor = open(filePath.c_str(), O_RDONLY);
+            SR_ERROR_IF(fileDescriptor == -1, "Could not open file [{0}] for mapping!", filePath.string().c_str());
+
+            void* const mappedData = mmap(nullptr, memorySize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+            close(fileDescriptor);
+            SR_ERROR_IF(mappedData == MAP_FAILED, "Could not map file [{0}]!", filePath.string().c_str());
+
+            data = mappedData;
+        #endif
+    }
+
+    /* --- OPERATORS --- */
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : data(std::exchange(other.data, nullptr)), memorySize(std::exchange(other.memorySize, 0))
+    {
+
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile &&other) noexcept
+    {
+        // Previous mapping is handed over to other, so it is released along with it
+        std::swap(data, other.data);
+        std::swap(memorySize, other.memorySize);
+        return *this;
+    }
+
+    /* --- DESTRUCTOR --- */
+
+    MappedFile::~MappedFile()
+    {
+        if (data == nullptr) return;
+
+        #if SR_PLATFORM_WINDOWS
+            UnmapViewOfFile(data);
+        #else
+            munmap(const_cast<void*>(data), memorySize);
+        #endif
+        data = nullptr;
+    }
+
 }
\ No newline at end of file
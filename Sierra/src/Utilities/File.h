@@ -32,4 +32,31 @@ namespace Sierra
 
     };
 
+    // Read-only view of a file's contents, paged in by the OS on access, so no intermediate heap copy of it is ever made
+    class SIERRA_API MappedFile final
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        explicit MappedFile(const std::filesystem::path &filePath);
+
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] inline const void* GetData() const { return data; } // Page-aligned (or null if file is empty)
+        [[nodiscard]] inline uint64 GetMemorySize() const { return memorySize; }
+
+        /* --- OPERATORS --- */
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile& operator=(MappedFile &&other) noexcept;
+
+        /* --- DESTRUCTOR --- */
+        ~MappedFile();
+
+    private:
+        const void* data = nullptr;
+        uint64 memorySize = 0;
+
+    };
+
 }
@@ -0,0 +1,77 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "Geometry.h"
+
+namespace Sierra
+{
+
+    /* --- POLLING METHODS --- */
+
+    DeinterleavedVertexData Geometry::DeinterleaveVertices(const void* vertexData, const uint32 vertexCount, const std::initializer_list<VertexInput> &vertexInputs, const uint32 positionInputIndex)
+    {
+        SR_ERROR_IF(positionInputIndex >= vertexInputs.size(), "Cannot deinterleave vertices using position input index [{0}], as only [{1}] vertex inputs were specified!", positionInputIndex, vertexInputs.size());
+
+        // Calculate byte layout of an interleaved vertex
+        uint32 vertexByteStride = 0;
+        uint32 positionByteOffset = 0;
+        for (uint32 i = 0; i < vertexInputs.size(); i++)
+        {
+            if (i == positionInputIndex) positionByteOffset = vertexByteStride;
+            vertexByteStride += VertexInputToMemorySize(*(vertexInputs.begin() + i));
+        }
+
+        const uint32 positionByteSize = VertexInputToMemorySize(*(vertexInputs.begin() + positionInputIndex));
+        const uint32 attributeByteStride = vertexByteStride - positionByteSize;
+
+        // Allocate streams
+        DeinterleavedVertexData deinterleavedVertexData = { };
+        deinterleavedVertexData.positionStream.resize(static_cast<uint64>(vertexCount) * positionByteSize);
+        deinterleavedVertexData.attributeStream.resize(static_cast<uint64>(vertexCount) * attributeByteStride);
+
+        // Copy every vertex's position and attributes (the latter being the bytes before and after the position) to their respective streams
+        const uint8* sourceVertex = static_cast<const uint8*>(vertexData);
+        uint8* positionDestination = deinterleavedVertexData.positionStream.data();
+        uint8* attributeDestination = deinterleavedVertexData.attributeStream.data();
+        for (uint32 i = 0; i < vertexCount; i++)
+        {
+            std::memcpy(positionDestination, sourceVertex + positionByteOffset, positionByteSize);
+            std::memcpy(attributeDestination, sourceVertex, positionByteOffset);
+            std::memcpy(attributeDestination + positionByteOffset, sourceVertex + positionByteOffset + positionByteSize, vertexByteStride - positionByteOffset - positionByteSize);
+
+            sourceVertex += vertexByteStride;
+            positionDestination += positionByteSize;
+            attributeDestination += attributeByteStride;
+        }
+
+        return deinterleavedVertexData;
+    }
+
+    IndexData Geometry::NarrowIndices(const uint32* indices, const uint32 indexCount, const uint32 vertexCount)
+    {
+        IndexData indexData = { };
+
+        // Keep indices as they are, if there are too many vertices to address with 16 bits
+        if (vertexCount > std::numeric_limits<uint16>::max())
+        {
+            indexData.indexType = IndexBufferType::UInt32;
+            indexData.indices.resize(static_cast<uint64>(indexCount) * sizeof(uint32));
+            std::memcpy(indexData.indices.data(), indices, indexData.indices.size());
+            return indexData;
+        }
+
+        // Narrow every index
+        indexData.indexType = IndexBufferType::UInt16;
+        indexData.indices.resize(static_cast<uint64>(indexCount) * sizeof(uint16));
+        uint16* narrowedIndices = reinterpret_cast<uint16*>(indexData.indices.data());
+        for (uint32 i = 0; i < indexCount; i++)
+        {
+            SR_ERROR_IF(indices[i] >= vertexCount, "Cannot narrow index [{0}] of value [{1}], as it exceeds the specified vertex count of [{2}]!", i, indices[i], vertexCount);
+            narrowedIndices[i] = static_cast<uint16>(indices[i]);
+        }
+
+        return indexData;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "../Rendering/CommandBuffer.h"
+
+namespace Sierra
+{
+
+    struct DeinterleavedVertexData
+    {
+        std::vector<uint8> positionStream;
+        std::vector<uint8> attributeStream;
+    };
+
+    struct IndexData
+    {
+        std::vector<uint8> indices;
+        IndexBufferType indexType = IndexBufferType::UInt32;
+    };
+
+    class SIERRA_API Geometry final
+    {
+    public:
+        /* --- POLLING METHODS --- */
+        // Splits interleaved vertices into a position-only stream (to be bound to stream 0) and a stream of all remaining inputs (to be bound to stream 1), letting depth-only passes fetch positions alone
+        [[nodiscard]] static DeinterleavedVertexData DeinterleaveVertices(const void* vertexData, uint32 vertexCount, const std::initializer_list<VertexInput> &vertexInputs, uint32 positionInputIndex = 0);
+
+        // Narrows 32-bit indices to 16-bit ones whenever every vertex is addressable with them, halving index memory and fetch bandwidth - bind the result with its returned index type
+        [[nodiscard]] static IndexData NarrowIndices(const uint32* indices, uint32 indexCount, uint32 vertexCount);
+
+    };
+
+}
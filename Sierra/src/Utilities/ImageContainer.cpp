@@ -0,0 +1,410 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "ImageContainer.h"
+
+#include <numeric>
+#include "File.h"
+
+namespace Sierra
+{
+
+    /* --- POLLING METHODS --- */
+
+    std::optional<ImageContainerData> ImageContainer::Parse(std::vector<char> &&fileMemory)
+    {
+        constexpr std::array<uint8, 12> KTX2_IDENTIFIER = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+        constexpr uint32 DDS_MAGIC = 0x20534444; // "DDS "
+
+        // Determine container type from its signature
+        if (fileMemory.size() >= KTX2_IDENTIFIER.size() && std::memcmp(fileMemory.data(), KTX2_IDENTIFIER.data(), KTX2_IDENTIFIER.size()) == 0) return ParseKTX2(std::move(fileMemory));
+        if (fileMemory.size() >= sizeof(uint32) && ReadFromMemory<uint32>(fileMemory, 0) == DDS_MAGIC) return ParseDDS(std::move(fileMemory));
+
+        SR_ERROR("Cannot parse image container, as it is neither a KTX2, nor a DDS file!");
+        return std::nullopt;
+    }
+
+    std::unique_ptr<Image> ImageContainer::Load(const RenderingContext &renderingContext, std::unique_ptr<CommandBuffer> &commandBuffer, const ImageContainerLoadInfo &loadInfo)
+    {
+        SR_ERROR_IF(!File::FileExists(loadInfo.filePath), "Cannot load image [{0}] from container [{1}], as it does not exist!", loadInfo.name, loadInfo.filePath.string().c_str());
+        const std::optional<ImageContainerData> parsedContainerData = Parse(File::ReadFile(loadInfo.filePath));
+        if (!parsedContainerData.has_value()) return nullptr;
+        const ImageContainerData &containerData = parsedContainerData.value();
+
+        const ImageUsage usage = loadInfo.usage | ImageUsage::DestinationMemory;
+        SR_ERROR_IF(!renderingContext.GetDevice().IsImageFormatSupported(containerData.format, usage), "Cannot load image [{0}] from container [{1}], as its format is not supported by the device!", loadInfo.name, loadInfo.filePath.string().c_str());
+
+        // Create image
+        std::unique_ptr<Image> image = renderingContext.CreateImage({
+            .name = loadInfo.name,
+            .width = containerData.width,
+            .height = containerData.height,
+            .type = containerData.type,
+            .format = containerData.format,
+            .mipLevelCount = containerData.mipLevelCount,
+            .layerCount = containerData.layerCount,
+            .usage = usage,
+            .memoryLocation = ImageMemoryLocation::Device
+        });
+
+        // Pack every subresource into one staging buffer, keeping their offsets aligned to whole blocks
+        const uint64 alignment = std::lcm<uint64>(image->GetBlockMemorySize(), 4);
+        std::vector<uint64> stagingByteOffsets(containerData.subresources.size());
+        uint64 stagingMemorySize = 0;
+        for (uint32 i = 0; i < containerData.subresources.size(); i++)
+        {
+            stagingByteOffsets[i] = (stagingMemorySize + alignment - 1) / alignment * alignment;
+            stagingMemorySize = stagingByteOffsets[i] + containerData.subresources[i].memorySize;
+        }
+
+        // Create staging buffer
+        const std::string stagingBufferName = "Staging Buffer of Image [" + loadInfo.name + "]";
+        std::unique_ptr<Buffer> stagingBuffer = renderingContext.CreateBuffer({
+            .name = stagingBufferName,
+            .memorySize = stagingMemorySize,
+            .usage = BufferUsage::SourceMemory,
+            .memoryLocation = BufferMemoryLocation::CPU
+        });
+        for (uint32 i = 0; i < containerData.subresources.size(); i++)
+        {
+            stagingBuffer->CopyFromMemory(containerData.fileMemory.data(), containerData.subresources[i].memorySize, containerData.subresources[i].byteOffset, stagingByteOffsets[i]);
+        }
+
+        // Copy all mip levels of all layers within a single command
+        std::vector<BufferImageCopyRegion> copyRegions(containerData.subresources.size());
+        for (uint32 i = 0; i < containerData.subresources.size(); i++)
+        {
+            copyRegions[i] = { .sourceByteOffset = stagingByteOffsets[i], .mipLevel = containerData.subresources[i].mipLevel, .layer = containerData.subresources[i].layer };
+        }
+
+        commandBuffer->SynchronizeImageUsage(image, ImageCommandUsage::None, ImageCommandUsage::MemoryWrite);
+        commandBuffer->CopyBufferToImageRegions(stagingBuffer, image, copyRegions);
+        commandBuffer->SynchronizeImageUsage(image, ImageCommandUsage::MemoryWrite, loadInfo.nextUsage);
+        commandBuffer->QueueBufferForDestruction(std::move(stagingBuffer));
+
+        return image;
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    std::optional<ImageContainerData> ImageContainer::ParseKTX2(std::vector<char> &&fileMemory)
+    {
+        /* === Reference: https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html === */
+        ImageContainerData containerData = { };
+
+        // Containers may be truncated or malformed, so everything is validated before being read, regardless of whether logging is enabled
+        constexpr uint64 HEADER_MEMORY_SIZE = 80;
+        if (fileMemory.size() < HEADER_MEMORY_SIZE)
+        {
+            SR_ERROR("Cannot parse KTX2 container, as its header is truncated!");
+            return std::nullopt;
+        }
+
+        // Read header
+        const uint32 vkFormat = ReadFromMemory<uint32>(fileMemory, 12);
+        const uint32 pixelWidth = ReadFromMemory<uint32>(fileMemory, 20);
+        const uint32 pixelHeight = ReadFromMemory<uint32>(fileMemory, 24);
+        const uint32 pixelDepth = ReadFromMemory<uint32>(fileMemory, 28);
+        const uint32 layerCount = ReadFromMemory<uint32>(fileMemory, 32);
+        const uint32 faceCount = ReadFromMemory<uint32>(fileMemory, 36);
+        const uint32 levelCount = ReadFromMemory<uint32>(fileMemory, 40);
+        const uint32 supercompressionScheme = ReadFromMemory<uint32>(fileMemory, 44);
+
+        if (pixelDepth > 1)
+        {
+            SR_ERROR("Cannot parse KTX2 container, as 3D images are not supported!");
+            return std::nullopt;
+        }
+        if (supercompressionScheme != 0)
+        {
+            SR_ERROR("Cannot parse KTX2 container, as supercompressed ones (scheme [{0}]) are not supported!", supercompressionScheme);
+            return std::nullopt;
+        }
+        if (faceCount != 1 && faceCount != 6)
+        {
+            SR_ERROR("Cannot parse KTX2 container with an invalid face count of [{0}]!", faceCount);
+            return std::nullopt;
+        }
+
+        const std::optional<ImageFormat> format = VkFormatToImageFormat(vkFormat);
+        if (!format.has_value())
+        {
+            SR_ERROR("Cannot parse KTX2 container, as its format [{0}] is not supported!", vkFormat);
+            return std::nullopt;
+        }
+
+        containerData.width = pixelWidth;
+        containerData.height = std::max(pixelHeight, 1U);
+        containerData.type = faceCount == 6 ? ImageType::Cube : ImageType::Plane;
+        containerData.format = format.value();
+        containerData.mipLevelCount = std::max(levelCount, 1U);
+        if (!IsImageValid(containerData.format, containerData.width, containerData.height, containerData.mipLevelCount, fileMemory.size()))
+        {
+            SR_ERROR("Cannot parse KTX2 container, as its dimensions of [{0}x{1}] and mip level count of [{2}] are invalid!", containerData.width, containerData.height, containerData.mipLevelCount);
+            return std::nullopt;
+        }
+
+        // Every layer must fit within the file (which also keeps the total layer count from overflowing)
+        const uint64 totalLayerCount = static_cast<uint64>(std::max(layerCount, 1U)) * faceCount;
+        if (totalLayerCount > std::numeric_limits<uint32>::max() || totalLayerCount > fileMemory.size() / ImageFormatToRegionMemorySize(containerData.format, containerData.width, containerData.height))
+        {
+            SR_ERROR("Cannot parse KTX2 container, as its layer count of [{0}] exceeds its memory!", totalLayerCount);
+            return std::nullopt;
+        }
+        containerData.layerCount = static_cast<uint32>(totalLayerCount);
+
+        // Every level holds all of its layers and faces tightly packed, and levels are listed in an index right after the header
+        constexpr uint64 LEVEL_INDEX_BYTE_OFFSET = HEADER_MEMORY_SIZE;
+        constexpr uint64 LEVEL_INDEX_ENTRY_MEMORY_SIZE = 3 * sizeof(uint64);
+        if (containerData.mipLevelCount * LEVEL_INDEX_ENTRY_MEMORY_SIZE > fileMemory.size() - LEVEL_INDEX_BYTE_OFFSET)
+        {
+            SR_ERROR("Cannot parse KTX2 container, as its level index is truncated!");
+            return std::nullopt;
+        }
+
+        containerData.subresources.reserve(static_cast<uint64>(containerData.mipLevelCount) * containerData.layerCount);
+        for (uint32 level = 0; level < containerData.mipLevelCount; level++)
+        {
+            const uint64 levelByteOffset = ReadFromMemory<uint64>(fileMemory, LEVEL_INDEX_BYTE_OFFSET + level * LEVEL_INDEX_ENTRY_MEMORY_SIZE);
+            const uint64 levelMemorySize = ReadFromMemory<uint64>(fileMemory, LEVEL_INDEX_BYTE_OFFSET + level * LEVEL_INDEX_ENTRY_MEMORY_SIZE + sizeof(uint64));
+            const uint64 layerMemorySize = ImageFormatToRegionMemorySize(containerData.format, std::max(containerData.width >> level, 1U), std::max(containerData.height >> level, 1U));
+
+            if (levelByteOffset > fileMemory.size() || levelMemorySize > fileMemory.size() - levelByteOffset || levelMemorySize / containerData.layerCount < layerMemorySize)
+            {
+                SR_ERROR("Cannot parse KTX2 container, as its mip level [{0}] is truncated!", level);
+                return std::nullopt;
+            }
+
+            for (uint32 layer = 0; layer < containerData.layerCount; layer++)
+            {
+                containerData.subresources.push_back({ .mipLevel = level, .layer = layer, .byteOffset = levelByteOffset + layer * layerMemorySize, .memorySize = layerMemorySize });
+            }
+        }
+
+        containerData.fileMemory = std::move(fileMemory);
+        return containerData;
+    }
+
+    std::optional<ImageContainerData> ImageContainer::ParseDDS(std::vector<char> &&fileMemory)
+    {
+        /* === Reference: https://learn.microsoft.com/en-us/windows/win32/direct3ddds/dx-graphics-dds-pguide === */
+        ImageContainerData containerData = { };
+
+        // Containers may be truncated or malformed, so everything is validated before being read, regardless of whether logging is enabled
+        constexpr uint64 HEADER_MEMORY_SIZE = 128;
+        constexpr uint64 DX10_HEADER_MEMORY_SIZE = 20;
+        if (fileMemory.size() < HEADER_MEMORY_SIZE)
+        {
+            SR_ERROR("Cannot parse DDS container, as its header is truncated!");
+            return std::nullopt;
+        }
+
+        // Read header
+        const uint32 height = ReadFromMemory<uint32>(fileMemory, 12);
+        const uint32 width = ReadFromMemory<uint32>(fileMemory, 16);
+        const uint32 depth = ReadFromMemory<uint32>(fileMemory, 24);
+        const uint32 mipMapCount = ReadFromMemory<uint32>(fileMemory, 28);
+        const uint32 pixelFormatFlags = ReadFromMemory<uint32>(fileMemory, 80);
+        const uint32 fourCC = ReadFromMemory<uint32>(fileMemory, 84);
+        const uint32 caps2 = ReadFromMemory<uint32>(fileMemory, 112);
+
+        if (depth > 1)
+        {
+            SR_ERROR("Cannot parse DDS container, as 3D images are not supported!");
+            return std::nullopt;
+        }
+
+        // Determine format and layer count, which are stored in an extended header for DX10 containers
+        constexpr uint32 DX10_FOURCC = 0x30315844; // "DX10"
+        uint64 dataByteOffset = HEADER_MEMORY_SIZE;
+        std::optional<ImageFormat> format = std::nullopt;
+        uint32 faceCount = caps2 & 0x200 ? 6 : 1; // DDSCAPS2_CUBEMAP
+        uint32 arraySize = 1;
+        if (pixelFormatFlags & 0x4 && fourCC == DX10_FOURCC) // DDPF_FOURCC
+        {
+            if (fileMemory.size() < HEADER_MEMORY_SIZE + DX10_HEADER_MEMORY_SIZE)
+            {
+                SR_ERROR("Cannot parse DDS container, as its DX10 header is truncated!");
+                return std::nullopt;
+            }
+
+            const uint32 dxgiFormat = ReadFromMemory<uint32>(fileMemory, 128);
+            const uint32 miscFlag = ReadFromMemory<uint32>(fileMemory, 136);
+            format = DXGIFormatToImageFormat(dxgiFormat);
+            faceCount = miscFlag & 0x4 ? 6 : 1; // D3D11_RESOURCE_MISC_TEXTURECUBE
+            arraySize = std::max(ReadFromMemory<uint32>(fileMemory, 140), 1U);
+            dataByteOffset += DX10_HEADER_MEMORY_SIZE;
+        }
+        else if (pixelFormatFlags & 0x4)
+        {
+            format = FourCCToImageFormat(fourCC);
+        }
+        else if (pixelFormatFlags & 0x40 && ReadFromMemory<uint32>(fileMemory, 88) == 32) // DDPF_RGB with 32 bits per pixel
+        {
+            const uint32 redMask = ReadFromMemory<uint32>(fileMemory, 92);
+            if (redMask == 0x000000FF) format = ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8 };
+            else if (redMask == 0x00FF0000) format = ImageFormat { .channels = ImageChannels::BGRA, .memoryType = ImageMemoryType::UNorm8 };
+        }
+        if (!format.has_value())
+        {
+            SR_ERROR("Cannot parse DDS container, as its format is not supported!");
+            return std::nullopt;
+        }
+
+        containerData.width = width;
+        containerData.height = std::max(height, 1U);
+        containerData.type = faceCount == 6 ? ImageType::Cube : ImageType::Plane;
+        containerData.format = format.value();
+        containerData.mipLevelCount = std::max(mipMapCount, 1U);
+        if (!IsImageValid(containerData.format, containerData.width, containerData.height, containerData.mipLevelCount, fileMemory.size() - dataByteOffset))
+        {
+            SR_ERROR("Cannot parse DDS container, as its dimensions of [{0}x{1}] and mip level count of [{2}] are invalid!", containerData.width, containerData.height, containerData.mipLevelCount);
+            return std::nullopt;
+        }
+
+        // Unlike KTX2, every layer holds all of its mip levels tightly packed, so all layers are of the same size
+        uint64 layerMemorySize = 0;
+        for (uint32 level = 0; level < containerData.mipLevelCount; level++)
+        {
+            layerMemorySize += ImageFormatToRegionMemorySize(containerData.format, std::max(containerData.width >> level, 1U), std::max(containerData.height >> level, 1U));
+        }
+
+        // Every layer must fit within the file (which also keeps the total layer count from overflowing)
+        const uint64 totalLayerCount = static_cast<uint64>(arraySize) * faceCount;
+        if (totalLayerCount > std::numeric_limits<uint32>::max() || totalLayerCount > (fileMemory.size() - dataByteOffset) / layerMemorySize)
+        {
+            SR_ERROR("Cannot parse DDS container, as its data is truncated!");
+            return std::nullopt;
+        }
+        containerData.layerCount = static_cast<uint32>(totalLayerCount);
+
+        containerData.subresources.reserve(static_cast<uint64>(containerData.mipLevelCount) * containerData.layerCount);
+        uint64 byteOffset = dataByteOffset;
+        for (uint32 layer = 0; layer < containerData.layerCount; layer++)
+        {
+            for (uint32 level = 0; level < containerData.mipLevelCount; level++)
+            {
+                const uint64 memorySize = ImageFormatToRegionMemorySize(containerData.format, std::max(containerData.width >> level, 1U), std::max(containerData.height >> level, 1U));
+                containerData.subresources.push_back({ .mipLevel = level, .layer = layer, .byteOffset = byteOffset, .memorySize = memorySize });
+                byteOffset += memorySize;
+            }
+        }
+
+        containerData.fileMemory = std::move(fileMemory);
+        return containerData;
+    }
+
+    bool ImageContainer::IsImageValid(const ImageFormat format, const uint32 width, const uint32 height, const uint32 mipLevelCount, const uint64 memorySize)
+    {
+        if (width == 0 || height == 0) return false;
+        if (mipLevelCount > static_cast<uint32>(glm::floor(std::log2(glm::max(width, height)))) + 1) return false;
+
+        // Make sure the base mip level (and thus every other one) fits within the given memory, checking block counts first, so that sizes are never computed with overflowing dimensions
+        const uint32 blockExtent = ImageCompressionToBlockExtent(format.compression);
+        if (width > std::numeric_limits<uint32>::max() - blockExtent || height > std::numeric_limits<uint32>::max() - blockExtent) return false;
+
+        const uint64 horizontalBlockCount = (static_cast<uint64>(width) + blockExtent - 1) / blockExtent;
+        const uint64 verticalBlockCount = (static_cast<uint64>(height) + blockExtent - 1) / blockExtent;
+        return horizontalBlockCount <= memorySize / ImageFormatToBlockMemorySize(format) / verticalBlockCount;
+    }
+
+    /* --- CONVERSIONS --- */
+
+    std::optional<ImageFormat> ImageContainer::VkFormatToImageFormat(const uint32 vkFormat)
+    {
+        // Raw values of VkFormat, so containers can be loaded regardless of the graphics API used
+        switch (vkFormat)
+        {
+            case 9:         return ImageFormat { .channels = ImageChannels::R, .memoryType = ImageMemoryType::UNorm8 };                                                               // VK_FORMAT_R8_UNORM
+            case 16:        return ImageFormat { .channels = ImageChannels::RG, .memoryType = ImageMemoryType::UNorm8 };                                                              // VK_FORMAT_R8G8_UNORM
+            case 37:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8 };                                                            // VK_FORMAT_R8G8B8A8_UNORM
+            case 43:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8 };                                                             // VK_FORMAT_R8G8B8A8_SRGB
+            case 97:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::Float16 };                                                           // VK_FORMAT_R16G16B16A16_SFLOAT
+            case 109:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::Float32 };                                                           // VK_FORMAT_R32G32B32A32_SFLOAT
+            case 131:       return ImageFormat { .channels = ImageChannels::RGB, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC1 };                       // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+            case 132:       return ImageFormat { .channels = ImageChannels::RGB, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::BC1 };                        // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+            case 133:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC1 };                      // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+            case 134:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::BC1 };                       // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+            case 135:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC2 };                      // VK_FORMAT_BC2_UNORM_BLOCK
+            case 136:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::BC2 };                       // VK_FORMAT_BC2_SRGB_BLOCK
+            case 137:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC3 };                      // VK_FORMAT_BC3_UNORM_BLOCK
+            case 138:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::BC3 };                       // VK_FORMAT_BC3_SRGB_BLOCK
+            case 139:       return ImageFormat { .channels = ImageChannels::R, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC4 };                         // VK_FORMAT_BC4_UNORM_BLOCK
+            case 140:       return ImageFormat { .channels = ImageChannels::R, .memoryType = ImageMemoryType::Norm8, .compression = ImageCompression::BC4 };                          // VK_FORMAT_BC4_SNORM_BLOCK
+            case 141:       return ImageFormat { .channels = ImageChannels::RG, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC5 };                        // VK_FORMAT_BC5_UNORM_BLOCK
+            case 142:       return ImageFormat { .channels = ImageChannels::RG, .memoryType = ImageMemoryType::Norm8, .compression = ImageCompression::BC5 };                         // VK_FORMAT_BC5_SNORM_BLOCK
+            case 143:       return ImageFormat { .channels = ImageChannels::RGB, .memoryType = ImageMemoryType::Float16, .compression = ImageCompression::BC6H };                     // VK_FORMAT_BC6H_UFLOAT_BLOCK
+            case 145:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC7 };                      // VK_FORMAT_BC7_UNORM_BLOCK
+            case 146:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::BC7 };                       // VK_FORMAT_BC7_SRGB_BLOCK
+            case 147:       return ImageFormat { .channels = ImageChannels::RGB, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::ETC2 };                      // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+            case 148:       return ImageFormat { .channels = ImageChannels::RGB, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::ETC2 };                       // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+            case 151:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::ETC2 };                     // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+            case 152:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::ETC2 };                      // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+            case 153:       return ImageFormat { .channels = ImageChannels::R, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::EAC };                         // VK_FORMAT_EAC_R11_UNORM_BLOCK
+            case 154:       return ImageFormat { .channels = ImageChannels::R, .memoryType = ImageMemoryType::Norm8, .compression = ImageCompression::EAC };                          // VK_FORMAT_EAC_R11_SNORM_BLOCK
+            case 155:       return ImageFormat { .channels = ImageChannels::RG, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::EAC };                        // VK_FORMAT_EAC_R11G11_UNORM_BLOCK
+            case 156:       return ImageFormat { .channels = ImageChannels::RG, .memoryType = ImageMemoryType::Norm8, .compression = ImageCompression::EAC };                         // VK_FORMAT_EAC_R11G11_SNORM_BLOCK
+            case 157:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::ASTC4x4 };                  // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+            case 158:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::ASTC4x4 };                   // VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+            case 165:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::ASTC6x6 };                  // VK_FORMAT_ASTC_6x6_UNORM_BLOCK
+            case 166:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::ASTC6x6 };                   // VK_FORMAT_ASTC_6x6_SRGB_BLOCK
+            case 171:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::ASTC8x8 };                  // VK_FORMAT_ASTC_8x8_UNORM_BLOCK
+            case 172:       return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::ASTC8x8 };                   // VK_FORMAT_ASTC_8x8_SRGB_BLOCK
+            default:        break;
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<ImageFormat> ImageContainer::DXGIFormatToImageFormat(const uint32 dxgiFormat)
+    {
+        switch (dxgiFormat)
+        {
+            case 2:         return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::Float32 };                                                           // DXGI_FORMAT_R32G32B32A32_FLOAT
+            case 10:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::Float16 };                                                           // DXGI_FORMAT_R16G16B16A16_FLOAT
+            case 28:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8 };                                                            // DXGI_FORMAT_R8G8B8A8_UNORM
+            case 29:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8 };                                                             // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+            case 49:        return ImageFormat { .channels = ImageChannels::RG, .memoryType = ImageMemoryType::UNorm8 };                                                              // DXGI_FORMAT_R8G8_UNORM
+            case 61:        return ImageFormat { .channels = ImageChannels::R, .memoryType = ImageMemoryType::UNorm8 };                                                               // DXGI_FORMAT_R8_UNORM
+            case 71:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC1 };                      // DXGI_FORMAT_BC1_UNORM
+            case 72:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::BC1 };                       // DXGI_FORMAT_BC1_UNORM_SRGB
+            case 74:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC2 };                      // DXGI_FORMAT_BC2_UNORM
+            case 75:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::BC2 };                       // DXGI_FORMAT_BC2_UNORM_SRGB
+            case 77:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC3 };                      // DXGI_FORMAT_BC3_UNORM
+            case 78:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::BC3 };                       // DXGI_FORMAT_BC3_UNORM_SRGB
+            case 80:        return ImageFormat { .channels = ImageChannels::R, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC4 };                         // DXGI_FORMAT_BC4_UNORM
+            case 81:        return ImageFormat { .channels = ImageChannels::R, .memoryType = ImageMemoryType::Norm8, .compression = ImageCompression::BC4 };                          // DXGI_FORMAT_BC4_SNORM
+            case 83:        return ImageFormat { .channels = ImageChannels::RG, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC5 };                        // DXGI_FORMAT_BC5_UNORM
+            case 84:        return ImageFormat { .channels = ImageChannels::RG, .memoryType = ImageMemoryType::Norm8, .compression = ImageCompression::BC5 };                         // DXGI_FORMAT_BC5_SNORM
+            case 87:        return ImageFormat { .channels = ImageChannels::BGRA, .memoryType = ImageMemoryType::UNorm8 };                                                            // DXGI_FORMAT_B8G8R8A8_UNORM
+            case 91:        return ImageFormat { .channels = ImageChannels::BGRA, .memoryType = ImageMemoryType::SRGB8 };                                                             // DXGI_FORMAT_B8G8R8A8_UNORM_SRGB
+            case 95:        return ImageFormat { .channels = ImageChannels::RGB, .memoryType = ImageMemoryType::Float16, .compression = ImageCompression::BC6H };                     // DXGI_FORMAT_BC6H_UF16
+            case 98:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC7 };                      // DXGI_FORMAT_BC7_UNORM
+            case 99:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::SRGB8, .compression = ImageCompression::BC7 };                       // DXGI_FORMAT_BC7_UNORM_SRGB
+            default:        break;
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<ImageFormat> ImageContainer::FourCCToImageFormat(const uint32 fourCC)
+    {
+        switch (fourCC)
+        {
+            case 0x31545844:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC1 };  // "DXT1"
+            case 0x32545844:        // "DXT2"
+            case 0x33545844:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC2 };  // "DXT3"
+            case 0x34545844:        // "DXT4"
+            case 0x35545844:        return ImageFormat { .channels = ImageChannels::RGBA, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC3 };  // "DXT5"
+            case 0x31495441:        // "ATI1"
+            case 0x55344342:        return ImageFormat { .channels = ImageChannels::R, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC4 };     // "BC4U"
+            case 0x32495441:        // "ATI2"
+            case 0x55354342:        return ImageFormat { .channels = ImageChannels::RG, .memoryType = ImageMemoryType::UNorm8, .compression = ImageCompression::BC5 };    // "BC5U"
+            default:                break;
+        }
+
+        return std::nullopt;
+    }
+
+}
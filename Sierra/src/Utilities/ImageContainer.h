@@ -0,0 +1,80 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "../Rendering/RenderingContext.h"
+
+namespace Sierra
+{
+
+    struct ImageContainerSubresource
+    {
+        uint32 mipLevel = 0;
+        uint32 layer = 0;
+        uint64 byteOffset = 0;
+        uint64 memorySize = 0;
+    };
+
+    struct ImageContainerData
+    {
+        uint32 width = 0;
+        uint32 height = 0;
+
+        ImageType type = ImageType::Plane;
+        ImageFormat format = { };
+
+        uint32 mipLevelCount = 1;
+        uint32 layerCount = 1;
+
+        std::vector<char> fileMemory;
+        std::vector<ImageContainerSubresource> subresources;
+    };
+
+    struct ImageContainerLoadInfo
+    {
+        const std::string &name = "Image";
+        const std::filesystem::path &filePath;
+        ImageUsage usage = ImageUsage::Sample;
+        ImageCommandUsage nextUsage = ImageCommandUsage::GraphicsRead;
+    };
+
+    class SIERRA_API ImageContainer final
+    {
+    public:
+        /* --- POLLING METHODS --- */
+        // Parses a KTX2 or DDS container, leaving its (possibly block-compressed) memory as-is, and recording where every mip level of every layer lies within it - returns nothing if the container is malformed or truncated
+        [[nodiscard]] static std::optional<ImageContainerData> Parse(std::vector<char> &&fileMemory);
+
+        // Creates an image from a KTX2 or DDS container and records the upload of all of its mip levels, from a single staging buffer, within the given command buffer - returns a null image if the container could not be parsed
+        [[nodiscard]] static std::unique_ptr<Image> Load(const RenderingContext &renderingContext, std::unique_ptr<CommandBuffer> &commandBuffer, const ImageContainerLoadInfo &loadInfo);
+
+    private:
+        [[nodiscard]] static std::optional<ImageContainerData> ParseKTX2(std::vector<char> &&fileMemory);
+        [[nodiscard]] static std::optional<ImageContainerData> ParseDDS(std::vector<char> &&fileMemory);
+        [[nodiscard]] static bool IsImageValid(ImageFormat format, uint32 width, uint32 height, uint32 mipLevelCount, uint64 memorySize);
+
+        template<typename T>
+        [[nodiscard]] static T ReadFromMemory(const std::vector<char> &memory, const uint64 byteOffset)
+        {
+            // Callers validate offsets beforehand, but reading past the memory must not be possible in any build
+            if (byteOffset > memory.size() || sizeof(T) > memory.size() - byteOffset)
+            {
+                SR_ERROR("Cannot read [{0}] bytes at offset [{1}] of image container, as its memory is only [{2}] bytes!", sizeof(T), byteOffset, memory.size());
+                return { };
+            }
+
+            T value;
+            std::memcpy(&value, memory.data() + byteOffset, sizeof(T));
+            return value;
+        }
+
+        /* --- CONVERSIONS --- */
+        [[nodiscard]] static std::optional<ImageFormat> VkFormatToImageFormat(uint32 vkFormat);
+        [[nodiscard]] static std::optional<ImageFormat> DXGIFormatToImageFormat(uint32 dxgiFormat);
+        [[nodiscard]] static std::optional<ImageFormat> FourCCToImageFormat(uint32 fourCC);
+
+    };
+
+}
@@ -0,0 +1,87 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "Readback.h"
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    Readback::Readback(const Device &device, std::unique_ptr<Buffer> &&buffer, const uint64 signalValue)
+        : device(device), buffer(std::move(buffer)), signalValue(signalValue)
+    {
+
+    }
+
+    Readback Readback::ReadImage(const RenderingContext &renderingContext, std::unique_ptr<CommandBuffer> &commandBuffer, const ImageReadbackInfo &readbackInfo)
+    {
+        const std::unique_ptr<Image> &image = readbackInfo.image;
+        SR_ERROR_IF(readbackInfo.mipLevel >= image->GetMipLevelCount(), "Cannot read back mip level [{0}] of image [{1}], as it does not contain it!", readbackInfo.mipLevel, image->GetName());
+
+        // Rows are tightly packed within the readback buffer
+        const Vector2UInt mipLevelExtent = { std::max(image->GetWidth() >> readbackInfo.mipLevel, 1U), std::max(image->GetHeight() >> readbackInfo.mipLevel, 1U) };
+        const Vector2UInt pixelRange = { readbackInfo.pixelRange.x != 0 ? readbackInfo.pixelRange.x : mipLevelExtent.x - readbackInfo.pixelOffset.x, readbackInfo.pixelRange.y != 0 ? readbackInfo.pixelRange.y : mipLevelExtent.y - readbackInfo.pixelOffset.y };
+
+        const std::string readbackBufferName = "Readback Buffer of Image [" + image->GetName() + "]";
+        std::unique_ptr<Buffer> readbackBuffer = renderingContext.CreateBuffer({
+            .name = readbackBufferName,
+            .memorySize = ImageFormatToRegionMemorySize(image->GetFormat(), pixelRange.x, pixelRange.y),
+            .usage = BufferUsage::DestinationMemory,
+            .memoryLocation = BufferMemoryLocation::CPU
+        });
+
+        // Record copy
+        commandBuffer->SynchronizeImageUsage(image, readbackInfo.previousUsage, ImageCommandUsage::MemoryRead, readbackInfo.mipLevel, 1, readbackInfo.layer, 1);
+        commandBuffer->CopyImageToBuffer(image, readbackBuffer, readbackInfo.mipLevel, pixelRange, readbackInfo.layer, readbackInfo.pixelOffset);
+        commandBuffer->SynchronizeImageUsage(image, ImageCommandUsage::MemoryRead, readbackInfo.nextUsage, readbackInfo.mipLevel, 1, readbackInfo.layer, 1);
+        commandBuffer->SynchronizeBufferUsage(readbackBuffer, BufferCommandUsage::MemoryWrite, BufferCommandUsage::HostRead);
+
+        return { renderingContext.GetDevice(), std::move(readbackBuffer), commandBuffer->GetCompletionSignalValue() };
+    }
+
+    Readback Readback::ReadBuffer(const RenderingContext &renderingContext, std::unique_ptr<CommandBuffer> &commandBuffer, const BufferReadbackInfo &readbackInfo)
+    {
+        const std::unique_ptr<Buffer> &buffer = readbackInfo.buffer;
+        const uint64 memoryRange = readbackInfo.memoryRange != 0 ? readbackInfo.memoryRange : buffer->GetMemorySize() - readbackInfo.byteOffset;
+        SR_ERROR_IF(readbackInfo.byteOffset + memoryRange > buffer->GetMemorySize(), "Cannot read back [{0}] bytes of memory, which is offset by another [{1}] bytes, from buffer [{2}], as the resulting memory space of a total of [{3}] bytes is bigger than the size of the buffer - [{4}]!", memoryRange, readbackInfo.byteOffset, buffer->GetName(), readbackInfo.byteOffset + memoryRange, buffer->GetMemorySize());
+
+        const std::string readbackBufferName = "Readback Buffer of Buffer [" + buffer->GetName() + "]";
+        std::unique_ptr<Buffer> readbackBuffer = renderingContext.CreateBuffer({
+            .name = readbackBufferName,
+            .memorySize = memoryRange,
+            .usage = BufferUsage::DestinationMemory,
+            .memoryLocation = BufferMemoryLocation::CPU
+        });
+
+        // Record copy
+        commandBuffer->SynchronizeBufferUsage(buffer, readbackInfo.previousUsage, BufferCommandUsage::MemoryRead, memoryRange, readbackInfo.byteOffset);
+        commandBuffer->CopyBufferToBuffer(buffer, readbackBuffer, memoryRange, readbackInfo.byteOffset, 0);
+        commandBuffer->SynchronizeBufferUsage(buffer, BufferCommandUsage::MemoryRead, readbackInfo.nextUsage, memoryRange, readbackInfo.byteOffset);
+        commandBuffer->SynchronizeBufferUsage(readbackBuffer, BufferCommandUsage::MemoryWrite, BufferCommandUsage::HostRead);
+
+        return { renderingContext.GetDevice(), std::move(readbackBuffer), commandBuffer->GetCompletionSignalValue() };
+    }
+
+    /* --- POLLING METHODS --- */
+
+    void Readback::Wait() const
+    {
+        device.WaitForSignalValue(signalValue);
+    }
+
+    /* --- GETTER METHODS --- */
+
+    bool Readback::IsReady() const
+    {
+        return device.GetCompletedSignalValue() >= signalValue;
+    }
+
+    const void* Readback::GetData() const
+    {
+        SR_ERROR_IF(!IsReady(), "Cannot get data of readback buffer [{0}], as the command buffer, which writes to it, has not yet finished execution!", buffer->GetName());
+        return buffer->GetData();
+    }
+
+}
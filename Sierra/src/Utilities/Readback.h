@@ -0,0 +1,72 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "../Rendering/RenderingContext.h"
+
+namespace Sierra
+{
+
+    struct ImageReadbackInfo
+    {
+        const std::unique_ptr<Image> &image;
+        uint32 mipLevel = 0;
+        uint32 layer = 0;
+        Vector2UInt pixelRange = { 0, 0 };
+        Vector2UInt pixelOffset = { 0, 0 };
+        ImageCommandUsage previousUsage = ImageCommandUsage::GraphicsRead;
+        ImageCommandUsage nextUsage = ImageCommandUsage::GraphicsRead;
+    };
+
+    struct BufferReadbackInfo
+    {
+        const std::unique_ptr<Buffer> &buffer;
+        uint64 memoryRange = 0;
+        uint64 byteOffset = 0;
+        BufferCommandUsage previousUsage = BufferCommandUsage::ComputeWrite;
+        BufferCommandUsage nextUsage = BufferCommandUsage::ComputeRead;
+    };
+
+    class SIERRA_API Readback final
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        // Records a copy of the image region into a host-visible buffer, whose data becomes available once the command buffer has been executed
+        [[nodiscard]] static Readback ReadImage(const RenderingContext &renderingContext, std::unique_ptr<CommandBuffer> &commandBuffer, const ImageReadbackInfo &readbackInfo);
+
+        // Records a copy of the buffer range into a host-visible buffer, whose data becomes available once the command buffer has been executed
+        [[nodiscard]] static Readback ReadBuffer(const RenderingContext &renderingContext, std::unique_ptr<CommandBuffer> &commandBuffer, const BufferReadbackInfo &readbackInfo);
+
+        /* --- POLLING METHODS --- */
+        void Wait() const;
+
+        /* --- GETTER METHODS --- */
+        [[nodiscard]] bool IsReady() const;
+        [[nodiscard]] inline uint64 GetSignalValue() const { return signalValue; }
+
+        [[nodiscard]] const void* GetData() const;
+        template<typename T>
+        [[nodiscard]] inline const T* GetDataAs() const { return reinterpret_cast<const T*>(GetData()); }
+        [[nodiscard]] inline uint64 GetMemorySize() const { return buffer->GetMemorySize(); }
+
+        /* --- OPERATORS --- */
+        Readback(const Readback&) = delete;
+        Readback& operator=(const Readback&) = delete;
+
+        Readback(Readback&&) = default;
+
+        /* --- DESTRUCTOR --- */
+        ~Readback() = default;
+
+    private:
+        Readback(const Device &device, std::unique_ptr<Buffer> &&buffer, uint64 signalValue);
+
+        const Device &device;
+        std::unique_ptr<Buffer> buffer;
+        uint64 signalValue = 0;
+
+    };
+
+}
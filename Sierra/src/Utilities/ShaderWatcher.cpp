@@ -0,0 +1,284 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#include "ShaderWatcher.h"
+
+#if SR_PLATFORM_LINUX
+    #include <sys/inotify.h>
+    #include <poll.h>
+    #include <unistd.h>
+#endif
+
+namespace Sierra
+{
+
+    /* --- CONSTRUCTORS --- */
+
+    ShaderWatcher::ShaderWatcher(const RenderingContext &renderingContext, const ShaderWatcherCreateInfo &createInfo)
+        : renderingContext(renderingContext), debounceDuration(createInfo.debounceDuration)
+    {
+        #if SR_PLATFORM_LINUX
+            inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            SR_ERROR_IF(inotifyDescriptor == -1, "Could not create inotify instance of shader watcher!");
+        #endif
+
+        thread = std::thread(&ShaderWatcher::Run, this);
+    }
+
+    /* --- POLLING METHODS --- */
+
+    void ShaderWatcher::WatchShader(std::unique_ptr<Shader> &shader, const ShaderCreateInfo &createInfo)
+    {
+        SR_ERROR_IF(createInfo.shaderBundlePath.empty() || createInfo.shaderArchive != nullptr || createInfo.spirvMemory.data != nullptr || createInfo.metalLibraryMemory.data != nullptr, "Cannot watch shader [{0}], as only shaders loaded from a shader bundle directory can be reloaded!", createInfo.name);
+
+        std::unique_ptr<WatchedShader> watchedShader = std::unique_ptr<WatchedShader>(new WatchedShader{ .shader = shader, .name = createInfo.name, .shaderBundlePath = createInfo.shaderBundlePath, .shaderType = createInfo.shaderType });
+        #if SR_PLATFORM_LINUX
+            watchedShader->watchDescriptor = inotify_add_watch(inotifyDescriptor, createInfo.shaderBundlePath.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF);
+            SR_WARNING_IF(watchedShader->watchDescriptor == -1, "Could not watch shader bundle [{0}] of shader [{1}]!", createInfo.shaderBundlePath.string().c_str(), createInfo.name);
+        #else
+            watchedShader->lastWriteTime = GetLastWriteTime(createInfo.shaderBundlePath);
+        #endif
+
+        std::lock_guard lock(mutex);
+        watchedShaders.push_back(std::move(watchedShader));
+    }
+
+    void ShaderWatcher::WatchPipeline(std::unique_ptr<GraphicsPipeline> &pipeline, const std::initializer_list<std::reference_wrapper<const std::unique_ptr<Shader>>> &shaders, const std::function<std::unique_ptr<GraphicsPipeline>(const WatchedPipelineShaders &shaders)> &Builder)
+    {
+        WatchPipeline<GraphicsPipeline>(pipeline, shaders, Builder);
+    }
+
+    void ShaderWatcher::WatchPipeline(std::unique_ptr<ComputePipeline> &pipeline, const std::initializer_list<std::reference_wrapper<const std::unique_ptr<Shader>>> &shaders, const std::function<std::unique_ptr<ComputePipeline>(const WatchedPipelineShaders &shaders)> &Builder)
+    {
+        WatchPipeline<ComputePipeline>(pipeline, shaders, Builder);
+    }
+
+    bool ShaderWatcher::Update()
+    {
+        std::lock_guard lock(mutex);
+
+        // Reloaded shaders are held back until every pipeline, which uses any of them, has been rebuilt from them, so that both are swapped in together
+        const bool shadersReloaded = std::any_of(watchedShaders.begin(), watchedShaders.end(), [](const std::unique_ptr<WatchedShader> &watchedShader) { return watchedShader->reloadedShader != nullptr; });
+        if (!shadersReloaded) return false;
+        for (const std::unique_ptr<WatchedPipeline> &watchedPipeline : watchedPipelines)
+        {
+            if (watchedPipeline->rebuilt) continue;
+            if (std::any_of(watchedPipeline->shaders.begin(), watchedPipeline->shaders.end(), [this](const std::unique_ptr<Shader>* shader) { return GetReloadedShader(shader) != nullptr; })) return false;
+        }
+
+        for (const std::unique_ptr<WatchedPipeline> &watchedPipeline : watchedPipelines)
+        {
+            if (!watchedPipeline->rebuilt) continue;
+
+            watchedPipeline->Swap();
+            watchedPipeline->rebuilt = false;
+        }
+        for (const std::unique_ptr<WatchedShader> &watchedShader : watchedShaders)
+        {
+            if (watchedShader->reloadedShader == nullptr) continue;
+
+            // Old shader may still be referenced by work in flight, so it is not destroyed right away
+            renderingContext.GetDevice().QueueResourceForDestruction(std::move(watchedShader->shader));
+            watchedShader->shader = std::move(watchedShader->reloadedShader);
+        }
+
+        return true;
+    }
+
+    /* --- DESTRUCTOR --- */
+
+    ShaderWatcher::~ShaderWatcher()
+    {
+        stopping = true;
+        thread.join();
+
+        #if SR_PLATFORM_LINUX
+            close(inotifyDescriptor);
+        #endif
+    }
+
+    /* --- PRIVATE METHODS --- */
+
+    template<typename T>
+    void ShaderWatcher::WatchPipeline(std::unique_ptr<T> &pipeline, const std::initializer_list<std::reference_wrapper<const std::unique_ptr<Shader>>> &shaders, const std::function<std::unique_ptr<T>()> &Builder)
+    {
+        const Device &device = renderingContext.GetDevice();
+        const std::shared_ptr<std::unique_ptr<T>> rebuiltPipeline = std::make_shared<std::unique_ptr<T>>(nullptr);
+
+        std::unique_ptr<WatchedPipeline> watchedPipeline = std::make_unique<WatchedPipeline>();
+        for (const std::unique_ptr<Shader> &shader : shaders) watchedPipeline->shaders.push_back(&shader);
+        watchedPipeline->Build = [Builder, rebuiltPipeline](const WatchedPipelineShaders &pipelineShaders) -> bool
+        {
+            // Builders report invalid shaders by throwing, which must not escape the watcher thread
+            try
+            {
+                *rebuiltPipeline = Builder(pipelineShaders);
+            }
+            catch (const std::exception &exception)
+            {
+                SR_WARNING("Building of watched pipeline failed! {0}", exception.what());
+                *rebuiltPipeline = nullptr;
+            }
+            return *rebuiltPipeline != nullptr;
+        };
+        watchedPipeline->Swap = [&pipeline, &device, rebuiltPipeline]()
+        {
+            device.QueueResourceForDestruction(std::move(pipeline));
+            pipeline = std::move(*rebuiltPipeline);
+        };
+
+        std::lock_guard lock(mutex);
+        watchedPipelines.push_back(std::move(watchedPipeline));
+    }
+
+    const std::unique_ptr<Shader>* ShaderWatcher::GetReloadedShader(const std::unique_ptr<Shader>* const shader) const
+    {
+        for (const std::unique_ptr<WatchedShader> &watchedShader : watchedShaders)
+        {
+            if (&watchedShader->shader == shader && watchedShader->reloadedShader != nullptr) return &watchedShader->reloadedShader;
+        }
+        return nullptr;
+    }
+
+    void ShaderWatcher::Run()
+    {
+        while (!stopping)
+        {
+            PollChanges();
+
+            // Reload shaders, whose bundles have not changed for the debounce duration (created shaders are staged until swapped in)
+            std::vector<WatchedShader*> shadersToReload;
+            {
+                std::lock_guard lock(mutex);
+                for (const std::unique_ptr<WatchedShader> &watchedShader : watchedShaders)
+                {
+                    if (!watchedShader->lastChangeTime.has_value() || TimePoint::Now() - watchedShader->lastChangeTime.value() < debounceDuration) continue;
+
+                    watchedShader->lastChangeTime = std::nullopt;
+                    shadersToReload.push_back(watchedShader.get());
+                }
+            }
+            for (WatchedShader* const watchedShader : shadersToReload)
+            {
+                // Shaders, which fail to load (e.g. because their bundle was only partially written), keep their old version, and are reloaded on their next change
+                std::unique_ptr<Shader> reloadedShader = nullptr;
+                try
+                {
+                    reloadedShader = renderingContext.CreateShader({ .name = watchedShader->name, .shaderBundlePath = watchedShader->shaderBundlePath, .shaderType = watchedShader->shaderType });
+                }
+                catch (const std::exception &exception)
+                {
+                    SR_WARNING("Could not reload shader [{0}]! Its old version will be kept. {1}", watchedShader->name, exception.what());
+                    continue;
+                }
+
+                // Pipelines, which were already rebuilt from a previously staged version of the shader, have to be rebuilt again
+                std::lock_guard lock(mutex);
+                watchedShader->reloadedShader = std::move(reloadedShader);
+                for (const std::unique_ptr<WatchedPipeline> &watchedPipeline : watchedPipelines)
+                {
+                    if (std::find(watchedPipeline->shaders.begin(), watchedPipeline->shaders.end(), &watchedShader->shader) == watchedPipeline->shaders.end()) continue;
+                    watchedPipeline->rebuildRequested = true;
+                    watchedPipeline->rebuilt = false;
+                }
+            }
+
+            // Rebuild pipelines from staged shaders (staged shaders and slots stay unchanged meanwhile, as Update() swaps nothing, until all of them have been rebuilt)
+            std::vector<std::pair<WatchedPipeline*, WatchedPipelineShaders>> pipelinesToRebuild;
+            {
+                std::lock_guard lock(mutex);
+                for (const std::unique_ptr<WatchedPipeline> &watchedPipeline : watchedPipelines)
+                {
+                    if (!watchedPipeline->rebuildRequested) continue;
+                    watchedPipeline->rebuildRequested = false;
+
+                    WatchedPipelineShaders pipelineShaders;
+                    for (const std::unique_ptr<Shader>* const shader : watchedPipeline->shaders)
+                    {
+                        const std::unique_ptr<Shader>* const reloadedShader = GetReloadedShader(shader);
+                        pipelineShaders.push_back(std::cref(reloadedShader != nullptr ? *reloadedShader : *shader));
+                    }
+                    pipelinesToRebuild.emplace_back(watchedPipeline.get(), std::move(pipelineShaders));
+                }
+            }
+            for (const auto &[watchedPipeline, pipelineShaders] : pipelinesToRebuild)
+            {
+                // Failed pipelines hold back all staged shaders (keeping old shaders and pipelines in use, so they stay consistent), until their shaders are reloaded again
+                const bool built = watchedPipeline->Build(pipelineShaders);
+                SR_WARNING_IF(!built, "Could not rebuild pipeline from reloaded shaders! Old shaders and pipelines will be kept, until its shaders change again.");
+
+                std::lock_guard lock(mutex);
+                watchedPipeline->rebuilt = built;
+            }
+        }
+    }
+
+    void ShaderWatcher::PollChanges()
+    {
+        #if SR_PLATFORM_LINUX
+            // Bundles, which were replaced as a whole, need to be watched anew
+            {
+                std::lock_guard lock(mutex);
+                for (const std::unique_ptr<WatchedShader> &watchedShader : watchedShaders)
+                {
+                    if (watchedShader->watchDescriptor != -1 || !File::DirectoryExists(watchedShader->shaderBundlePath)) continue;
+
+                    watchedShader->watchDescriptor = inotify_add_watch(inotifyDescriptor, watchedShader->shaderBundlePath.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF);
+                    if (watchedShader->watchDescriptor != -1) watchedShader->lastChangeTime = TimePoint::Now();
+                }
+            }
+
+            // Wait for events (timeout lets the thread check if it should stop)
+            pollfd pollDescriptor = { .fd = inotifyDescriptor, .events = POLLIN, .revents = 0 };
+            if (poll(&pollDescriptor, 1, 50) <= 0) return;
+
+            alignas(inotify_event) char buffer[4096];
+            ssize_t readMemorySize = 0;
+            while ((readMemorySize = read(inotifyDescriptor, buffer, sizeof(buffer))) > 0)
+            {
+                std::lock_guard lock(mutex);
+                for (const char* iterator = buffer; iterator < buffer + readMemorySize;)
+                {
+                    const inotify_event &event = *reinterpret_cast<const inotify_event*>(iterator);
+                    iterator += sizeof(inotify_event) + event.len;
+
+                    for (const std::unique_ptr<WatchedShader> &watchedShader : watchedShaders)
+                    {
+                        if (watchedShader->watchDescriptor != event.wd) continue;
+
+                        // Moved bundles are unwatched, which, like deleted ones, is reported with IN_IGNORED
+                        if (event.mask & IN_MOVE_SELF) inotify_rm_watch(inotifyDescriptor, event.wd);
+                        if (event.mask & IN_IGNORED) watchedShader->watchDescriptor = -1;
+                        else if (event.mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) watchedShader->lastChangeTime = TimePoint::Now();
+                    }
+                }
+            }
+        #else
+            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+            std::lock_guard lock(mutex);
+            for (const std::unique_ptr<WatchedShader> &watchedShader : watchedShaders)
+            {
+                const std::filesystem::file_time_type lastWriteTime = GetLastWriteTime(watchedShader->shaderBundlePath);
+                if (lastWriteTime == watchedShader->lastWriteTime) continue;
+
+                watchedShader->lastWriteTime = lastWriteTime;
+                watchedShader->lastChangeTime = TimePoint::Now();
+            }
+        #endif
+    }
+
+    std::filesystem::file_time_type ShaderWatcher::GetLastWriteTime(const std::filesystem::path &shaderBundlePath)
+    {
+        std::filesystem::file_time_type lastWriteTime = { };
+
+        std::error_code errorCode;
+        for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(shaderBundlePath, errorCode))
+        {
+            lastWriteTime = std::max(lastWriteTime, entry.last_write_time(errorCode));
+        }
+        return lastWriteTime;
+    }
+
+}
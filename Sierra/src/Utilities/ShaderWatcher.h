@@ -0,0 +1,89 @@
+//
+// Created by Nikolay Kanchevski on 19.10.26.
+//
+
+#pragma once
+
+#include "../Rendering/RenderingContext.h"
+#include "Time.h"
+
+namespace Sierra
+{
+
+    struct ShaderWatcherCreateInfo
+    {
+        TimeStep debounceDuration = TimeStep(100.0); // Files of a bundle are written one by one, so it is only reloaded once none of them has changed for this long
+    };
+
+    using WatchedPipelineShaders = std::vector<std::reference_wrapper<const std::unique_ptr<Shader>>>;
+
+    // Opt-in watcher, which recreates shaders once their bundles are recompiled, and rebuilds the pipelines using them, all on a background thread (bundles are watched with inotify on Linux, and polled for changes elsewhere)
+    class SIERRA_API ShaderWatcher final
+    {
+    public:
+        /* --- CONSTRUCTORS --- */
+        ShaderWatcher(const RenderingContext &renderingContext, const ShaderWatcherCreateInfo &createInfo = { });
+
+        /* --- POLLING METHODS --- */
+        // Shader (as well as the pipeline slots below) must outlive the watcher, and is reloaded from its bundle with the same create info (shaders created from memory or archives cannot be watched)
+        void WatchShader(std::unique_ptr<Shader> &shader, const ShaderCreateInfo &createInfo);
+
+        // Pipeline is rebuilt (on the watcher's thread) by calling the builder once any of the given shaders has been reloaded - the builder receives the given shaders in the same order, with reloaded ones in place of the ones still in use, and must build from those, rather than from their slots
+        void WatchPipeline(std::unique_ptr<GraphicsPipeline> &pipeline, const std::initializer_list<std::reference_wrapper<const std::unique_ptr<Shader>>> &shaders, const std::function<std::unique_ptr<GraphicsPipeline>(const WatchedPipelineShaders &shaders)> &Builder);
+        void WatchPipeline(std::unique_ptr<ComputePipeline> &pipeline, const std::initializer_list<std::reference_wrapper<const std::unique_ptr<Shader>>> &shaders, const std::function<std::unique_ptr<ComputePipeline>(const WatchedPipelineShaders &shaders)> &Builder);
+
+        // Swaps reloaded shaders together with all pipelines rebuilt from them, queueing old ones for destruction (nothing is swapped while any of those pipelines is still being rebuilt, or has failed to) - must be called at a frame boundary, and returns whether anything was swapped
+        bool Update();
+
+        /* --- OPERATORS --- */
+        ShaderWatcher(const ShaderWatcher&) = delete;
+        ShaderWatcher& operator=(const ShaderWatcher&) = delete;
+
+        /* --- DESTRUCTOR --- */
+        ~ShaderWatcher();
+
+    private:
+        const RenderingContext &renderingContext;
+        const TimeStep debounceDuration;
+
+        struct WatchedShader
+        {
+            std::unique_ptr<Shader> &shader;
+            std::string name;
+            std::filesystem::path shaderBundlePath;
+            ShaderType shaderType = ShaderType::Undefined;
+
+            int watchDescriptor = -1;
+            std::filesystem::file_time_type lastWriteTime = { };
+            std::optional<TimePoint> lastChangeTime = std::nullopt;
+            std::unique_ptr<Shader> reloadedShader = nullptr; // Staged until every pipeline using it has been rebuilt from it
+        };
+        std::vector<std::unique_ptr<WatchedShader>> watchedShaders;
+
+        struct WatchedPipeline
+        {
+            std::vector<const std::unique_ptr<Shader>*> shaders;
+            std::function<bool(const WatchedPipelineShaders&)> Build; // Builds a new pipeline from the given shaders, and keeps it until swapped in, returning whether it succeeded
+            std::function<void()> Swap; // Swaps the new pipeline in, and queues the old one for destruction
+
+            bool rebuildRequested = false;
+            bool rebuilt = false; // Whether it has been successfully rebuilt from the currently staged shaders
+        };
+        std::vector<std::unique_ptr<WatchedPipeline>> watchedPipelines;
+
+        int inotifyDescriptor = -1;
+        std::mutex mutex;
+        std::atomic<bool> stopping = false;
+        std::thread thread;
+
+        template<typename T>
+        void WatchPipeline(std::unique_ptr<T> &pipeline, const std::initializer_list<std::reference_wrapper<const std::unique_ptr<Shader>>> &shaders, const std::function<std::unique_ptr<T>(const WatchedPipelineShaders &shaders)> &Builder);
+
+        [[nodiscard]] const std::unique_ptr<Shader>* GetReloadedShader(const std::unique_ptr<Shader>* shader) const; // Returns the staged version of a watched shader's slot, if any (mutex must be held)
+        void Run();
+        void PollChanges();
+        [[nodiscard]] static std::filesystem::file_time_type GetLastWriteTime(const std::filesystem::path &shaderBundlePath);
+
+    };
+
+}
@@ -68,6 +68,8 @@
         #include <regex>
         #include <chrono>
         #include <mutex>
+        #include <atomic>
+        #include <condition_variable>
         #include <shared_mutex>
         #include <future>
         #include <string>
@@ -159,6 +161,11 @@
             inline T& operator^= (T& a, const T b) { return reinterpret_cast<T&>(reinterpret_cast<std::underlying_type_t<T>&>(a) ^= static_cast<std::underlying_type_t<T>>(b)); }             
     #pragma endregion
 
+    #pragma region Functions
+        template<typename T>
+        inline void HashCombine(Hash &seed, const T &value) { seed ^= std::hash<T>{}(value) + 0x9E3779B9 + (seed << 6) + (seed >> 2); }
+    #pragma endregion
+
     #pragma region Source Files
         #include "Core/Logger.h"
         #include "Core/ScopeProfiler.h"